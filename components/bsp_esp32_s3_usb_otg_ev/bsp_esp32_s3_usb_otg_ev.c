@@ -17,6 +17,8 @@
 #include "driver/sdmmc_defs.h"
 #include "driver/sdmmc_types.h"
 #include "sdmmc_cmd.h"
+#include "esp_timer.h"
+#include "metrics.h"
 
 #ifdef SOC_SDMMC_HOST_SUPPORTED
 #include "driver/sdmmc_host.h"
@@ -43,6 +45,10 @@ static bool s_board_adc_isinit = false;
 static bool s_board_lcd_isinit = false;
 static bool s_board_sdcard_isinit = false;
 
+METRICS_HISTOGRAM_DEFINE(s_lcd_flush_time, "lcd_flush_duration_seconds", "Time to push one image area to the LCD",
+                         NULL, METRICS_LATENCY_BOUNDS_US);
+METRICS_COUNTER_DEFINE(s_lcd_flush_pixels, "lcd_flush_pixels_total", "Pixels written to the LCD", NULL);
+
 #define BOARD_CHECK(a, str, ret) if(!(a)) { \
         ESP_LOGE(TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str); \
         return (ret); \
@@ -256,6 +262,9 @@ static void lcd_screen_clear(scr_driver_t *lcd, int color)
 {
     scr_info_t lcd_info;
     lcd->get_info(&lcd_info);
+    if (lcd->fill_rect && ESP_OK == lcd->fill_rect(0, 0, lcd_info.width, lcd_info.height, color)) {
+        return;
+    }
     uint16_t *buffer = malloc(lcd_info.width * sizeof(uint16_t));
 
     if (NULL == buffer) {
@@ -384,7 +393,53 @@ esp_err_t board_lcd_draw_image(uint16_t x, uint16_t y, uint16_t width, uint16_t
 {
     BOARD_CHECK(s_board_lcd_isinit == true, "lcd not inited", ESP_ERR_INVALID_STATE);
     BOARD_CHECK(NULL != img, "Image pointer invalid", ESP_ERR_INVALID_ARG);
-    return s_lcd.draw_bitmap(x, y, width, height, img);
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = s_lcd.draw_bitmap(x, y, width, height, img);
+    metrics_histogram_observe_since(&s_lcd_flush_time, start);
+    metrics_counter_add(&s_lcd_flush_pixels, (uint32_t)width * height);
+    return ret;
+}
+
+esp_err_t board_lcd_draw_image_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *img)
+{
+    BOARD_CHECK(s_board_lcd_isinit == true, "lcd not inited", ESP_ERR_INVALID_STATE);
+    BOARD_CHECK(NULL != img, "Image pointer invalid", ESP_ERR_INVALID_ARG);
+    if (NULL == s_lcd.draw_bitmap_async) {
+        return board_lcd_draw_image(x, y, width, height, img);
+    }
+    /* the transfer overlaps with the caller, only the pixels are counted */
+    metrics_counter_add(&s_lcd_flush_pixels, (uint32_t)width * height);
+    return s_lcd.draw_bitmap_async(x, y, width, height, img);
+}
+
+esp_err_t board_lcd_draw_image_wire_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *img)
+{
+    BOARD_CHECK(s_board_lcd_isinit == true, "lcd not inited", ESP_ERR_INVALID_STATE);
+    BOARD_CHECK(NULL != img, "Image pointer invalid", ESP_ERR_INVALID_ARG);
+    /* board_lcd_wire_swap() returns false without this, the image is then in native order */
+    if (NULL == s_lcd.draw_bitmap_wire_async) {
+        return board_lcd_draw_image_async(x, y, width, height, img);
+    }
+    metrics_counter_add(&s_lcd_flush_pixels, (uint32_t)width * height);
+    return s_lcd.draw_bitmap_wire_async(x, y, width, height, img);
+}
+
+bool board_lcd_wire_swap(void)
+{
+    bool swap = false;
+    if (s_board_lcd_isinit && s_lcd.draw_bitmap_wire_async && s_lcd.get_wire_swap) {
+        s_lcd.get_wire_swap(&swap);
+    }
+    return swap;
+}
+
+esp_err_t board_lcd_wait(void)
+{
+    BOARD_CHECK(s_board_lcd_isinit == true, "lcd not inited", ESP_ERR_INVALID_STATE);
+    if (NULL == s_lcd.draw_wait) {
+        return ESP_OK;
+    }
+    return s_lcd.draw_wait();
 }
 
 #if CONFIG_IDF_TARGET_ESP32S3
@@ -334,6 +334,40 @@ esp_err_t iot_board_wifi_init(void);
  */
 esp_err_t board_lcd_draw_image(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *img);
 
+/**
+ * @brief Start drawing an image, the transfer continues after return
+ * 
+ * img must be DMA capable and stay untouched until board_lcd_wait returns.
+ * Falls back to board_lcd_draw_image if the LCD driver has no asynchronous draw.
+ * 
+ * @return esp_err_t 
+ */
+esp_err_t board_lcd_draw_image_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *img);
+
+/**
+ * @brief Start drawing an image already in LCD bus byte order, see board_lcd_wire_swap
+ * 
+ * The bus driver then skips swapping the pixels before and after the transfer.
+ * Finished by board_lcd_wait like board_lcd_draw_image_async.
+ * 
+ * @return esp_err_t 
+ */
+esp_err_t board_lcd_draw_image_wire_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *img);
+
+/**
+ * @brief Whether images for board_lcd_draw_image_wire_async have to store each pixel high byte first
+ * 
+ * @return true if the pixels have to be byte swapped
+ */
+bool board_lcd_wire_swap(void);
+
+/**
+ * @brief Wait for the image started by board_lcd_draw_image_async
+ * 
+ * @return esp_err_t 
+ */
+esp_err_t board_lcd_wait(void);
+
 #ifdef __cplusplus
 }
 #endif
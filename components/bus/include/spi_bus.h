@@ -112,6 +112,35 @@ esp_err_t spi_bus_transfer_byte(spi_bus_device_handle_t dev_handle, uint8_t data
  */
 esp_err_t spi_bus_transfer_bytes(spi_bus_device_handle_t dev_handle, const uint8_t *data_out, uint8_t *data_in, uint32_t data_len);
 
+/**
+ * @brief Queue bytes to the device and return without waiting for the DMA transfer.
+ *        @note
+ *        data_out must be DMA capable and stay untouched until spi_bus_transfer_wait returns.
+ *        Up to 3 transfers can be queued, a further call waits for the oldest one.
+ *        Other transfers on the same device first wait for the queued ones.
+ *
+ * @param dev_handle handle for device operation.
+ * @param data_out pointer to sent buffer.
+ * @param data_len number of bytes will transfer.
+ * @return esp_err_t
+ *     - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *     - ESP_ERR_TIMEOUT       if bus is busy
+ *     - ESP_OK                on success
+ */
+esp_err_t spi_bus_transfer_bytes_async(spi_bus_device_handle_t dev_handle, const uint8_t *data_out, uint32_t data_len);
+
+/**
+ * @brief Wait until all transfers queued by spi_bus_transfer_bytes_async are done.
+ *
+ * @param dev_handle handle for device operation.
+ * @param ticks_to_wait ticks to wait for the transfers, portMAX_DELAY to wait forever.
+ * @return esp_err_t
+ *     - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *     - ESP_ERR_TIMEOUT       if the transfers did not finish in time
+ *     - ESP_OK                on success
+ */
+esp_err_t spi_bus_transfer_wait(spi_bus_device_handle_t dev_handle, TickType_t ticks_to_wait);
+
 /**************************************** Public Functions (Low level)*********************************************/
 
 /**
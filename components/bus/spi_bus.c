@@ -26,11 +26,17 @@ typedef struct {
     spi_bus_config_t conf;    /*!<spi bus active configuration */
 } _spi_bus_t;
 
+/* Queued transactions per device, same as the driver queue_size */
+#define SPI_BUS_ASYNC_DEPTH 3
+
 typedef struct {
     spi_device_handle_t handle;
     spi_bus_handle_t spi_bus;    /*!<spi bus handle */
     spi_device_interface_config_t conf;    /*!<spi device active configuration */
     SemaphoreHandle_t mutex;    /* mutex to achive device thread-safe*/
+    spi_transaction_t async_trans[SPI_BUS_ASYNC_DEPTH];    /* ring of queued transactions */
+    uint8_t async_head;    /* next free slot in async_trans */
+    uint8_t async_pending;    /* queued transactions not yet collected */
 } _spi_device_t;
 
 static const char *TAG = "spi_bus";
@@ -116,13 +122,15 @@ spi_bus_device_handle_t spi_bus_device_create(spi_bus_device_handle_t bus_handle
         .mode = device_conf->mode,
         .spics_io_num = device_conf->cs_io_num,
         .cs_ena_posttrans = 3,      //Keep the CS low 3 cycles after transaction, to stop slave from missing the last bit when CS has less propagation delay than CLK
-        .queue_size = 3
+        .queue_size = SPI_BUS_ASYNC_DEPTH
     };
     esp_err_t ret = spi_bus_add_device(spi_bus->host_id, &devcfg, &spi_dev->handle);
     SPI_BUS_CHECK_GOTO(ESP_OK == ret, "add spi device failed", cleanup_device);
     spi_dev->mutex = xSemaphoreCreateMutex();
     SPI_BUS_CHECK_GOTO(NULL != spi_dev->mutex, "spi device create mutex failed", cleanup_device);
     spi_dev->spi_bus = bus_handle;
+    spi_dev->async_head = 0;
+    spi_dev->async_pending = 0;
     memcpy(&spi_dev->conf, &devcfg, sizeof(spi_device_interface_config_t));
     ESP_LOGI(TAG, "SPI%d bus device added, CS=%d Mode=%u Speed=%d", spi_bus->host_id + 1, device_conf->cs_io_num, device_conf->mode, device_conf->clock_speed_hz);
     return (spi_bus_device_handle_t)spi_dev;
@@ -132,12 +140,27 @@ cleanup_device:
     return NULL;
 }
 
+/* Collect queued transactions until at most keep are left, must hold the device mutex */
+static esp_err_t _spi_device_async_collect(_spi_device_t *spi_dev, uint8_t keep, TickType_t ticks_to_wait)
+{
+    spi_transaction_t *trans;
+    while (spi_dev->async_pending > keep) {
+        esp_err_t ret = spi_device_get_trans_result(spi_dev->handle, &trans, ticks_to_wait);
+        if (ESP_OK != ret) {
+            return ret;
+        }
+        spi_dev->async_pending--;
+    }
+    return ESP_OK;
+}
+
 esp_err_t spi_bus_device_delete(spi_bus_device_handle_t *p_dev_handle)
 {
     SPI_BUS_CHECK((NULL != p_dev_handle) && (NULL != *p_dev_handle), "Pointer error", ESP_ERR_INVALID_ARG);
     _spi_device_t *spi_dev = (_spi_device_t *)(*p_dev_handle);
     _spi_bus_t *spi_bus = (_spi_bus_t *)(spi_dev->spi_bus);
     SPI_DEVICE_MUTEX_TAKE(spi_dev, ESP_FAIL);
+    _spi_device_async_collect(spi_dev, 0, portMAX_DELAY);
     esp_err_t ret = spi_bus_remove_device(spi_dev->handle);
     SPI_DEVICE_MUTEX_GIVE(spi_dev, ESP_FAIL);
     SPI_BUS_CHECK(ESP_OK == ret, "spi bus delete device failed", ret);
@@ -155,7 +178,11 @@ inline static esp_err_t _spi_device_polling_transmit(spi_bus_device_handle_t dev
     _spi_device_t *spi_dev = (_spi_device_t *)(dev_handle);
     esp_err_t ret;
     SPI_DEVICE_MUTEX_TAKE(spi_dev, ESP_FAIL);
-    ret = spi_device_polling_transmit(spi_dev->handle, trans);
+    /* the driver does not allow polling while queued transactions are pending */
+    ret = _spi_device_async_collect(spi_dev, 0, portMAX_DELAY);
+    if (ESP_OK == ret) {
+        ret = spi_device_polling_transmit(spi_dev->handle, trans);
+    }
     SPI_DEVICE_MUTEX_GIVE(spi_dev, ESP_FAIL);
     return ret;
 }
@@ -203,6 +230,40 @@ esp_err_t spi_bus_transfer_bytes(spi_bus_device_handle_t dev_handle, const uint8
     return ESP_OK;
 }
 
+esp_err_t spi_bus_transfer_bytes_async(spi_bus_device_handle_t dev_handle, const uint8_t *data_out, uint32_t data_len)
+{
+    SPI_BUS_CHECK(NULL != dev_handle, "Pointer error", ESP_ERR_INVALID_ARG);
+    SPI_BUS_CHECK(NULL != data_out && 0 != data_len, "Nothing to send", ESP_ERR_INVALID_ARG);
+    _spi_device_t *spi_dev = (_spi_device_t *)(dev_handle);
+    SPI_DEVICE_MUTEX_TAKE(spi_dev, ESP_FAIL);
+    /* reuse the oldest slot once the ring is full */
+    esp_err_t ret = _spi_device_async_collect(spi_dev, SPI_BUS_ASYNC_DEPTH - 1, portMAX_DELAY);
+    if (ESP_OK == ret) {
+        spi_transaction_t *trans = &spi_dev->async_trans[spi_dev->async_head];
+        memset(trans, 0, sizeof(spi_transaction_t));
+        trans->length = data_len * 8;
+        trans->tx_buffer = data_out;
+        ret = spi_device_queue_trans(spi_dev->handle, trans, portMAX_DELAY);
+        if (ESP_OK == ret) {
+            spi_dev->async_head = (spi_dev->async_head + 1) % SPI_BUS_ASYNC_DEPTH;
+            spi_dev->async_pending++;
+        }
+    }
+    SPI_DEVICE_MUTEX_GIVE(spi_dev, ESP_FAIL);
+    SPI_BUS_CHECK(ret == ESP_OK, "spi queue bytes failed", ret);
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_transfer_wait(spi_bus_device_handle_t dev_handle, TickType_t ticks_to_wait)
+{
+    SPI_BUS_CHECK(NULL != dev_handle, "Pointer error", ESP_ERR_INVALID_ARG);
+    _spi_device_t *spi_dev = (_spi_device_t *)(dev_handle);
+    SPI_DEVICE_MUTEX_TAKE(spi_dev, ESP_FAIL);
+    esp_err_t ret = _spi_device_async_collect(spi_dev, 0, ticks_to_wait);
+    SPI_DEVICE_MUTEX_GIVE(spi_dev, ESP_FAIL);
+    return ret;
+}
+
  /**************************************** Public Functions (Low level)*********************************************/
 
 esp_err_t spi_bus_transmit_begin(spi_bus_device_handle_t dev_handle, spi_transaction_t *p_trans)
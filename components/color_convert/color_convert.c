@@ -0,0 +1,219 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdbool.h>
+#include <string.h>
+#include "color_convert.h"
+
+/* 4x4 Bayer matrix, 0..15 */
+static const uint8_t s_bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+/* Fixed point constants of jdcolor.c, 16 fractional bits */
+#define CC_SCALEBITS    16
+#define CC_ONE_HALF     ((int32_t)1 << (CC_SCALEBITS - 1))
+#define CC_FIX(x)       ((int32_t)((x) * (1L << CC_SCALEBITS) + 0.5))
+
+#define CC_PACK565(r, g, b) ((uint16_t)(((r) & 0xF8) << 8 | ((g) & 0xFC) << 3 | ((b) & 0xFF) >> 3))
+#define CC_SWAP16(c)        ((uint16_t)((c) >> 8 | (c) << 8))
+
+static inline int cc_clamp(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/* Dithered channels step by 8 (5 bits) and 4 (6 bits), the offset is the
+ * Bayer threshold scaled to that step */
+static inline uint16_t cc_pack565_dither(int r, int g, int b, int bayer)
+{
+    int drb = bayer >> 1;
+    int dg = bayer >> 2;
+    r = r + drb > 255 ? 255 : r + drb;
+    g = g + dg > 255 ? 255 : g + dg;
+    b = b + drb > 255 ? 255 : b + drb;
+    return CC_PACK565(r, g, b);
+}
+
+/**************************************** Scalar reference *********************************************/
+
+static inline uint16_t cc_ref_store(int r, int g, int b, size_t i, uint32_t row, uint32_t flags)
+{
+    uint16_t c = (flags & COLOR_CONVERT_DITHER) ? cc_pack565_dither(r, g, b, s_bayer[row & 3][i & 3]) : CC_PACK565(r, g, b);
+    return (flags & COLOR_CONVERT_SWAP) ? CC_SWAP16(c) : c;
+}
+
+void color_convert_rgb888_to_rgb565_ref(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3) {
+        dst[i] = cc_ref_store(src[0], src[1], src[2], i, row, flags);
+    }
+}
+
+void color_convert_ycbcr_to_rgb565_ref(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3) {
+        int y = src[0];
+        int cb = src[1] - 128;
+        int cr = src[2] - 128;
+        int r = y + ((CC_FIX(1.40200) * cr + CC_ONE_HALF) >> CC_SCALEBITS);
+        int g = y + ((-CC_FIX(0.34414) * cb - CC_FIX(0.71414) * cr + CC_ONE_HALF) >> CC_SCALEBITS);
+        int b = y + ((CC_FIX(1.77200) * cb + CC_ONE_HALF) >> CC_SCALEBITS);
+        dst[i] = cc_ref_store(cc_clamp(r), cc_clamp(g), cc_clamp(b), i, row, flags);
+    }
+}
+
+/**************************************** Optimised kernels *********************************************/
+
+/**
+ * Four pixels are three 32-bit loads and two 32-bit stores, instead of twelve
+ * byte loads and four halfword stores. Only used when both buffers are word
+ * aligned, the ESP32-S3 faults on unaligned word access. The byte order of
+ * the words is little endian, like on the ESP32 family and common hosts.
+ */
+static inline void cc_rgb888_words(const uint8_t *src, uint16_t *dst, size_t pixels, bool swap)
+{
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4, src += 12, dst += 4) {
+        uint32_t w0, w1, w2;
+        memcpy(&w0, __builtin_assume_aligned(src, 4), 4);
+        memcpy(&w1, __builtin_assume_aligned(src + 4, 4), 4);
+        memcpy(&w2, __builtin_assume_aligned(src + 8, 4), 4);
+        uint32_t lo = CC_PACK565(w0, w0 >> 8, w0 >> 16) | (uint32_t)CC_PACK565(w0 >> 24, w1, w1 >> 8) << 16;
+        uint32_t hi = CC_PACK565(w1 >> 16, w1 >> 24, w2) | (uint32_t)CC_PACK565(w2 >> 8, w2 >> 16, w2 >> 24) << 16;
+        if (swap) {
+            lo = (lo & 0x00FF00FF) << 8 | (lo >> 8 & 0x00FF00FF);
+            hi = (hi & 0x00FF00FF) << 8 | (hi >> 8 & 0x00FF00FF);
+        }
+        memcpy(__builtin_assume_aligned(dst, 4), &lo, 4);
+        memcpy(__builtin_assume_aligned(dst + 2, 4), &hi, 4);
+    }
+    for (; i < pixels; i++, src += 3) {
+        uint16_t c = CC_PACK565(src[0], src[1], src[2]);
+        *dst++ = swap ? CC_SWAP16(c) : c;
+    }
+}
+
+static inline void cc_rgb888_bytes(const uint8_t *src, uint16_t *dst, size_t pixels, bool swap)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3) {
+        uint16_t c = CC_PACK565(src[0], src[1], src[2]);
+        dst[i] = swap ? CC_SWAP16(c) : c;
+    }
+}
+
+/* The pattern of a row repeats every four pixels, so it is loaded once */
+static inline void cc_rgb888_dither(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, bool swap)
+{
+    const uint8_t *bayer = s_bayer[row & 3];
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4, src += 12) {
+        for (int k = 0; k < 4; k++) {
+            uint16_t c = cc_pack565_dither(src[3 * k], src[3 * k + 1], src[3 * k + 2], bayer[k]);
+            dst[i + k] = swap ? CC_SWAP16(c) : c;
+        }
+    }
+    for (; i < pixels; i++, src += 3) {
+        uint16_t c = cc_pack565_dither(src[0], src[1], src[2], bayer[i & 3]);
+        dst[i] = swap ? CC_SWAP16(c) : c;
+    }
+}
+
+void color_convert_rgb888_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags)
+{
+    bool swap = flags & COLOR_CONVERT_SWAP;
+    /* constant swap arguments let the compiler build one kernel per case */
+    if (flags & COLOR_CONVERT_DITHER) {
+        if (swap) {
+            cc_rgb888_dither(src, dst, pixels, row, true);
+        } else {
+            cc_rgb888_dither(src, dst, pixels, row, false);
+        }
+        return;
+    }
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if ((((uintptr_t)src | (uintptr_t)dst) & 3) == 0) {
+        if (swap) {
+            cc_rgb888_words(src, dst, pixels, true);
+        } else {
+            cc_rgb888_words(src, dst, pixels, false);
+        }
+        return;
+    }
+#endif
+    if (swap) {
+        cc_rgb888_bytes(src, dst, pixels, true);
+    } else {
+        cc_rgb888_bytes(src, dst, pixels, false);
+    }
+}
+
+/**
+ * Chroma terms as tables, like jdcolor.c builds them, so a pixel costs four
+ * lookups instead of four multiplications. Built on first use, concurrent
+ * first calls write the same values.
+ */
+static int16_t s_cr_r[256];
+static int16_t s_cb_b[256];
+static int32_t s_cr_g[256];
+static int32_t s_cb_g[256];
+static bool s_tables_ready = false;
+
+static void cc_build_tables(void)
+{
+    for (int i = 0; i < 256; i++) {
+        int x = i - 128;
+        s_cr_r[i] = (CC_FIX(1.40200) * x + CC_ONE_HALF) >> CC_SCALEBITS;
+        s_cb_b[i] = (CC_FIX(1.77200) * x + CC_ONE_HALF) >> CC_SCALEBITS;
+        s_cr_g[i] = -CC_FIX(0.71414) * x;
+        s_cb_g[i] = -CC_FIX(0.34414) * x + CC_ONE_HALF;
+    }
+    __atomic_store_n(&s_tables_ready, true, __ATOMIC_RELEASE);
+}
+
+static inline void cc_ycbcr(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, bool swap, bool dither)
+{
+    const uint8_t *bayer = s_bayer[row & 3];
+    for (size_t i = 0; i < pixels; i++, src += 3) {
+        int y = src[0];
+        int r = cc_clamp(y + s_cr_r[src[2]]);
+        int g = cc_clamp(y + ((s_cb_g[src[1]] + s_cr_g[src[2]]) >> CC_SCALEBITS));
+        int b = cc_clamp(y + s_cb_b[src[1]]);
+        uint16_t c = dither ? cc_pack565_dither(r, g, b, bayer[i & 3]) : CC_PACK565(r, g, b);
+        dst[i] = swap ? CC_SWAP16(c) : c;
+    }
+}
+
+void color_convert_ycbcr_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags)
+{
+    if (!__atomic_load_n(&s_tables_ready, __ATOMIC_ACQUIRE)) {
+        cc_build_tables();
+    }
+    switch (flags & (COLOR_CONVERT_SWAP | COLOR_CONVERT_DITHER)) {
+    case 0:
+        cc_ycbcr(src, dst, pixels, row, false, false);
+        break;
+    case COLOR_CONVERT_SWAP:
+        cc_ycbcr(src, dst, pixels, row, true, false);
+        break;
+    case COLOR_CONVERT_DITHER:
+        cc_ycbcr(src, dst, pixels, row, false, true);
+        break;
+    default:
+        cc_ycbcr(src, dst, pixels, row, true, true);
+        break;
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _COLOR_CONVERT_H_
+#define _COLOR_CONVERT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Conversion of decoded scanlines to RGB565 for the LCD.
+ *
+ * Every function converts one row of pixels. The row number is only used
+ * to select the dither pattern. Each conversion has a scalar reference
+ * (the _ref functions, one pixel at a time) and an optimised version which
+ * picks a kernel specialised for the flags and converts four pixels per
+ * step. Both produce identical output, which is what the tests check.
+ */
+
+#define COLOR_CONVERT_SWAP      (1 << 0)    /*!< Store each pixel high byte first, the order the LCD bus sends */
+#define COLOR_CONVERT_DITHER    (1 << 1)    /*!< 4x4 ordered dither instead of truncating to 5/6/5 bits */
+
+/**
+ * @brief Convert packed RGB888 (R, G, B bytes) to RGB565
+ *
+ * @param src RGB888 pixels, 3 bytes each
+ * @param dst RGB565 pixels
+ * @param pixels number of pixels
+ * @param row row of the image, selects the dither pattern
+ * @param flags COLOR_CONVERT_SWAP and/or COLOR_CONVERT_DITHER
+ */
+void color_convert_rgb888_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+/**
+ * @brief Convert interleaved JFIF YCbCr (Y, Cb, Cr bytes) to RGB565
+ *
+ * The arithmetic is the one of the IJG decoder (jdcolor.c), so the result is
+ * the same as decoding to RGB888 and calling color_convert_rgb888_to_rgb565.
+ *
+ * @param src YCbCr pixels, 3 bytes each
+ * @param dst RGB565 pixels
+ * @param pixels number of pixels
+ * @param row row of the image, selects the dither pattern
+ * @param flags COLOR_CONVERT_SWAP and/or COLOR_CONVERT_DITHER
+ */
+void color_convert_ycbcr_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+/**
+ * @brief Scalar reference of color_convert_rgb888_to_rgb565
+ */
+void color_convert_rgb888_to_rgb565_ref(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+/**
+ * @brief Scalar reference of color_convert_ycbcr_to_rgb565
+ */
+void color_convert_ycbcr_to_rgb565_ref(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
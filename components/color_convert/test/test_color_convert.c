@@ -0,0 +1,103 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "test_utils.h"
+#include "esp_timer.h"
+#include "color_convert.h"
+
+#define TEST_PIXELS 243
+
+typedef void (*convert_fn_t)(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+/* word aligned, offsets into them test the unaligned paths */
+static uint32_t s_src[(TEST_PIXELS * 3 + 8) / 4];
+static uint32_t s_ref[TEST_PIXELS / 2 + 2];
+static uint32_t s_out[TEST_PIXELS / 2 + 2];
+
+TEST_CASE("color convert known colors", "[color_convert]")
+{
+    const uint8_t rgb[] = {255, 255, 255, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0};
+    uint16_t out[5];
+    color_convert_rgb888_to_rgb565(rgb, out, 5, 0, 0);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, out[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, out[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, out[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x001F, out[3]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, out[4]);
+    color_convert_rgb888_to_rgb565(rgb, out, 5, 0, COLOR_CONVERT_SWAP);
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, out[1]);
+
+    /* white stays white and black is lifted by at most one step */
+    color_convert_rgb888_to_rgb565(rgb, out, 5, 3, COLOR_CONVERT_DITHER);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, out[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, out[4]);
+
+    /* Y=128 without chroma is mid grey */
+    const uint8_t ycc[] = {128, 128, 128};
+    color_convert_ycbcr_to_rgb565(ycc, out, 1, 0, 0);
+    TEST_ASSERT_EQUAL_HEX16(0x8410, out[0]);
+}
+
+static void check_bit_exact(convert_fn_t fast, convert_fn_t ref)
+{
+    uint8_t *src = (uint8_t *)s_src;
+    uint32_t seed = 1;
+    for (int i = 0; i < sizeof(s_src); i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = seed >> 16;
+    }
+    for (int flags = 0; flags <= (COLOR_CONVERT_SWAP | COLOR_CONVERT_DITHER); flags++) {
+        for (int offset = 0; offset < 4; offset++) {
+            for (size_t n = 0; n < 38; n++) {
+                for (uint32_t row = 0; row < 4; row++) {
+                    memset(s_ref, 0x55, sizeof(s_ref));
+                    memset(s_out, 0x55, sizeof(s_out));
+                    uint16_t *ref_px = (uint16_t *)s_ref + (offset & 1);
+                    uint16_t *out_px = (uint16_t *)s_out + (offset & 1);
+                    ref(src + offset, ref_px, n, row, flags);
+                    fast(src + offset, out_px, n, row, flags);
+                    /* includes the guard pixels behind the row */
+                    TEST_ASSERT_EQUAL_MEMORY(s_ref, s_out, sizeof(s_out));
+                }
+            }
+        }
+        ref(src, (uint16_t *)s_ref, TEST_PIXELS, 0, flags);
+        fast(src, (uint16_t *)s_out, TEST_PIXELS, 0, flags);
+        TEST_ASSERT_EQUAL_MEMORY(s_ref, s_out, TEST_PIXELS * 2);
+    }
+}
+
+TEST_CASE("color convert rgb888 matches reference", "[color_convert]")
+{
+    check_bit_exact(color_convert_rgb888_to_rgb565, color_convert_rgb888_to_rgb565_ref);
+}
+
+TEST_CASE("color convert ycbcr matches reference", "[color_convert]")
+{
+    check_bit_exact(color_convert_ycbcr_to_rgb565, color_convert_ycbcr_to_rgb565_ref);
+}
+
+TEST_CASE("color convert rgb888 speed", "[color_convert]")
+{
+    convert_fn_t fn[2] = {color_convert_rgb888_to_rgb565_ref, color_convert_rgb888_to_rgb565};
+    for (int i = 0; i < 2; i++) {
+        int64_t start = esp_timer_get_time();
+        for (int row = 0; row < 240; row++) {
+            fn[i]((uint8_t *)s_src, (uint16_t *)s_out, 240, row, COLOR_CONVERT_SWAP);
+        }
+        printf("%s: 240x240 in %lld us\n", i ? "fast" : "ref", esp_timer_get_time() - start);
+    }
+}
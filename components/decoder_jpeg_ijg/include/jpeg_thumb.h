@@ -0,0 +1,37 @@
+#ifndef __JPEG_THUMB_H
+#define __JPEG_THUMB_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create a small JPEG preview of a JPEG file
+ *
+ * The source is decoded with IJG DCT-domain scaling (1/2, 1/4 or 1/8), so
+ * most of the IDCT work is skipped, then resampled to fit `max_side` and
+ * re-encoded. On failure `dst_path` is removed.
+ *
+ * @param src_path JPEG file to read
+ * @param dst_path file to write the thumbnail to
+ * @param max_side longest side of the thumbnail in pixels
+ * @param quality JPEG quality of the thumbnail (1-100)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG Arguments is invalid
+ *      - ESP_ERR_NOT_FOUND Source file could not be opened
+ *      - ESP_ERR_NOT_SUPPORTED Source is corrupt or not a JPEG the decoder supports
+ *      - ESP_ERR_NO_MEM Out of memory
+ *      - ESP_FAIL Thumbnail could not be written
+ */
+esp_err_t jpeg_thumb_create(const char *src_path, const char *dst_path, uint16_t max_side, int quality);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
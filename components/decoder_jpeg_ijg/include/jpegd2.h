@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include "cdjpeg.h" 
 #include <setjmp.h>
+#include "esp_err.h"
 
 #ifdef __cplusplus 
 extern "C" {
@@ -17,6 +18,154 @@ void mjpegdraw(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
                 const size_t outbuffer_width, const size_t outbuffer_height,
                 lcd_write_cb lcd_cb, const size_t lcd_width, const size_t lcd_height);
 
+/**
+ * Same as mjpegdraw, but lcd_cb may return before the strip is sent.
+ * wait_cb blocks until it is. The output buffer is split into two strips
+ * of outbuffer_height / 2 lines so decoding continues during the transfer.
+ * The buffer is free again when the function returns.
+ * With swap_output the RGB565 pixels are stored high byte first, for a
+ * callback that sends them without swapping (board_lcd_draw_image_wire_async).
+ */
+typedef bool (*lcd_wait_cb)(void);
+void mjpegdraw_async(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
+                const size_t outbuffer_width, const size_t outbuffer_height,
+                lcd_write_cb lcd_cb, lcd_wait_cb wait_cb, bool swap_output,
+                const size_t lcd_width, const size_t lcd_height);
+
+/**
+ * Decoder context, see jpegd2_ctx_create().
+ *
+ * It holds the IJG decompressor, the input source, the error return point
+ * and the strip being filled. mjpegdraw() creates one per call. Code that
+ * decodes many images, like a camera stream, keeps its own so the decoder
+ * is set up once. Tasks that decode at the same time each need their own
+ * context, one context decodes one image at a time.
+ */
+typedef struct jpegd2_ctx jpegd2_ctx_t;
+
+/**
+ * How the image is fitted to lcd_width x lcd_height
+ *
+ * With a fit mode the decoder first scales by 1/8 to 8/8 in the IDCT, to
+ * the smallest size that is not below the target, so a large photo is
+ * never decoded at full size. The rest is resampled to the exact size.
+ */
+typedef enum {
+    JPEGD2_FIT_NONE = 0,            /*!< Drawn at its size from the top left, clipped */
+    JPEGD2_FIT_CONTAIN,             /*!< Whole image as large as fits, centred, the area around it is not drawn */
+    JPEGD2_FIT_COVER,               /*!< Fills the area, centred, the overhang is cropped */
+} jpegd2_fit_t;
+
+typedef enum {
+    JPEGD2_RESAMPLE_NEAREST = 0,    /*!< Fastest, blocky when enlarging */
+    JPEGD2_RESAMPLE_BILINEAR,       /*!< Smoother, about twice the time of nearest */
+} jpegd2_resample_t;
+
+/**
+ * Where and how jpegd2_draw() writes the image, the arguments of mjpegdraw_async()
+ */
+typedef struct {
+    uint8_t *outbuffer;             /*!< Strip buffer, RGB565, 2-byte aligned */
+    size_t outbuffer_width;         /*!< Pixels per row of the strip buffer */
+    size_t outbuffer_height;        /*!< Rows of the strip buffer, two strips of half of it with wait_cb */
+    lcd_write_cb lcd_cb;            /*!< Gets each strip, rows packed at the width passed to it */
+    lcd_wait_cb wait_cb;            /*!< NULL if lcd_cb is done with the strip when it returns */
+    bool swap_output;               /*!< Store pixels high byte first */
+    bool dither_output;             /*!< 4x4 ordered dither instead of truncating to 5/6/5 bits */
+    size_t lcd_width;               /*!< The image is clipped, or fitted, to this size */
+    size_t lcd_height;
+    jpegd2_fit_t fit;               /*!< JPEGD2_FIT_NONE clips */
+    jpegd2_resample_t resample;     /*!< Used with a fit mode */
+    uint8_t scale;                  /*!< JPEGD2_FIT_NONE: zoom of 1/8 to 16/8 in eighths, 0 is 8 (full size) */
+    size_t crop_x;                  /*!< JPEGD2_FIT_NONE: left edge of the part drawn, in pixels of the zoomed image */
+    size_t crop_y;                  /*!< JPEGD2_FIT_NONE: top edge of the part drawn */
+} jpegd2_output_t;
+
+/**
+ * @brief Create a decoder context
+ *
+ * @return The context, NULL without memory
+ */
+jpegd2_ctx_t *jpegd2_ctx_create(void);
+
+/**
+ * @brief Delete a decoder context, NULL is ignored
+ */
+void jpegd2_ctx_delete(jpegd2_ctx_t *ctx);
+
+/**
+ * @brief Decode the next image from memory
+ *
+ * The data is only read, it must stay valid until jpegd2_draw() returns.
+ */
+void jpegd2_set_source_mem(jpegd2_ctx_t *ctx, const uint8_t *data, size_t size);
+
+/**
+ * @brief Read callback of a stream source
+ *
+ * @return Bytes read into buf, at most len, 0 at the end of the stream, negative on errors
+ */
+typedef int (*jpegd2_read_cb_t)(void *arg, uint8_t *buf, size_t len);
+
+/**
+ * @brief Skip callback of a stream source, moves len bytes forward
+ *
+ * @return 0 on success, anything else makes the decoder read and drop the data
+ */
+typedef int (*jpegd2_skip_cb_t)(void *arg, size_t len);
+
+/**
+ * @brief Decode the next image from a stream
+ *
+ * The stream is read CONFIG_JPEGD2_INPUT_BUFFER_SIZE bytes at a time, the
+ * image can be of any size. A premature end of the stream ends the image
+ * like a truncated file.
+ *
+ * @param read_cb Reads the stream
+ * @param skip_cb Seeks forward over data the decoder does not need, may be NULL
+ * @param arg Passed to the callbacks
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG ctx or read_cb is NULL
+ *      - ESP_ERR_NO_MEM No memory for the input buffer
+ */
+esp_err_t jpegd2_set_source_cb(jpegd2_ctx_t *ctx, jpegd2_read_cb_t read_cb, jpegd2_skip_cb_t skip_cb, void *arg);
+
+/**
+ * @brief Decode the next image from a file, starting at its current position
+ *
+ * The file must stay open until jpegd2_draw() returns. Skipped data is passed with fseek().
+ *
+ * @return Same as jpegd2_set_source_cb()
+ */
+esp_err_t jpegd2_set_source_file(jpegd2_ctx_t *ctx, FILE *file);
+
+/**
+ * @brief Decode the next image from a file descriptor, like jpegd2_set_source_file()
+ *
+ * @return Same as jpegd2_set_source_cb()
+ */
+esp_err_t jpegd2_set_source_fd(jpegd2_ctx_t *ctx, int fd);
+
+/**
+ * @brief Decode the image of the source and pass it to the output strip by strip
+ *
+ * Only the part that is drawn is decoded in full. Rows above it are entropy
+ * decoded and dropped a whole MCU row at a time, rows below it are not read.
+ * Columns beside it are entropy decoded but not transformed, so panning over
+ * a large image with crop_x/crop_y costs a fraction of a full decode.
+ * Without a fit mode the decoder writes RGB565 itself, rows as wide as the
+ * strip straight into it. The dither pattern follows the image, not the crop.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG Context or output invalid, or the crop is outside of the image
+ *      - ESP_ERR_NOT_SUPPORTED A fit mode or a crop with CONFIG_COLOR_SPACE_RGB_888
+ *      - ESP_FAIL The image could not be decoded, the context can decode the next one
+ */
+esp_err_t jpegd2_draw(jpegd2_ctx_t *ctx, const jpegd2_output_t *out);
+
 #ifdef __cplusplus 
 }
 #endif
@@ -0,0 +1,46 @@
+/*
+ * jd565.h
+ *
+ * Local extension, not part of the IJG distribution.
+ *
+ * This include file contains common declarations for the direct RGB565
+ * output (out_color_space = JCS_RGB565) of the color deconverter (jdcolor.c)
+ * and the merged upsampler (jdmerge.c).  The pixels are the same as those of
+ * JCS_RGB output packed by color_convert_rgb888_to_rgb565() of the firmware,
+ * with the same dither pattern for the same image row and column.
+ * Only 8-bit samples are supported.
+ */
+
+
+/* Short forms of external names for systems with brain-damaged linkers. */
+
+#ifdef NEED_SHORT_EXTERNAL_NAMES
+#define jpeg_rgb565_dither	jRGB565Dither
+#endif /* NEED_SHORT_EXTERNAL_NAMES */
+
+
+/* 4x4 Bayer matrix with thresholds 0..15, indexed [row & 3][column & 3] */
+
+extern const UINT8 jpeg_rgb565_dither[4][4];
+
+
+/* Truncate 8-bit R, G, B to one 5-6-5 word. */
+
+#define PACK_RGB565(r,g,b)  \
+    ((unsigned int) (((r) & 0xF8) << 8 | ((g) & 0xFC) << 3 | (b) >> 3))
+
+/* Dithered packing: the threshold d is scaled to the step of each channel,
+ * 8 for red and blue and 4 for green, and the sums are saturated at
+ * MAXJSAMPLE with the range limit table (which covers up to 2*MAXJSAMPLE+1).
+ * r, g and b must already be range limited.
+ */
+
+#define DITHER_RGB565(range_limit,r,g,b,d)  \
+    PACK_RGB565((range_limit)[(r) + ((d) >> 1)], \
+		(range_limit)[(g) + ((d) >> 2)], \
+		(range_limit)[(b) + ((d) >> 1)])
+
+/* Store one word at outptr (2-byte aligned), high byte first with swap. */
+
+#define STORE_RGB565(outptr,c,swap)  \
+    (*(UINT16 *) (outptr) = (UINT16) ((swap) ? ((c) >> 8 | (c) << 8) : (c)))
@@ -211,6 +211,13 @@ default_decompress_parms (j_decompress_ptr cinfo)
   cinfo->enable_1pass_quant = FALSE;
   cinfo->enable_external_quant = FALSE;
   cinfo->enable_2pass_quant = FALSE;
+  /* No region, every column is transformed. */
+  cinfo->first_idct_col = 0;
+  cinfo->last_idct_col = JPEG_MAX_DIMENSION;
+  cinfo->skip_idct = FALSE;
+  /* Plain truncation in machine byte order for JCS_RGB565. */
+  cinfo->rgb565_swap = FALSE;
+  cinfo->rgb565_dither = FALSE;
 }
 
 
@@ -217,6 +217,75 @@ jpeg_read_raw_data (j_decompress_ptr cinfo, JSAMPIMAGE data,
 }
 
 
+/*
+ * Region decoding, a local extension: transform only the iMCU columns
+ * that cover output columns xoffset..xoffset+width-1.  The other columns of
+ * the output rows are undefined.  width 0 selects all columns again.
+ * May be called between any two rows after jpeg_start_decompress.
+ */
+
+GLOBAL(void)
+jpeg_set_idct_columns (j_decompress_ptr cinfo, JDIMENSION xoffset,
+		       JDIMENSION width)
+{
+  JDIMENSION iMCU_width;
+
+  if (cinfo->global_state < DSTATE_SCANNING ||
+      cinfo->global_state > DSTATE_BUFIMAGE)
+    ERREXIT1(cinfo, JERR_BAD_STATE, cinfo->global_state);
+  if (xoffset + width > cinfo->output_width)
+    ERREXIT(cinfo, JERR_BAD_CROP_SPEC);
+
+  if (width == 0) {
+    cinfo->first_idct_col = 0;
+    cinfo->last_idct_col = JPEG_MAX_DIMENSION;
+    return;
+  }
+  iMCU_width = cinfo->max_h_samp_factor * cinfo->min_DCT_h_scaled_size;
+  cinfo->first_idct_col = xoffset / iMCU_width;
+  cinfo->last_idct_col = (xoffset + width - 1) / iMCU_width;
+}
+
+
+/*
+ * Region decoding, a local extension: skip output scanlines a whole iMCU
+ * row at a time.  The rows are still entropy decoded, but they are not
+ * transformed, upsampled or color converted.  Rows are only skipped from
+ * an iMCU row boundary on and never in the last iMCU row, so fewer than
+ * max_lines may be skipped; read the rest with jpeg_read_scanlines.
+ * Returns 0 with context rows (fancy upsampling of vertically subsampled
+ * data) or color quantization.
+ */
+
+GLOBAL(JDIMENSION)
+jpeg_skip_imcu_rows (j_decompress_ptr cinfo, JDIMENSION max_lines)
+{
+  JDIMENSION lines_per_iMCU_row, skipped;
+
+  if (cinfo->global_state != DSTATE_SCANNING)
+    ERREXIT1(cinfo, JERR_BAD_STATE, cinfo->global_state);
+  if (cinfo->upsample->need_context_rows || cinfo->quantize_colors)
+    return 0;
+  lines_per_iMCU_row = cinfo->max_v_samp_factor * cinfo->min_DCT_v_scaled_size;
+  if (cinfo->output_scanline % lines_per_iMCU_row != 0)
+    return 0;
+
+  /* At the boundary the main and upsampling buffers are empty. */
+  cinfo->skip_idct = TRUE;
+  for (skipped = 0; max_lines - skipped >= lines_per_iMCU_row &&
+       cinfo->output_scanline + lines_per_iMCU_row < cinfo->output_height;
+       skipped += lines_per_iMCU_row) {
+    /* The output buffer is not touched while skip_idct is set. */
+    if (! (*cinfo->coef->decompress_data) (cinfo, (JSAMPIMAGE) NULL))
+      break;			/* suspension forced */
+    cinfo->output_scanline += lines_per_iMCU_row;
+  }
+  cinfo->skip_idct = FALSE;
+  (*cinfo->upsample->skip_rows) (cinfo, skipped);
+  return skipped;
+}
+
+
 /* Additional entry points for buffered-image mode. */
 
 #ifdef D_MULTISCAN_FILES_SUPPORTED
@@ -24,6 +24,11 @@
 #undef BLOCK_SMOOTHING_SUPPORTED
 #endif
 
+/* Region decoding (local extension): is the IDCT of iMCU column col wanted? */
+#define IDCT_WANTED(cinfo, col) \
+  (! (cinfo)->skip_idct && \
+   (col) >= (cinfo)->first_idct_col && (col) <= (cinfo)->last_idct_col)
+
 /* Private buffer controller object */
 
 typedef struct {
@@ -185,6 +190,14 @@ decompress_onepass (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
 	  blkn += compptr->MCU_blocks;
 	  continue;
 	}
+	/* Nor one outside of the region.  An MCU of a noninterleaved
+	 * scan is one block, h_samp_factor of them make an iMCU column.
+	 */
+	if (! IDCT_WANTED(cinfo, cinfo->comps_in_scan > 1 ? MCU_col_num :
+			  MCU_col_num / compptr->h_samp_factor)) {
+	  blkn += compptr->MCU_blocks;
+	  continue;
+	}
 	inverse_DCT = cinfo->idct->inverse_DCT[compptr->component_index];
 	useful_width = (MCU_col_num < last_MCU_col) ? compptr->MCU_width
 						    : compptr->last_col_width;
@@ -318,7 +331,7 @@ decompress_data (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
 {
   my_coef_ptr coef = (my_coef_ptr) cinfo->coef;
   JDIMENSION last_iMCU_row = cinfo->total_iMCU_rows - 1;
-  JDIMENSION block_num;
+  JDIMENSION block_num, first_block, end_block;
   int ci, block_row, block_rows;
   JBLOCKARRAY buffer;
   JBLOCKROW buffer_ptr;
@@ -338,14 +351,19 @@ decompress_data (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
   /* OK, output from the virtual arrays. */
   for (ci = 0, compptr = cinfo->comp_info; ci < cinfo->num_components;
        ci++, compptr++) {
-    /* Don't bother to IDCT an uninteresting component. */
-    if (! compptr->component_needed)
+    /* Don't bother to IDCT an uninteresting component, or a skipped row. */
+    if (! compptr->component_needed || cinfo->skip_idct)
       continue;
     /* Align the virtual buffer for this component. */
     buffer = (*cinfo->mem->access_virt_barray)
       ((j_common_ptr) cinfo, coef->whole_image[ci],
        cinfo->output_iMCU_row * compptr->v_samp_factor,
        (JDIMENSION) compptr->v_samp_factor, FALSE);
+    /* Blocks of the iMCU columns in the region. */
+    first_block = cinfo->first_idct_col * compptr->h_samp_factor;
+    end_block = compptr->width_in_blocks;
+    if (cinfo->last_idct_col < end_block / compptr->h_samp_factor)
+      end_block = (cinfo->last_idct_col + 1) * compptr->h_samp_factor;
     /* Count non-dummy DCT block rows in this iMCU row. */
     if (cinfo->output_iMCU_row < last_iMCU_row)
       block_rows = compptr->v_samp_factor;
@@ -358,9 +376,9 @@ decompress_data (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
     output_ptr = output_buf[ci];
     /* Loop over all DCT blocks to be processed. */
     for (block_row = 0; block_row < block_rows; block_row++) {
-      buffer_ptr = buffer[block_row];
-      output_col = 0;
-      for (block_num = 0; block_num < compptr->width_in_blocks; block_num++) {
+      buffer_ptr = buffer[block_row] + first_block;
+      output_col = first_block * compptr->DCT_h_scaled_size;
+      for (block_num = first_block; block_num < end_block; block_num++) {
 	(*inverse_DCT) (cinfo, compptr, (JCOEFPTR) buffer_ptr,
 			output_ptr, output_col);
 	buffer_ptr++;
@@ -500,8 +518,8 @@ decompress_smooth_data (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
   /* OK, output from the virtual arrays. */
   for (ci = 0, compptr = cinfo->comp_info; ci < cinfo->num_components;
        ci++, compptr++) {
-    /* Don't bother to IDCT an uninteresting component. */
-    if (! compptr->component_needed)
+    /* Don't bother to IDCT an uninteresting component, or a skipped row. */
+    if (! compptr->component_needed || cinfo->skip_idct)
       continue;
     /* Count non-dummy DCT block rows in this iMCU row. */
     if (cinfo->output_iMCU_row < last_iMCU_row) {
@@ -648,9 +666,10 @@ decompress_smooth_data (j_decompress_ptr cinfo, JSAMPIMAGE output_buf)
 	  }
 	  workspace[2] = (JCOEF) pred;
 	}
-	/* OK, do the IDCT */
-	(*inverse_DCT) (cinfo, compptr, (JCOEFPTR) workspace,
-			output_ptr, output_col);
+	/* OK, do the IDCT, in the region only */
+	if (IDCT_WANTED(cinfo, block_num / compptr->h_samp_factor))
+	  (*inverse_DCT) (cinfo, compptr, (JCOEFPTR) workspace,
+			  output_ptr, output_col);
 	/* Advance for next column */
 	DC1 = DC2; DC2 = DC3;
 	DC4 = DC5; DC5 = DC6;
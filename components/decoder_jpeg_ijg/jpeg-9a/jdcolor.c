@@ -12,6 +12,7 @@
 #define JPEG_INTERNALS
 #include "jinclude.h"
 #include "jpeglib.h"
+#include "jd565.h"
 
 
 /* Private subobject */
@@ -30,6 +31,9 @@ typedef struct {
 
   /* Private state for RGB->Y conversion */
   INT32 * rgb_y_tab;		/* => table for RGB to Y conversion */
+
+  /* Private state for RGB565 output */
+  JDIMENSION output_row;	/* next output row, selects the dither row */
 } my_color_deconverter;
 
 typedef my_color_deconverter * my_cconvert_ptr;
@@ -573,14 +577,206 @@ ycck_cmyk_convert (j_decompress_ptr cinfo,
 }
 
 
+/**************** Direct RGB565 output: local extension ****************/
+
+/*
+ * The conversions above, packed to one 16-bit word per pixel as described
+ * in jd565.h.  The dithered YCbCr variant is separate so that the common
+ * case doesn't pay for it; the others use a zero pattern when not dithering.
+ */
+
+const UINT8 jpeg_rgb565_dither[4][4] = {
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 }
+};
+
+static const UINT8 no_dither[4] = { 0, 0, 0, 0 };
+
+
+METHODDEF(void)
+ycc_rgb565_convert (j_decompress_ptr cinfo,
+		    JSAMPIMAGE input_buf, JDIMENSION input_row,
+		    JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register int y, cb, cr;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  boolean swap = cinfo->rgb565_swap;
+  unsigned int c;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cconvert->range_limit;
+  register int * Crrtab = cconvert->Cr_r_tab;
+  register int * Cbbtab = cconvert->Cb_b_tab;
+  register INT32 * Crgtab = cconvert->Cr_g_tab;
+  register INT32 * Cbgtab = cconvert->Cb_g_tab;
+  SHIFT_TEMPS
+
+  cconvert->output_row += num_rows;
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      c = PACK_RGB565(range_limit[y + Crrtab[cr]],
+		      range_limit[y + ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+							 SCALEBITS))],
+		      range_limit[y + Cbbtab[cb]]);
+      STORE_RGB565(outptr, c, swap);
+      outptr += 2;
+    }
+  }
+}
+
+
+METHODDEF(void)
+ycc_rgb565D_convert (j_decompress_ptr cinfo,
+		     JSAMPIMAGE input_buf, JDIMENSION input_row,
+		     JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register int y, cb, cr;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  boolean swap = cinfo->rgb565_swap;
+  const UINT8 * dither;
+  unsigned int c;
+  int d;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cconvert->range_limit;
+  register int * Crrtab = cconvert->Cr_r_tab;
+  register int * Cbbtab = cconvert->Cb_b_tab;
+  register INT32 * Crgtab = cconvert->Cr_g_tab;
+  register INT32 * Cbgtab = cconvert->Cb_g_tab;
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    dither = jpeg_rgb565_dither[cconvert->output_row++ & 3];
+    for (col = 0; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      d = dither[col & 3];
+      c = DITHER_RGB565(range_limit, range_limit[y + Crrtab[cr]],
+			range_limit[y +
+			  ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+					     SCALEBITS))],
+			range_limit[y + Cbbtab[cb]], d);
+      STORE_RGB565(outptr, c, swap);
+      outptr += 2;
+    }
+  }
+}
+
+
+METHODDEF(void)
+rgb_rgb565_convert (j_decompress_ptr cinfo,
+		    JSAMPIMAGE input_buf, JDIMENSION input_row,
+		    JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  boolean swap = cinfo->rgb565_swap;
+  const UINT8 * dither;
+  unsigned int c;
+  int d;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    dither = cinfo->rgb565_dither ?
+	     jpeg_rgb565_dither[cconvert->output_row & 3] : no_dither;
+    cconvert->output_row++;
+    for (col = 0; col < num_cols; col++) {
+      d = dither[col & 3];
+      c = DITHER_RGB565(range_limit, GETJSAMPLE(inptr0[col]),
+			GETJSAMPLE(inptr1[col]), GETJSAMPLE(inptr2[col]), d);
+      STORE_RGB565(outptr, c, swap);
+      outptr += 2;
+    }
+  }
+}
+
+
+METHODDEF(void)
+gray_rgb565_convert (j_decompress_ptr cinfo,
+		     JSAMPIMAGE input_buf, JDIMENSION input_row,
+		     JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  boolean swap = cinfo->rgb565_swap;
+  const UINT8 * dither;
+  unsigned int c;
+  int g, d;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+
+  while (--num_rows >= 0) {
+    inptr = input_buf[0][input_row++];
+    outptr = *output_buf++;
+    dither = cinfo->rgb565_dither ?
+	     jpeg_rgb565_dither[cconvert->output_row & 3] : no_dither;
+    cconvert->output_row++;
+    for (col = 0; col < num_cols; col++) {
+      g = GETJSAMPLE(inptr[col]);
+      d = dither[col & 3];
+      c = DITHER_RGB565(range_limit, g, g, g, d);
+      STORE_RGB565(outptr, c, swap);
+      outptr += 2;
+    }
+  }
+}
+
+
 /*
- * Empty method for start_pass.
+ * Initialize for an output pass.
  */
 
 METHODDEF(void)
 start_pass_dcolor (j_decompress_ptr cinfo)
 {
-  /* no work needed */
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+
+  cconvert->output_row = 0;
+}
+
+
+/*
+ * Skip rows; only the RGB565 dither needs to know.
+ */
+
+METHODDEF(void)
+skip_rows_dcolor (j_decompress_ptr cinfo, JDIMENSION num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+
+  cconvert->output_row += num_rows;
 }
 
 
@@ -599,6 +795,7 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
 				SIZEOF(my_color_deconverter));
   cinfo->cconvert = &cconvert->pub;
   cconvert->pub.start_pass = start_pass_dcolor;
+  cconvert->pub.skip_rows = skip_rows_dcolor;
 
   /* Make sure num_components agrees with jpeg_color_space */
   switch (cinfo->jpeg_color_space) {
@@ -716,6 +913,32 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
       ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
     break;
 
+  case JCS_RGB565:
+    cinfo->out_color_components = 2;
+    switch (cinfo->jpeg_color_space) {
+    case JCS_GRAYSCALE:
+      cconvert->pub.color_convert = gray_rgb565_convert;
+      break;
+    case JCS_YCbCr:
+      cconvert->pub.color_convert = cinfo->rgb565_dither ?
+				    ycc_rgb565D_convert : ycc_rgb565_convert;
+      build_ycc_rgb_table(cinfo);
+      break;
+    case JCS_BG_YCC:
+      cconvert->pub.color_convert = cinfo->rgb565_dither ?
+				    ycc_rgb565D_convert : ycc_rgb565_convert;
+      build_bg_ycc_rgb_table(cinfo);
+      break;
+    case JCS_RGB:
+      if (cinfo->color_transform != JCT_NONE)
+	ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
+      cconvert->pub.color_convert = rgb_rgb565_convert;
+      break;
+    default:
+      ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
+    }
+    break;
+
   case JCS_CMYK:
     cinfo->out_color_components = 4;
     switch (cinfo->jpeg_color_space) {
@@ -48,10 +48,11 @@ use_merged_upsample (j_decompress_ptr cinfo)
   /* Merging is the equivalent of plain box-filter upsampling */
   if (cinfo->do_fancy_upsampling || cinfo->CCIR601_sampling)
     return FALSE;
-  /* jdmerge.c only supports YCC=>RGB color conversion */
+  /* jdmerge.c only supports YCC=>RGB and YCC=>RGB565 color conversion */
   if (cinfo->jpeg_color_space != JCS_YCbCr || cinfo->num_components != 3 ||
-      cinfo->out_color_space != JCS_RGB ||
-      cinfo->out_color_components != RGB_PIXELSIZE ||
+      ((cinfo->out_color_space != JCS_RGB ||
+	cinfo->out_color_components != RGB_PIXELSIZE) &&
+       cinfo->out_color_space != JCS_RGB565) ||
       cinfo->color_transform)
     return FALSE;
   /* and it only handles 2h1v or 2h2v sampling ratios */
@@ -170,6 +171,9 @@ jpeg_calc_output_dimensions (j_decompress_ptr cinfo)
   case JCS_YCCK:
     cinfo->out_color_components = 4;
     break;
+  case JCS_RGB565:		/* one 16-bit word */
+    cinfo->out_color_components = 2;
+    break;
   default:			/* else must be same colorspace as in file */
     cinfo->out_color_components = cinfo->num_components;
     break;
@@ -309,7 +313,7 @@ master_selection (j_decompress_ptr cinfo)
     cinfo->enable_2pass_quant = FALSE;
   }
   if (cinfo->quantize_colors) {
-    if (cinfo->raw_data_out)
+    if (cinfo->raw_data_out || cinfo->out_color_space == JCS_RGB565)
       ERREXIT(cinfo, JERR_NOTIMPL);
     /* 2-pass quantizer only works in 3-component color space. */
     if (cinfo->out_color_components != 3) {
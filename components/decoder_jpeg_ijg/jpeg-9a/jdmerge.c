@@ -36,6 +36,7 @@
 #define JPEG_INTERNALS
 #include "jinclude.h"
 #include "jpeglib.h"
+#include "jd565.h"
 
 #ifdef UPSAMPLE_MERGING_SUPPORTED
 
@@ -66,6 +67,7 @@ typedef struct {
 
   JDIMENSION out_row_width;	/* samples per output row */
   JDIMENSION rows_to_go;	/* counts rows remaining in image */
+  JDIMENSION output_row;	/* first row of the next row group, RGB565 dither */
 } my_upsampler;
 
 typedef my_upsampler * my_upsample_ptr;
@@ -132,6 +134,22 @@ start_pass_merged_upsample (j_decompress_ptr cinfo)
   upsample->spare_full = FALSE;
   /* Initialize total-height counter for detecting bottom of image */
   upsample->rows_to_go = cinfo->output_height;
+  upsample->output_row = 0;
+}
+
+
+/*
+ * Skip rows, the spare row is empty at the iMCU row boundaries where
+ * jpeg_skip_imcu_rows is allowed.
+ */
+
+METHODDEF(void)
+skip_rows_merged_upsample (j_decompress_ptr cinfo, JDIMENSION num_rows)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+
+  upsample->rows_to_go -= num_rows;
+  upsample->output_row += num_rows;
 }
 
 
@@ -359,6 +377,296 @@ h2v2_merged_upsample (j_decompress_ptr cinfo,
 }
 
 
+/*
+ * The same for direct RGB565 output (local extension, see jd565.h),
+ * without and with dither.
+ */
+
+METHODDEF(void)
+h2v1_merged_upsample_565 (j_decompress_ptr cinfo,
+			  JSAMPIMAGE input_buf, JDIMENSION in_row_group_ctr,
+			  JSAMPARRAY output_buf)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+  register int y, cred, cgreen, cblue;
+  int cb, cr;
+  register JSAMPROW outptr;
+  JSAMPROW inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  boolean swap = cinfo->rgb565_swap;
+  unsigned int c;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = upsample->Cr_r_tab;
+  int * Cbbtab = upsample->Cb_b_tab;
+  INT32 * Crgtab = upsample->Cr_g_tab;
+  INT32 * Cbgtab = upsample->Cb_g_tab;
+  SHIFT_TEMPS
+
+  inptr0 = input_buf[0][in_row_group_ctr];
+  inptr1 = input_buf[1][in_row_group_ctr];
+  inptr2 = input_buf[2][in_row_group_ctr];
+  outptr = output_buf[0];
+  upsample->output_row++;
+  /* Loop for each pair of output pixels */
+  for (col = cinfo->output_width >> 1; col > 0; col--) {
+    /* Do the chroma part of the calculation */
+    cb = GETJSAMPLE(*inptr1++);
+    cr = GETJSAMPLE(*inptr2++);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    /* Fetch 2 Y values and emit 2 pixels */
+    y  = GETJSAMPLE(*inptr0++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr, c, swap);
+    y  = GETJSAMPLE(*inptr0++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr + 2, c, swap);
+    outptr += 4;
+  }
+  /* If image width is odd, do the last output column separately */
+  if (cinfo->output_width & 1) {
+    cb = GETJSAMPLE(*inptr1);
+    cr = GETJSAMPLE(*inptr2);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    y  = GETJSAMPLE(*inptr0);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr, c, swap);
+  }
+}
+
+
+METHODDEF(void)
+h2v1_merged_upsample_565D (j_decompress_ptr cinfo,
+			   JSAMPIMAGE input_buf, JDIMENSION in_row_group_ctr,
+			   JSAMPARRAY output_buf)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+  register int y, cred, cgreen, cblue;
+  int cb, cr;
+  register JSAMPROW outptr;
+  JSAMPROW inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  boolean swap = cinfo->rgb565_swap;
+  const UINT8 * dither;
+  unsigned int c;
+  int d;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = upsample->Cr_r_tab;
+  int * Cbbtab = upsample->Cb_b_tab;
+  INT32 * Crgtab = upsample->Cr_g_tab;
+  INT32 * Cbgtab = upsample->Cb_g_tab;
+  SHIFT_TEMPS
+
+  inptr0 = input_buf[0][in_row_group_ctr];
+  inptr1 = input_buf[1][in_row_group_ctr];
+  inptr2 = input_buf[2][in_row_group_ctr];
+  outptr = output_buf[0];
+  dither = jpeg_rgb565_dither[upsample->output_row++ & 3];
+  /* Loop for each pair of output pixels; d is the column mod 4 */
+  for (col = cinfo->output_width >> 1, d = 0; col > 0; col--, d = (d + 2) & 3) {
+    /* Do the chroma part of the calculation */
+    cb = GETJSAMPLE(*inptr1++);
+    cr = GETJSAMPLE(*inptr2++);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    /* Fetch 2 Y values and emit 2 pixels */
+    y  = GETJSAMPLE(*inptr0++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither[d]);
+    STORE_RGB565(outptr, c, swap);
+    y  = GETJSAMPLE(*inptr0++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither[d + 1]);
+    STORE_RGB565(outptr + 2, c, swap);
+    outptr += 4;
+  }
+  /* If image width is odd, do the last output column separately */
+  if (cinfo->output_width & 1) {
+    cb = GETJSAMPLE(*inptr1);
+    cr = GETJSAMPLE(*inptr2);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    y  = GETJSAMPLE(*inptr0);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither[d]);
+    STORE_RGB565(outptr, c, swap);
+  }
+}
+
+
+METHODDEF(void)
+h2v2_merged_upsample_565 (j_decompress_ptr cinfo,
+			  JSAMPIMAGE input_buf, JDIMENSION in_row_group_ctr,
+			  JSAMPARRAY output_buf)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+  register int y, cred, cgreen, cblue;
+  int cb, cr;
+  register JSAMPROW outptr0, outptr1;
+  JSAMPROW inptr00, inptr01, inptr1, inptr2;
+  JDIMENSION col;
+  boolean swap = cinfo->rgb565_swap;
+  unsigned int c;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = upsample->Cr_r_tab;
+  int * Cbbtab = upsample->Cb_b_tab;
+  INT32 * Crgtab = upsample->Cr_g_tab;
+  INT32 * Cbgtab = upsample->Cb_g_tab;
+  SHIFT_TEMPS
+
+  inptr00 = input_buf[0][in_row_group_ctr*2];
+  inptr01 = input_buf[0][in_row_group_ctr*2 + 1];
+  inptr1 = input_buf[1][in_row_group_ctr];
+  inptr2 = input_buf[2][in_row_group_ctr];
+  outptr0 = output_buf[0];
+  outptr1 = output_buf[1];
+  upsample->output_row += 2;
+  /* Loop for each group of output pixels */
+  for (col = cinfo->output_width >> 1; col > 0; col--) {
+    /* Do the chroma part of the calculation */
+    cb = GETJSAMPLE(*inptr1++);
+    cr = GETJSAMPLE(*inptr2++);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    /* Fetch 4 Y values and emit 4 pixels */
+    y  = GETJSAMPLE(*inptr00++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr0, c, swap);
+    y  = GETJSAMPLE(*inptr00++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr0 + 2, c, swap);
+    outptr0 += 4;
+    y  = GETJSAMPLE(*inptr01++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr1, c, swap);
+    y  = GETJSAMPLE(*inptr01++);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr1 + 2, c, swap);
+    outptr1 += 4;
+  }
+  /* If image width is odd, do the last output column separately */
+  if (cinfo->output_width & 1) {
+    cb = GETJSAMPLE(*inptr1);
+    cr = GETJSAMPLE(*inptr2);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    y  = GETJSAMPLE(*inptr00);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr0, c, swap);
+    y  = GETJSAMPLE(*inptr01);
+    c = PACK_RGB565(range_limit[y + cred], range_limit[y + cgreen],
+		    range_limit[y + cblue]);
+    STORE_RGB565(outptr1, c, swap);
+  }
+}
+
+
+METHODDEF(void)
+h2v2_merged_upsample_565D (j_decompress_ptr cinfo,
+			   JSAMPIMAGE input_buf, JDIMENSION in_row_group_ctr,
+			   JSAMPARRAY output_buf)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+  register int y, cred, cgreen, cblue;
+  int cb, cr;
+  register JSAMPROW outptr0, outptr1;
+  JSAMPROW inptr00, inptr01, inptr1, inptr2;
+  JDIMENSION col;
+  boolean swap = cinfo->rgb565_swap;
+  const UINT8 * dither0;
+  const UINT8 * dither1;
+  unsigned int c;
+  int d;
+  /* copy these pointers into registers if possible */
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = upsample->Cr_r_tab;
+  int * Cbbtab = upsample->Cb_b_tab;
+  INT32 * Crgtab = upsample->Cr_g_tab;
+  INT32 * Cbgtab = upsample->Cb_g_tab;
+  SHIFT_TEMPS
+
+  inptr00 = input_buf[0][in_row_group_ctr*2];
+  inptr01 = input_buf[0][in_row_group_ctr*2 + 1];
+  inptr1 = input_buf[1][in_row_group_ctr];
+  inptr2 = input_buf[2][in_row_group_ctr];
+  outptr0 = output_buf[0];
+  outptr1 = output_buf[1];
+  dither0 = jpeg_rgb565_dither[upsample->output_row++ & 3];
+  dither1 = jpeg_rgb565_dither[upsample->output_row++ & 3];
+  /* Loop for each group of output pixels; d is the column mod 4 */
+  for (col = cinfo->output_width >> 1, d = 0; col > 0; col--, d = (d + 2) & 3) {
+    /* Do the chroma part of the calculation */
+    cb = GETJSAMPLE(*inptr1++);
+    cr = GETJSAMPLE(*inptr2++);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    /* Fetch 4 Y values and emit 4 pixels */
+    y  = GETJSAMPLE(*inptr00++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither0[d]);
+    STORE_RGB565(outptr0, c, swap);
+    y  = GETJSAMPLE(*inptr00++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither0[d + 1]);
+    STORE_RGB565(outptr0 + 2, c, swap);
+    outptr0 += 4;
+    y  = GETJSAMPLE(*inptr01++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither1[d]);
+    STORE_RGB565(outptr1, c, swap);
+    y  = GETJSAMPLE(*inptr01++);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither1[d + 1]);
+    STORE_RGB565(outptr1 + 2, c, swap);
+    outptr1 += 4;
+  }
+  /* If image width is odd, do the last output column separately */
+  if (cinfo->output_width & 1) {
+    cb = GETJSAMPLE(*inptr1);
+    cr = GETJSAMPLE(*inptr2);
+    cred = Crrtab[cr];
+    cgreen = (int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr], SCALEBITS);
+    cblue = Cbbtab[cb];
+    y  = GETJSAMPLE(*inptr00);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither0[d]);
+    STORE_RGB565(outptr0, c, swap);
+    y  = GETJSAMPLE(*inptr01);
+    c = DITHER_RGB565(range_limit, range_limit[y + cred],
+		      range_limit[y + cgreen], range_limit[y + cblue],
+		      dither1[d]);
+    STORE_RGB565(outptr1, c, swap);
+  }
+}
+
+
 /*
  * Module initialization routine for merged upsampling/color conversion.
  *
@@ -377,20 +685,29 @@ jinit_merged_upsampler (j_decompress_ptr cinfo)
 				SIZEOF(my_upsampler));
   cinfo->upsample = (struct jpeg_upsampler *) upsample;
   upsample->pub.start_pass = start_pass_merged_upsample;
+  upsample->pub.skip_rows = skip_rows_merged_upsample;
   upsample->pub.need_context_rows = FALSE;
 
   upsample->out_row_width = cinfo->output_width * cinfo->out_color_components;
 
   if (cinfo->max_v_samp_factor == 2) {
     upsample->pub.upsample = merged_2v_upsample;
-    upsample->upmethod = h2v2_merged_upsample;
+    if (cinfo->out_color_space == JCS_RGB565)
+      upsample->upmethod = cinfo->rgb565_dither ?
+			   h2v2_merged_upsample_565D : h2v2_merged_upsample_565;
+    else
+      upsample->upmethod = h2v2_merged_upsample;
     /* Allocate a spare row buffer */
     upsample->spare_row = (JSAMPROW)
       (*cinfo->mem->alloc_large) ((j_common_ptr) cinfo, JPOOL_IMAGE,
 		(size_t) (upsample->out_row_width * SIZEOF(JSAMPLE)));
   } else {
     upsample->pub.upsample = merged_1v_upsample;
-    upsample->upmethod = h2v1_merged_upsample;
+    if (cinfo->out_color_space == JCS_RGB565)
+      upsample->upmethod = cinfo->rgb565_dither ?
+			   h2v1_merged_upsample_565D : h2v1_merged_upsample_565;
+    else
+      upsample->upmethod = h2v1_merged_upsample;
     /* No spare row needed */
     upsample->spare_row = NULL;
   }
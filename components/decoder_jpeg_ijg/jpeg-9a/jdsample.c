@@ -78,6 +78,22 @@ start_pass_upsample (j_decompress_ptr cinfo)
 }
 
 
+/*
+ * Skip rows, the buffer is empty at the iMCU row boundaries where
+ * jpeg_skip_imcu_rows is allowed.  The color converter counts the rows
+ * for its RGB565 dither.
+ */
+
+METHODDEF(void)
+skip_rows_upsample (j_decompress_ptr cinfo, JDIMENSION num_rows)
+{
+  my_upsample_ptr upsample = (my_upsample_ptr) cinfo->upsample;
+
+  upsample->rows_to_go -= num_rows;
+  (*cinfo->cconvert->skip_rows) (cinfo, num_rows);
+}
+
+
 /*
  * Control routine to do upsampling (and color conversion).
  *
@@ -304,6 +320,7 @@ jinit_upsampler (j_decompress_ptr cinfo)
 				SIZEOF(my_upsampler));
   cinfo->upsample = (struct jpeg_upsampler *) upsample;
   upsample->pub.start_pass = start_pass_upsample;
+  upsample->pub.skip_rows = skip_rows_upsample;
   upsample->pub.upsample = sep_upsample;
   upsample->pub.need_context_rows = FALSE; /* until we find out differently */
 
@@ -230,6 +230,8 @@ struct jpeg_inverse_dct {
 /* Upsampling (note that upsampler must also call color converter) */
 struct jpeg_upsampler {
   JMETHOD(void, start_pass, (j_decompress_ptr cinfo));
+  /* Account for output rows skipped by jpeg_skip_imcu_rows */
+  JMETHOD(void, skip_rows, (j_decompress_ptr cinfo, JDIMENSION num_rows));
   JMETHOD(void, upsample, (j_decompress_ptr cinfo,
 			   JSAMPIMAGE input_buf,
 			   JDIMENSION *in_row_group_ctr,
@@ -247,6 +249,7 @@ struct jpeg_color_deconverter {
   JMETHOD(void, color_convert, (j_decompress_ptr cinfo,
 				JSAMPIMAGE input_buf, JDIMENSION input_row,
 				JSAMPARRAY output_buf, int num_rows));
+  JMETHOD(void, skip_rows, (j_decompress_ptr cinfo, JDIMENSION num_rows));
 };
 
 /* Color quantization or color precision reduction */
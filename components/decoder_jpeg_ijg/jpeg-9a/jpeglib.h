@@ -225,7 +225,8 @@ typedef enum {
 	JCS_CMYK,		/* C/M/Y/K */
 	JCS_YCCK,		/* Y/Cb/Cr/K */
 	JCS_BG_RGB,		/* big gamut red/green/blue, bg-sRGB */
-	JCS_BG_YCC		/* big gamut Y/Cb/Cr, bg-sYCC */
+	JCS_BG_YCC,		/* big gamut Y/Cb/Cr, bg-sYCC */
+	JCS_RGB565		/* 5-6-5 RGB in 16 bits, output only, local */
 } J_COLOR_SPACE;
 
 /* Supported color transforms. */
@@ -686,6 +687,24 @@ struct jpeg_decompress_struct {
   struct jpeg_upsampler * upsample;
   struct jpeg_color_deconverter * cconvert;
   struct jpeg_color_quantizer * cquantize;
+
+  /* Region decoding, a local extension for jpegd2.c: the IDCT is run only
+   * for the iMCU columns first_idct_col..last_idct_col, see
+   * jpeg_set_idct_columns(), and not at all while skip_idct is set, see
+   * jpeg_skip_imcu_rows().  Output samples of other columns are undefined.
+   */
+  JDIMENSION first_idct_col;
+  JDIMENSION last_idct_col;
+  boolean skip_idct;
+
+  /* Direct RGB565 output, a local extension for jpegd2.c: with
+   * out_color_space = JCS_RGB565 each pixel is stored as one 16-bit word
+   * (two JSAMPLEs, the row must be 2-byte aligned), in the byte order of the
+   * machine or, with rgb565_swap, high byte first.  rgb565_dither adds a 4x4
+   * ordered dither before the truncation to 5/6/5 bits.
+   */
+  boolean rgb565_swap;
+  boolean rgb565_dither;
 };
 
 
@@ -923,6 +942,8 @@ typedef JMETHOD(boolean, jpeg_marker_parser_method, (j_decompress_ptr cinfo));
 #define jpeg_read_scanlines	jReadScanlines
 #define jpeg_finish_decompress	jFinDecompress
 #define jpeg_read_raw_data	jReadRawData
+#define jpeg_set_idct_columns	jSetIDCTCols
+#define jpeg_skip_imcu_rows	jSkipIMCURows
 #define jpeg_has_multiple_scans	jHasMultScn
 #define jpeg_start_output	jStrtOutput
 #define jpeg_finish_output	jFinOutput
@@ -1060,6 +1081,12 @@ EXTERN(JDIMENSION) jpeg_read_raw_data JPP((j_decompress_ptr cinfo,
 					   JSAMPIMAGE data,
 					   JDIMENSION max_lines));
 
+/* Region decoding, local extension (see jdapistd.c). */
+EXTERN(void) jpeg_set_idct_columns JPP((j_decompress_ptr cinfo,
+					JDIMENSION xoffset, JDIMENSION width));
+EXTERN(JDIMENSION) jpeg_skip_imcu_rows JPP((j_decompress_ptr cinfo,
+					    JDIMENSION max_lines));
+
 /* Additional entry points for buffered-image mode. */
 EXTERN(boolean) jpeg_has_multiple_scans JPP((j_decompress_ptr cinfo));
 EXTERN(boolean) jpeg_start_output JPP((j_decompress_ptr cinfo,
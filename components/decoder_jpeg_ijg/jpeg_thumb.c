@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <setjmp.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "metrics.h"
+
+#include "jpeglib.h"
+#include "jerror.h"
+#include "jpeg_thumb.h"
+
+static const char *TAG = "jpeg_thumb";
+
+METRICS_HISTOGRAM_DEFINE(s_thumb_time, "jpeg_decode_duration_seconds", NULL, "source=\"thumb\"",
+                         METRICS_LATENCY_BOUNDS_US);
+
+struct thumb_error_mgr {
+    struct jpeg_error_mgr pub;
+    jmp_buf setjmp_buffer;
+};
+
+METHODDEF(void) thumb_error_exit(j_common_ptr cinfo)
+{
+    struct thumb_error_mgr *err = (struct thumb_error_mgr *) cinfo->err;
+    (*cinfo->err->output_message)(cinfo);
+    longjmp(err->setjmp_buffer, 1);
+}
+
+/* Largest IJG reduction (1/8 .. 1/1) that still covers the requested size,
+ * anything beyond that is done by the resampler below */
+static unsigned int thumb_pick_denom(JDIMENSION width, JDIMENSION height, uint16_t max_side)
+{
+    JDIMENSION side = width > height ? width : height;
+    unsigned int denom = 8;
+    while (denom > 1 && (side + denom - 1) / denom < max_side) {
+        denom >>= 1;
+    }
+    return denom;
+}
+
+esp_err_t jpeg_thumb_create(const char *src_path, const char *dst_path, uint16_t max_side, int quality)
+{
+    if (!src_path || !dst_path || max_side == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct jpeg_decompress_struct dinfo;
+    struct jpeg_compress_struct cinfo;
+    struct thumb_error_mgr jerr;
+    memset(&dinfo, 0, sizeof(dinfo));
+    memset(&cinfo, 0, sizeof(cinfo));
+
+    FILE *in = fopen(src_path, "rb");
+    if (!in) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    FILE *out = fopen(dst_path, "wb");
+    if (!out) {
+        fclose(in);
+        return ESP_FAIL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    dinfo.err = jpeg_std_error(&jerr.pub);
+    cinfo.err = &jerr.pub;
+    jerr.pub.error_exit = thumb_error_exit;
+
+    if (setjmp(jerr.setjmp_buffer)) {
+        /* anything but memory and the output file is the source's fault */
+        int code = jerr.pub.msg_code;
+        jpeg_destroy_compress(&cinfo);
+        jpeg_destroy_decompress(&dinfo);
+        fclose(in);
+        fclose(out);
+        unlink(dst_path);
+        ESP_LOGE(TAG, "thumbnail of %s failed", src_path);
+        if (code == JERR_OUT_OF_MEMORY) {
+            return ESP_ERR_NO_MEM;
+        }
+        return code == JERR_FILE_WRITE ? ESP_FAIL : ESP_ERR_NOT_SUPPORTED;
+    }
+
+    jpeg_create_decompress(&dinfo);
+    jpeg_create_compress(&cinfo);
+
+    jpeg_stdio_src(&dinfo, in);
+    (void) jpeg_read_header(&dinfo, TRUE);
+    dinfo.scale_num = 1;
+    dinfo.scale_denom = thumb_pick_denom(dinfo.image_width, dinfo.image_height, max_side);
+    dinfo.dct_method = JDCT_IFAST;
+    dinfo.do_fancy_upsampling = FALSE;
+    dinfo.out_color_space = JCS_RGB;
+    (void) jpeg_start_decompress(&dinfo);
+
+    JDIMENSION src_w = dinfo.output_width;
+    JDIMENSION src_h = dinfo.output_height;
+    JDIMENSION side = src_w > src_h ? src_w : src_h;
+    JDIMENSION dst_w = src_w;
+    JDIMENSION dst_h = src_h;
+    if (side > max_side) {
+        dst_w = (src_w * max_side) / side;
+        dst_h = (src_h * max_side) / side;
+        dst_w = dst_w ? dst_w : 1;
+        dst_h = dst_h ? dst_h : 1;
+    }
+
+    cinfo.image_width = dst_w;
+    cinfo.image_height = dst_h;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    cinfo.dct_method = JDCT_IFAST;
+    jpeg_stdio_dest(&cinfo, out);
+    jpeg_start_compress(&cinfo, TRUE);
+
+    JSAMPARRAY src_row = (*dinfo.mem->alloc_sarray)((j_common_ptr) &dinfo, JPOOL_IMAGE, src_w * 3, 1);
+    JSAMPARRAY dst_row = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, dst_w * 3, 1);
+
+    /* nearest neighbour, source rows are only read as far as needed */
+    for (JDIMENSION y = 0; y < dst_h; y++) {
+        JDIMENSION sy = (y * src_h) / dst_h;
+        while (dinfo.output_scanline <= sy) {
+            (void) jpeg_read_scanlines(&dinfo, src_row, 1);
+        }
+        JSAMPROW s = src_row[0];
+        JSAMPROW d = dst_row[0];
+        for (JDIMENSION x = 0; x < dst_w; x++) {
+            JSAMPROW p = s + 3 * ((x * src_w) / dst_w);
+            *d++ = p[0];
+            *d++ = p[1];
+            *d++ = p[2];
+        }
+        (void) jpeg_write_scanlines(&cinfo, dst_row, 1);
+    }
+
+    jpeg_finish_compress(&cinfo);
+    ESP_LOGD(TAG, "%s -> %ux%u (1/%u)", src_path, (unsigned) dst_w, (unsigned) dst_h, dinfo.scale_denom);
+    /* the remaining source rows are not needed, skip their decode */
+    jpeg_abort_decompress(&dinfo);
+
+    jpeg_destroy_compress(&cinfo);
+    jpeg_destroy_decompress(&dinfo);
+    fclose(in);
+    fclose(out);
+    metrics_histogram_observe_since(&s_thumb_time, start);
+    return ESP_OK;
+}
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/param.h>
+#include <unistd.h>
 #include "stdint.h"
 #include "sdkconfig.h"
 
@@ -14,6 +16,12 @@
 
 #include "jpeglib.h"
 #include "jpegd2.h"
+#include "esp_timer.h"
+#include "metrics.h"
+#include "color_convert.h"
+
+METRICS_HISTOGRAM_DEFINE(s_decode_time, "jpeg_decode_duration_seconds", "JPEG decode time, display output excluded",
+                         "source=\"mjpeg\"", METRICS_LATENCY_BOUNDS_US);
 /*
  * <setjmp.h> is used for the optional error recovery mechanism shown in
  * the second part of the example.
@@ -68,8 +76,28 @@ struct my_error_mgr {
 
 typedef struct my_error_mgr *my_error_ptr;
 
-static uint8_t  *jpegbuf;
-static uint32_t jbufsize;
+/*
+ * Decoder context. Everything one decode needs lives here instead of in
+ * file statics, so tasks with their own context decode at the same time.
+ * The IJG object is created once and reused for every image, its permanent
+ * pool (error, source and marker managers) is not allocated again.
+ */
+struct jpegd2_ctx {
+    struct jpeg_decompress_struct cinfo;
+    struct my_error_mgr jerr;
+    struct jpeg_source_mgr src;     /* cinfo.src points here */
+    const uint8_t *data;            /* memory source, see jpegd2_set_source_mem() */
+    size_t size;
+    bool data_given;                /* the whole buffer went to the decoder */
+    jpegd2_read_cb_t read_cb;       /* stream source, see jpegd2_set_source_cb() */
+    jpegd2_skip_cb_t skip_cb;
+    void *cb_arg;
+    FILE *file;                     /* arguments of the file and fd sources */
+    int fd;
+    JOCTET *inbuf;                  /* CONFIG_JPEGD2_INPUT_BUFFER_SIZE, allocated for the first stream */
+    uint8_t *strip;                 /* strip being filled */
+    size_t strip_rows;              /* rows in it so far */
+};
 
 /*
  * Here's the routine that will replace the standard error_exit method:
@@ -98,17 +126,18 @@ static void init_source(j_decompress_ptr cinfo)
 //填充输入缓冲区,一次性读取整帧数据
 static boolean fill_input_buffer(j_decompress_ptr cinfo)
 {
-    if (jbufsize == 0) { //结束了
-        printf("jd read off\r\n");
-        //填充结束符
-        jpegbuf[0] = (uint8_t) 0xFF;
-        jpegbuf[1] = (uint8_t) JPEG_EOI;
-        cinfo->src->next_input_byte = jpegbuf;
+    /* the caller's buffer is not written, a truncated image ends with this EOI */
+    static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+    jpegd2_ctx_t *ctx = (jpegd2_ctx_t *) cinfo->client_data;
+
+    if (ctx->data_given) { //结束了
+        WARNMS(cinfo, JWRN_JPEG_EOF);
+        cinfo->src->next_input_byte = eoi;
         cinfo->src->bytes_in_buffer = 2;
     } else {
-        cinfo->src->next_input_byte = jpegbuf;
-        cinfo->src->bytes_in_buffer = jbufsize;
-        jbufsize -= jbufsize;
+        cinfo->src->next_input_byte = ctx->data;
+        cinfo->src->bytes_in_buffer = ctx->size;
+        ctx->data_given = true;
     }
 
     return TRUE;
@@ -142,79 +171,360 @@ static void term_source(j_decompress_ptr cinfo)
     return;
 }
 
-//初始化jpeg解码数据源
-static void jpeg_filerw_src_init(j_decompress_ptr cinfo)
+/*
+ * Stream source: the input is read CONFIG_JPEGD2_INPUT_BUFFER_SIZE bytes at
+ * a time, so the size of the image does not matter. Skipped data, like
+ * large EXIF blocks, is seeked over when the stream can seek.
+ */
+static boolean stream_fill_input_buffer(j_decompress_ptr cinfo)
 {
-    if (cinfo->src == NULL) {   /* first time for this JPEG object? */
-        cinfo->src = (struct jpeg_source_mgr *)
-                     (*cinfo->mem->alloc_small)((j_common_ptr) cinfo, JPOOL_PERMANENT,
-                                                sizeof(struct jpeg_source_mgr));
-    }
-
-    cinfo->src->init_source = init_source;
-    cinfo->src->fill_input_buffer = fill_input_buffer;
-    cinfo->src->skip_input_data = skip_input_data;
-    cinfo->src->resync_to_restart = jpeg_resync_to_restart; /* use default method */
-    cinfo->src->term_source = term_source;
-    cinfo->src->bytes_in_buffer = 0; /* forces fill_input_buffer on first read */
-    cinfo->src->next_input_byte = NULL; /* until buffer loaded */
+    static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+    jpegd2_ctx_t *ctx = (jpegd2_ctx_t *) cinfo->client_data;
+
+    int n = ctx->read_cb(ctx->cb_arg, ctx->inbuf, CONFIG_JPEGD2_INPUT_BUFFER_SIZE);
+    if (n <= 0) {
+        WARNMS(cinfo, JWRN_JPEG_EOF);
+        cinfo->src->next_input_byte = eoi;
+        cinfo->src->bytes_in_buffer = 2;
+    } else {
+        cinfo->src->next_input_byte = ctx->inbuf;
+        cinfo->src->bytes_in_buffer = n;
+    }
+    return TRUE;
 }
 
-/*
- * Sample routine for JPEG decompression.  We assume that the source file name
- * is passed in.  We want to return 1 on success, 0 on error.
- */
-void mjpegdraw(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
-                const size_t outbuffer_width, const size_t outbuffer_height,
-                lcd_write_cb lcd_cb, const size_t lcd_width, const size_t lcd_height)
+static void stream_skip_input_data(j_decompress_ptr cinfo, long num_bytes)
+{
+    jpegd2_ctx_t *ctx = (jpegd2_ctx_t *) cinfo->client_data;
+    if (num_bytes <= 0) {
+        return;
+    }
+    if (num_bytes <= (long) cinfo->src->bytes_in_buffer) {
+        cinfo->src->next_input_byte += (size_t) num_bytes;
+        cinfo->src->bytes_in_buffer -= (size_t) num_bytes;
+        return;
+    }
+    num_bytes -= (long) cinfo->src->bytes_in_buffer;
+    cinfo->src->bytes_in_buffer = 0;
+    if (ctx->skip_cb && 0 == ctx->skip_cb(ctx->cb_arg, num_bytes)) {
+        return;
+    }
+    /* not seekable, read and drop the data */
+    while (num_bytes > 0) {
+        (void) stream_fill_input_buffer(cinfo);
+        size_t n = MIN((size_t) num_bytes, cinfo->src->bytes_in_buffer);
+        cinfo->src->next_input_byte += n;
+        cinfo->src->bytes_in_buffer -= n;
+        num_bytes -= n;
+    }
+}
+
+static int file_read(void *arg, uint8_t *buf, size_t len)
+{
+    return fread(buf, 1, len, ((jpegd2_ctx_t *) arg)->file);
+}
+
+static int file_skip(void *arg, size_t len)
+{
+    return fseek(((jpegd2_ctx_t *) arg)->file, len, SEEK_CUR);
+}
+
+static int fd_read(void *arg, uint8_t *buf, size_t len)
+{
+    return read(((jpegd2_ctx_t *) arg)->fd, buf, len);
+}
+
+static int fd_skip(void *arg, size_t len)
+{
+    return lseek(((jpegd2_ctx_t *) arg)->fd, len, SEEK_CUR) < 0 ? -1 : 0;
+}
+
+jpegd2_ctx_t *jpegd2_ctx_create(void)
+{
+    jpegd2_ctx_t *ctx = calloc(1, sizeof(jpegd2_ctx_t));
+    if (!ctx) {
+        return NULL;
+    }
+    /* We set up the normal JPEG error routines, then override error_exit. */
+    ctx->cinfo.err = jpeg_std_error(&ctx->jerr.pub);
+    ctx->jerr.pub.error_exit = my_error_exit;
+    if (setjmp(ctx->jerr.setjmp_buffer)) {
+        /* no memory for the permanent pool */
+        jpeg_destroy_decompress(&ctx->cinfo);
+        free(ctx);
+        return NULL;
+    }
+    jpeg_create_decompress(&ctx->cinfo);
+    ctx->cinfo.client_data = ctx;
+
+    ctx->src.init_source = init_source;
+    ctx->src.fill_input_buffer = fill_input_buffer;
+    ctx->src.skip_input_data = skip_input_data;
+    ctx->src.resync_to_restart = jpeg_resync_to_restart; /* use default method */
+    ctx->src.term_source = term_source;
+    ctx->cinfo.src = &ctx->src;
+    return ctx;
+}
+
+void jpegd2_ctx_delete(jpegd2_ctx_t *ctx)
+{
+    if (ctx) {
+        jpeg_destroy_decompress(&ctx->cinfo);
+        free(ctx->inbuf);
+        free(ctx);
+    }
+}
+
+void jpegd2_set_source_mem(jpegd2_ctx_t *ctx, const uint8_t *data, size_t size)
+{
+    ctx->data = data;
+    ctx->size = size;
+    ctx->data_given = false;
+    ctx->src.fill_input_buffer = fill_input_buffer;
+    ctx->src.skip_input_data = skip_input_data;
+    ctx->src.bytes_in_buffer = 0; /* forces fill_input_buffer on first read */
+    ctx->src.next_input_byte = NULL; /* until buffer loaded */
+}
+
+esp_err_t jpegd2_set_source_cb(jpegd2_ctx_t *ctx, jpegd2_read_cb_t read_cb, jpegd2_skip_cb_t skip_cb, void *arg)
+{
+    if (!ctx || !read_cb) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!ctx->inbuf) {
+        ctx->inbuf = malloc(CONFIG_JPEGD2_INPUT_BUFFER_SIZE);
+        if (!ctx->inbuf) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    ctx->read_cb = read_cb;
+    ctx->skip_cb = skip_cb;
+    ctx->cb_arg = arg;
+    ctx->src.fill_input_buffer = stream_fill_input_buffer;
+    ctx->src.skip_input_data = stream_skip_input_data;
+    ctx->src.bytes_in_buffer = 0;
+    ctx->src.next_input_byte = NULL;
+    return ESP_OK;
+}
+
+esp_err_t jpegd2_set_source_file(jpegd2_ctx_t *ctx, FILE *file)
 {
+    if (!ctx || !file) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ctx->file = file;
+    return jpegd2_set_source_cb(ctx, file_read, file_skip, ctx);
+}
+
+esp_err_t jpegd2_set_source_fd(jpegd2_ctx_t *ctx, int fd)
+{
+    if (!ctx || fd < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ctx->fd = fd;
+    return jpegd2_set_source_cb(ctx, fd_read, fd_skip, ctx);
+}
+
+/* Hand the filled rows of the strip to the callback, the first one is screen row y */
+static void strip_send(jpegd2_ctx_t *ctx, const jpegd2_output_t *out, size_t x, size_t y, size_t width, bool ping_pong)
+{
+    if (ping_pong) {
+        /* the other strip is written next, its transfer must be done */
+        out->wait_cb();
+    }
+    out->lcd_cb(x, y, width, ctx->strip_rows, (uint16_t *)ctx->strip);
+    ctx->strip_rows = 0;
+    if (ping_pong) {
+        size_t strip_bytes = out->outbuffer_height / 2 * out->outbuffer_width * 2;
+        ctx->strip = (ctx->strip == out->outbuffer) ? out->outbuffer + strip_bytes : out->outbuffer;
+    }
+}
+
+/* Drop the next rows of the image, whole MCU rows without the IDCT and the rest row by row */
+static void skip_rows(j_decompress_ptr cinfo, JSAMPARRAY buffer, size_t rows)
+{
+    JDIMENSION end = cinfo->output_scanline + rows;
+    while (cinfo->output_scanline < end) {
+        if (!jpeg_skip_imcu_rows(cinfo, end - cinfo->output_scanline)) {
+            (void) jpeg_read_scanlines(cinfo, buffer, 1);
+        }
+    }
+}
+
+#ifdef CONFIG_COLOR_SPACE_RGB_565
+/* Size of the whole image fitted to the output, the part off screen is cropped later */
+static void fit_size(j_decompress_ptr cinfo, const jpegd2_output_t *out, size_t *fit_w, size_t *fit_h)
+{
+    uint64_t w = cinfo->image_width, h = cinfo->image_height;
+    uint64_t lcd_w = out->lcd_width, lcd_h = out->lcd_height;
+    /* contain follows the side that reaches the edge first, cover the other one */
+    bool by_height = (w * lcd_h <= h * lcd_w) == (out->fit == JPEGD2_FIT_CONTAIN);
+    if (by_height) {
+        *fit_h = lcd_h;
+        *fit_w = MAX(1, (w * lcd_h + h / 2) / h);
+    } else {
+        *fit_w = lcd_w;
+        *fit_h = MAX(1, (h * lcd_w + w / 2) / w);
+    }
+}
+
+/* The smallest IDCT scale N/8 that decodes at least fit_w x fit_h, the resampler only shrinks what is left */
+static void fit_scale(j_decompress_ptr cinfo, size_t fit_w, size_t fit_h)
+{
+    cinfo->scale_denom = 8;
+    for (cinfo->scale_num = 1; cinfo->scale_num < 8; cinfo->scale_num++) {
+        if ((cinfo->image_width * cinfo->scale_num + 7) / 8 >= fit_w &&
+                (cinfo->image_height * cinfo->scale_num + 7) / 8 >= fit_h) {
+            break;
+        }
+    }
+}
+
+/* Source pixel of output pixel i of n taken from m pixels, with the weight of its right neighbour in 1/256 */
+static void resample_pos(size_t i, size_t n, size_t m, bool bilinear, uint16_t *index, uint8_t *weight)
+{
+    *weight = 0;
+    if (!bilinear) {
+        *index = MIN((2 * i + 1) * m / (2 * n), m - 1);
+        return;
+    }
+    /* centre of the output pixel in source pixels, (i + 0.5) * m / n - 0.5 */
+    int64_t pos = (int64_t)(2 * i + 1) * m * 256 / (2 * n) - 128;
+    pos = MAX(pos, 0);
+    *index = pos >> 8;
+    if (*index >= m - 1) {
+        *index = m - 1;
+    } else {
+        *weight = pos & 0xff;
+    }
+}
+
+/* Resample the scaled image to fit_w x fit_h and send the part that is on screen */
+static void draw_fit(jpegd2_ctx_t *ctx, const jpegd2_output_t *out, size_t fit_w, size_t fit_h,
+                     bool ping_pong, int64_t *draw_time)
+{
+    j_decompress_ptr cinfo = &ctx->cinfo;
+    size_t src_w = cinfo->output_width;
+    size_t src_h = cinfo->output_height;
+    bool bilinear = out->resample == JPEGD2_RESAMPLE_BILINEAR;
+    size_t strip_height = ping_pong ? out->outbuffer_height / 2 : out->outbuffer_height;
+    /* contain centres the image on the screen, cover the screen on the image */
+    size_t vis_w = MIN(fit_w, out->lcd_width);
+    size_t vis_h = MIN(fit_h, out->lcd_height);
+    size_t crop_x = (fit_w - vis_w) / 2;
+    size_t crop_y = (fit_h - vis_h) / 2;
+    size_t pos_x = (out->lcd_width - vis_w) / 2;
+    size_t pos_y = (out->lcd_height - vis_h) / 2;
+    vis_w = MIN(vis_w, out->outbuffer_width);
+
+    /* the source columns are the same for every row */
+    uint16_t *col = (*cinfo->mem->alloc_small)((j_common_ptr) cinfo, JPOOL_IMAGE, vis_w * sizeof(uint16_t));
+    uint8_t *col_weight = (*cinfo->mem->alloc_small)((j_common_ptr) cinfo, JPOOL_IMAGE, vis_w);
+    for (size_t x = 0; x < vis_w; x++) {
+        resample_pos(crop_x + x, fit_w, src_w, bilinear, &col[x], &col_weight[x]);
+    }
+    size_t last_col = MIN(col[vis_w - 1] + 1, src_w - 1);
+    jpeg_set_idct_columns(cinfo, col[0], last_col - col[0] + 1);
+    /* rows[1] is source row have, rows[0] the one above it */
+    JSAMPARRAY rows = (*cinfo->mem->alloc_sarray)((j_common_ptr) cinfo, JPOOL_IMAGE, src_w * 3, 2);
+    JSAMPARRAY dst = (*cinfo->mem->alloc_sarray)((j_common_ptr) cinfo, JPOOL_IMAGE, vis_w * 3, 1);
+    uint16_t first_row;
+    uint8_t first_weight;
+    resample_pos(crop_y, fit_h, src_h, bilinear, &first_row, &first_weight);
+    skip_rows(cinfo, rows, first_row);
+    long have = (long) cinfo->output_scanline - 1;
+
+    for (size_t y = 0; y < vis_h; y++) {
+        uint16_t sy;
+        uint8_t row_weight;
+        resample_pos(crop_y + y, fit_h, src_h, bilinear, &sy, &row_weight);
+        long need = row_weight ? sy + 1 : sy;
+        while (have < need) {
+            JSAMPROW above = rows[0];
+            rows[0] = rows[1];
+            rows[1] = above;
+            (void) jpeg_read_scanlines(cinfo, &rows[1], 1);
+            have++;
+        }
+        const JSAMPLE *r0 = (have == sy) ? rows[1] : rows[0];
+        const JSAMPLE *r1 = rows[1];
+        JSAMPLE *d = dst[0];
+
+        if (!bilinear) {
+            for (size_t x = 0; x < vis_w; x++, d += 3) {
+                const JSAMPLE *p = r0 + 3 * col[x];
+                d[0] = p[0];
+                d[1] = p[1];
+                d[2] = p[2];
+            }
+        } else {
+            for (size_t x = 0; x < vis_w; x++, d += 3) {
+                size_t x0 = 3 * col[x];
+                size_t x1 = col_weight[x] ? x0 + 3 : x0;
+                uint32_t wx = col_weight[x];
+                for (int c = 0; c < 3; c++) {
+                    uint32_t top = r0[x0 + c] * (256 - wx) + r0[x1 + c] * wx;
+                    uint32_t bottom = r1[x0 + c] * (256 - wx) + r1[x1 + c] * wx;
+                    d[c] = (top * (256 - row_weight) + bottom * row_weight + (1 << 15)) >> 16;
+                }
+            }
+        }
+        uint16_t *row = (uint16_t *)ctx->strip + ctx->strip_rows * vis_w;
+        color_convert_rgb888_to_rgb565(dst[0], row, vis_w, pos_y + y,
+                                       (out->swap_output ? COLOR_CONVERT_SWAP : 0) |
+                                       (out->dither_output ? COLOR_CONVERT_DITHER : 0));
+        ctx->strip_rows++;
+
+        if (ctx->strip_rows == strip_height || y == vis_h - 1) {
+            int64_t draw_start = esp_timer_get_time();
+            strip_send(ctx, out, pos_x, pos_y + y + 1 - ctx->strip_rows, vis_w, ping_pong);
+            *draw_time += esp_timer_get_time() - draw_start;
+        }
+    }
+}
+#endif
+
+esp_err_t jpegd2_draw(jpegd2_ctx_t *ctx, const jpegd2_output_t *out)
+{
+    if (!ctx || !out || !out->outbuffer || !out->lcd_cb || !out->outbuffer_width || !out->outbuffer_height) {
+        return ESP_ERR_INVALID_ARG;
+    }
+#ifndef CONFIG_COLOR_SPACE_RGB_565
+    if (out->fit != JPEGD2_FIT_NONE || out->crop_x || out->crop_y) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
     /* This struct contains the JPEG decompression parameters and pointers to
      * working space (which is allocated as needed by the JPEG library).
      */
-    struct jpeg_decompress_struct cinfo;
-    /* We use our private extension JPEG error handler.
-     * Note that this struct must live as long as the main JPEG parameter
-     * struct, to avoid dangling-pointer problems.
-     */
-    struct my_error_mgr jerr;
+    j_decompress_ptr cinfo = &ctx->cinfo;
     /* More stuff */
     JSAMPARRAY buffer;		/* Output row buffer */
     int row_stride;		/* physical row width in output buffer */
-
-    /* In this example we want to open the input file before doing anything else,
-     * so that the setjmp() error recovery below can assume the file is open.
-     * VERY IMPORTANT: use "b" option to fopen() if you are on a machine that
-     * requires it in order to read binary files.
-     */
-    jpegbuf = mjpegbuffer;
-    jbufsize = size;
-
-    /* Step 1: allocate and initialize JPEG decompression object */
-
-    /* We set up the normal JPEG error routines, then override error_exit. */
-    cinfo.err = jpeg_std_error(&jerr.pub);
-    jerr.pub.error_exit = my_error_exit;
+    int64_t start = esp_timer_get_time();
+    int64_t draw_time = 0;
+    /* With a wait callback the output buffer is split in two strips, one is
+     * filled while the other is still being sent */
+    bool ping_pong = out->wait_cb && out->outbuffer_height >= 2;
+    /* a strip of an image that failed is never sent to the next one */
+    ctx->strip = out->outbuffer;
+    ctx->strip_rows = 0;
 
     /* Establish the setjmp return context for my_error_exit to use. */
-    if (setjmp(jerr.setjmp_buffer)) {
+    if (setjmp(ctx->jerr.setjmp_buffer)) {
         /* If we get here, the JPEG code has signaled an error.
-         * We need to clean up the JPEG object, close the input file, and return.
+         * The object is kept for the next image, only this one is dropped.
          */
-        //jpeg_abort_decompress(&cinfo);
-        jpeg_destroy_decompress(&cinfo);
-        return;
+        jpeg_abort_decompress(cinfo);
+        if (ping_pong) {
+            out->wait_cb();
+        }
+        return ESP_FAIL;
     }
 
-    /* Now we can initialize the JPEG decompression object. */
-    jpeg_create_decompress(&cinfo);
-
-    /* Step 2: specify data source (eg, a file) */
-
-    jpeg_filerw_src_init(&cinfo); ;
-
     /* Step 3: read file parameters with jpeg_read_header() */
 
-    (void) jpeg_read_header(&cinfo, TRUE);
+    (void) jpeg_read_header(cinfo, TRUE);
     /* We can ignore the return value from jpeg_read_header since
      *   (a) suspension is not possible with the stdio data source, and
      *   (b) we passed TRUE to reject a tables-only JPEG file as an error.
@@ -223,82 +533,137 @@ void mjpegdraw(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
 
     /* Step 4: set parameters for decompression */
 
-    /* In this example, we don't need to change any of the defaults set by
-     * jpeg_read_header(), so we do nothing here.
-     */
-    cinfo.dct_method = JDCT_IFAST;
-    cinfo.do_fancy_upsampling = 0;
-    cinfo.out_color_space = JCS_RGB;
+    cinfo->dct_method = JDCT_IFAST;
+    cinfo->do_fancy_upsampling = 0;
+    cinfo->out_color_space = JCS_RGB;
+#ifdef CONFIG_COLOR_SPACE_RGB_565
+    size_t fit_w = 0, fit_h = 0;
+    if (out->fit != JPEGD2_FIT_NONE) {
+        fit_size(cinfo, out, &fit_w, &fit_h);
+        fit_scale(cinfo, fit_w, fit_h);
+    } else {
+        /* the resampler works on RGB888, everything else gets RGB565 from
+         * the colour conversion or the merged upsampler of the decoder */
+        cinfo->out_color_space = JCS_RGB565;
+        cinfo->rgb565_swap = out->swap_output;
+        cinfo->rgb565_dither = out->dither_output;
+    }
+#endif
+    if (out->fit == JPEGD2_FIT_NONE && out->scale) {
+        cinfo->scale_num = out->scale;
+        cinfo->scale_denom = 8;
+    }
     /* Step 5: Start decompressor */
 
-    (void) jpeg_start_decompress(&cinfo);
+    (void) jpeg_start_decompress(cinfo);
     /* We can ignore the return value since suspension is not possible
      * with the stdio data source.
      */
 
-    /* We may need to do some setup of our own at this point before reading
-     * the data.  After jpeg_start_decompress() we have the correct scaled
-     * output image dimensions available, as well as the output colormap
-     * if we asked for color quantization.
-     * In this example, we need to make an output work buffer of the right size.
-     */
+#ifdef CONFIG_COLOR_SPACE_RGB_565
+    if (out->fit != JPEGD2_FIT_NONE) {
+        draw_fit(ctx, out, fit_w, fit_h, ping_pong, &draw_time);
+        goto finish;
+    }
+#endif
+
     /* JSAMPLEs per row in output buffer */
-    row_stride = cinfo.output_width * cinfo.output_components;
+    row_stride = cinfo->output_width * cinfo->output_components;
     /* Make a one-row-high sample array that will go away when done with image */
-    buffer = (*cinfo.mem->alloc_sarray)
-             ((j_common_ptr) &cinfo, JPOOL_IMAGE, row_stride, 1);
-    /* Step 6: while (scan lines remain to be read) */
-    /*           jpeg_read_scanlines(...); */
-
-    /* Here we use the library's state variable cinfo.output_scanline as the
-     * loop counter, so that we don't have to keep track ourselves.
-     *///printf("w=%d, h=%d\n", cinfo.output_width, cinfo.output_height);
-    static uint32_t outbuffer_index = 0;
-    uint32_t index = 0;
-
-    size_t display_height = cinfo.output_height<lcd_height?cinfo.output_height:lcd_height;
-    size_t display_width = cinfo.output_width<lcd_width?cinfo.output_width:lcd_width;
+    buffer = (*cinfo->mem->alloc_sarray)
+             ((j_common_ptr) cinfo, JPOOL_IMAGE, row_stride, 1);
 
-    while (cinfo.output_scanline < display_height) {
-        /* jpeg_read_scanlines expects an array of pointers to scanlines.
-         * Here the array is only one element long, but you could ask for
-         * more than one scanline at a time if that's more convenient.
-         */
+    if (out->crop_x >= cinfo->output_width || out->crop_y >= cinfo->output_height) {
+        jpeg_abort_decompress(cinfo);
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t strip_height = ping_pong ? out->outbuffer_height / 2 : out->outbuffer_height;
+    size_t display_height = MIN(cinfo->output_height - out->crop_y, out->lcd_height);
+    size_t display_width = MIN(MIN(cinfo->output_width - out->crop_x, out->lcd_width), out->outbuffer_width);
+    size_t end_row = out->crop_y + display_height;
+
+    /* only the part on screen is transformed */
+    jpeg_set_idct_columns(cinfo, out->crop_x, display_width);
+    skip_rows(cinfo, buffer, out->crop_y);
+#ifdef CONFIG_COLOR_SPACE_RGB_565
+    /* rows as wide as the strip are decoded into it, others through the row buffer */
+    bool direct = out->crop_x == 0 && display_width == cinfo->output_width;
+#endif
 
+    /* Step 6: while (scan lines remain to be read) */
+    /*           jpeg_read_scanlines(...); */
+    while (cinfo->output_scanline < end_row) {
 #ifdef CONFIG_COLOR_SPACE_RGB_565
-        (void) jpeg_read_scanlines(&cinfo, buffer, 1);
-        /* Assume put_scanline_someplace wants a pointer and sample count. */
-        uint8_t *color_trans_head = buffer[0];
-        uint16_t *out = (uint16_t *)outbuffer;
-        for (index = 0; index < display_width; index++) {
-            uint16_t c = ((*color_trans_head) >> 3) << 11 | ((*(color_trans_head + 1)) >> 2) << 5 | (*(color_trans_head + 2)) >> 3;
-            out[outbuffer_index+index] = c; //big endian
-            color_trans_head += 3;
+        /* rows are packed at the width that is sent */
+        uint16_t *row = (uint16_t *)ctx->strip + ctx->strip_rows * display_width;
+        if (direct) {
+            JSAMPROW dst = (JSAMPROW) row;
+            (void) jpeg_read_scanlines(cinfo, &dst, 1);
+        } else {
+            (void) jpeg_read_scanlines(cinfo, buffer, 1);
+            memcpy(row, buffer[0] + 2 * out->crop_x, display_width * 2);
         }
 #elif CONFIG_COLOR_SPACE_RGB_888
         //TODO:display size
-        JSAMPARRAY outbuffer_head = outbuffer + 3 * outbuffer_index;
-        (void) jpeg_read_scanlines(&cinfo, outbuffer_head, 1);
-        index = cinfo.output_width;
+        JSAMPROW row = ctx->strip + 3 * ctx->strip_rows * cinfo->output_width;
+        (void) jpeg_read_scanlines(cinfo, &row, 1);
 #endif
-        outbuffer_index += index;
+        ctx->strip_rows++;
 
-        if(!(cinfo.output_scanline % outbuffer_height) || outbuffer_index >= (outbuffer_height*outbuffer_width)){
-            lcd_cb(0, cinfo.output_scanline-outbuffer_height, outbuffer_width, outbuffer_height, outbuffer);
-            outbuffer_index = 0;
+        /* the last rows of the image are sent even if they do not fill a strip */
+        if (ctx->strip_rows == strip_height || cinfo->output_scanline == end_row) {
+            int64_t draw_start = esp_timer_get_time();
+            strip_send(ctx, out, 0, cinfo->output_scanline - out->crop_y - ctx->strip_rows, display_width, ping_pong);
+            draw_time += esp_timer_get_time() - draw_start;
         }
-
     }
 
-
     /* Step 7: Finish decompression */
-    (void) jpeg_finish_decompress(&cinfo);
-    /* We can ignore the return value since suspension is not possible
-     * with the stdio data source.
-     */
+finish:
+    if (cinfo->output_scanline < cinfo->output_height) {
+        /* rows below the screen are not decoded */
+        jpeg_abort_decompress(cinfo);
+    } else {
+        (void) jpeg_finish_decompress(cinfo);
+    }
+
+    if (ping_pong) {
+        /* the caller owns the buffer again after return */
+        int64_t draw_start = esp_timer_get_time();
+        out->wait_cb();
+        draw_time += esp_timer_get_time() - draw_start;
+    }
+    metrics_histogram_observe(&s_decode_time, (uint32_t)(esp_timer_get_time() - start - draw_time));
+    return ESP_OK;
+}
 
-    /* Step 8: Release JPEG decompression object */
+void mjpegdraw_async(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
+                const size_t outbuffer_width, const size_t outbuffer_height,
+                lcd_write_cb lcd_cb, lcd_wait_cb wait_cb, bool swap_output,
+                const size_t lcd_width, const size_t lcd_height)
+{
+    jpegd2_ctx_t *ctx = jpegd2_ctx_create();
+    if (!ctx) {
+        return;
+    }
+    const jpegd2_output_t out = {
+        .outbuffer = outbuffer,
+        .outbuffer_width = outbuffer_width,
+        .outbuffer_height = outbuffer_height,
+        .lcd_cb = lcd_cb,
+        .wait_cb = wait_cb,
+        .swap_output = swap_output,
+        .lcd_width = lcd_width,
+        .lcd_height = lcd_height,
+    };
+    jpegd2_set_source_mem(ctx, mjpegbuffer, size);
+    jpegd2_draw(ctx, &out);
+    jpegd2_ctx_delete(ctx);
+}
 
-    /* This is an important step since it will release a good deal of memory. */
-    jpeg_destroy_decompress(&cinfo);
+void mjpegdraw(uint8_t *mjpegbuffer, const uint32_t size, uint8_t *outbuffer,
+                const size_t outbuffer_width, const size_t outbuffer_height,
+                lcd_write_cb lcd_cb, const size_t lcd_width, const size_t lcd_height)
+{
+    mjpegdraw_async(mjpegbuffer, size, outbuffer, outbuffer_width, outbuffer_height, lcd_cb, NULL, false, lcd_width, lcd_height);
 }
@@ -84,6 +84,15 @@ void avi_play(const char *filename, uint8_t *outbuffer,
     uint32_t  Strtype;
     uint8_t *pbuffer;
     uint32_t buffer_size = 22*1024;
+    jpegd2_ctx_t *jpeg = NULL;
+    const jpegd2_output_t out = {
+        .outbuffer = outbuffer,
+        .outbuffer_width = outbuffer_width,
+        .outbuffer_height = outbuffer_height,
+        .lcd_cb = lcd_cb,
+        .lcd_width = lcd_width,
+        .lcd_height = lcd_height,
+    };
 
     avi_file = fopen(filename, "rb");
     if (avi_file == NULL) {
@@ -119,6 +128,13 @@ void avi_play(const char *filename, uint8_t *outbuffer,
         goto EXIT;
     }
 
+    /* one decoder for all frames */
+    jpeg = jpegd2_ctx_create();
+    if (NULL == jpeg) {
+        ESP_LOGE(TAG, "Cannot alloc memory for decoder");
+        goto EXIT;
+    }
+
     fseek(avi_file, AVI_file.movi_start, SEEK_SET); // 偏移到movi list
     Strsize = read_frame(avi_file, pbuffer, buffer_size, &Strtype);
     BytesRD = Strsize+8;
@@ -130,7 +146,8 @@ void avi_play(const char *filename, uint8_t *outbuffer,
         }
         if (Strtype == T_vids) { //显示帧
             int64_t fr_end = esp_timer_get_time();
-            mjpegdraw(pbuffer, Strsize, outbuffer, outbuffer_width, outbuffer_height, lcd_cb, lcd_width, lcd_height);
+            jpegd2_set_source_mem(jpeg, pbuffer, Strsize);
+            jpegd2_draw(jpeg, &out);
             ESP_LOGI(TAG, "jpg decode %ums", (uint32_t)((esp_timer_get_time() - fr_end) / 1000));fr_end = esp_timer_get_time();
             // ESP_LOGI(TAG, "draw %ums", (uint32_t)((esp_timer_get_time() - fr_end) / 1000));fr_end = esp_timer_get_time();
 
@@ -152,6 +169,7 @@ EXIT:
 #ifdef CONFIG_AVI_AUDIO
 pwm_audio_deinit();
 #endif
+jpegd2_ctx_delete(jpeg);
 free(img_rgb888);
 free(pbuffer);
 fclose(avi_file);
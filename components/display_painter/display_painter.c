@@ -12,15 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <stdlib.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
 #include "screen_driver.h"
 #include "display_painter.h"
 #include "display_printf.h"
+#include "display_server.h"
 
 static const char *TAG = "basic painter";
 
@@ -49,6 +55,283 @@ static uint16_t g_screen_height;
 static SemaphoreHandle_t s_log_mutex = NULL;
 static font_t s_font;
 
+typedef struct {
+    uint16_t *buf;          ///< RGB565 pixels row by row, NULL when drawing to the screen
+    int width;
+    int height;
+    bool swap;              ///< Pixels are stored byte swapped, as the screen bus sends them
+} painter_canvas_t;
+
+static painter_canvas_t s_canvas;
+
+/**
+ * Buffers owned by the painter (framebuffer, glyphs, text strips) hold pixels
+ * in the byte order of the screen bus when the driver can send them as they
+ * are, which saves the interface from swapping every pixel twice.
+ */
+static bool s_wire_swap = false;
+
+static inline uint16_t painter_px(uint16_t color)
+{
+    return s_wire_swap ? (uint16_t)(color >> 8 | color << 8) : color;
+}
+
+/**
+ * Rows of the screen the controller scrolls. Drawing at screen row y + i of
+ * the area goes to the memory row y + (i + start) % h, where the controller
+ * shows it at the same place. Everything else uses screen rows.
+ */
+typedef struct {
+    int16_t y;
+    int16_t h;                  ///< 0 without a scroll area
+    int16_t start;
+    bool failed;                ///< The driver can not scroll in this direction
+} painter_scroll_t;
+
+static painter_scroll_t s_scroll;
+
+/** Memory row of screen row y and the rows from y on, at most n, that follow it in memory */
+static inline int scroll_map(int y, int n, int *mem_y)
+{
+    int end = s_scroll.y + s_scroll.h;
+    *mem_y = y;
+    if (0 == s_scroll.start || y >= end) {
+        return n;
+    }
+    if (y < s_scroll.y) {
+        return MIN(n, s_scroll.y - y);
+    }
+    *mem_y = s_scroll.y + (y - s_scroll.y + s_scroll.start) % s_scroll.h;
+    return MIN(n, MIN(end - y, end - *mem_y));
+}
+
+/** Send a bitmap to the screen, split where the scroll area wraps around in memory */
+static esp_err_t painter_send(esp_err_t (*draw)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t *),
+                              int x, int y, int w, int h, const uint16_t *bitmap)
+{
+    esp_err_t ret = ESP_OK;
+    while (h > 0) {
+        int mem_y;
+        int n = scroll_map(y, h, &mem_y);
+        ret |= draw(x, mem_y, w, n, (uint16_t *)bitmap);
+        bitmap += n * w;
+        y += n;
+        h -= n;
+    }
+    return ret;
+}
+
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+/**
+ * Merging two regions is worth it as long as it adds fewer pixels than one window
+ * setup costs, which is 11 single byte transactions or about 256 pixels at 40 MHz
+ */
+#define PAINTER_FB_MERGE_SLACK_PX 256
+
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} painter_rect_t;
+
+static uint16_t *s_fb = NULL;             ///< Framebuffer, NULL when drawing directly to the LCD
+static bool s_fb_dma_capable;             ///< Full width regions can be sent straight from the framebuffer
+static uint16_t *s_flush_buf = NULL;      ///< DMA capable bounce buffer for other regions
+static size_t s_flush_buf_px;
+static painter_rect_t s_dirty[CONFIG_PAINTER_FRAMEBUFFER_DIRTY_RECTS];
+static int s_dirty_num = 0;
+
+static inline int rect_area(const painter_rect_t *r)
+{
+    return (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static inline painter_rect_t rect_union(const painter_rect_t *a, const painter_rect_t *b)
+{
+    painter_rect_t u = {
+        .x0 = MIN(a->x0, b->x0),
+        .y0 = MIN(a->y0, b->y0),
+        .x1 = MAX(a->x1, b->x1),
+        .y1 = MAX(a->y1, b->y1),
+    };
+    return u;
+}
+
+static void fb_mark_dirty(int x0, int y0, int x1, int y1)
+{
+    painter_rect_t r = { x0, y0, x1, y1 };
+
+    while (1) {
+        int best = -1;
+        int best_cost = 0;
+        for (int i = 0; i < s_dirty_num; i++) {
+            painter_rect_t u = rect_union(&r, &s_dirty[i]);
+            /* negative when the two overlap, zero when they touch without gaps */
+            int cost = rect_area(&u) - rect_area(&r) - rect_area(&s_dirty[i]);
+            if (best < 0 || cost < best_cost) {
+                best = i;
+                best_cost = cost;
+            }
+        }
+        if (best < 0 || (best_cost > PAINTER_FB_MERGE_SLACK_PX && s_dirty_num < CONFIG_PAINTER_FRAMEBUFFER_DIRTY_RECTS)) {
+            break;
+        }
+        /* the grown region may now reach others, so try again */
+        r = rect_union(&r, &s_dirty[best]);
+        s_dirty[best] = s_dirty[--s_dirty_num];
+    }
+    s_dirty[s_dirty_num++] = r;
+}
+
+static esp_err_t fb_init(void)
+{
+    size_t fb_size = g_screen_width * g_screen_height * sizeof(uint16_t);
+    if (s_canvas.buf == s_fb) {
+        s_canvas.buf = NULL;
+    }
+    heap_caps_free(s_fb);
+    heap_caps_free(s_flush_buf);
+    s_fb = NULL;
+    s_dirty_num = 0;
+
+#if CONFIG_PAINTER_FRAMEBUFFER_PREFER_PSRAM
+    s_fb = heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+    if (NULL == s_fb) {
+        s_fb = heap_caps_malloc(fb_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    }
+    s_flush_buf_px = MAX(CONFIG_PAINTER_FRAMEBUFFER_FLUSH_BUF_SIZE / sizeof(uint16_t), g_screen_width);
+    s_flush_buf = heap_caps_malloc(s_flush_buf_px * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (NULL == s_fb || NULL == s_flush_buf) {
+        ESP_LOGW(TAG, "No memory for a %u byte framebuffer, drawing directly to the screen", fb_size);
+        heap_caps_free(s_fb);
+        heap_caps_free(s_flush_buf);
+        s_fb = NULL;
+        s_flush_buf = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    s_fb_dma_capable = esp_ptr_dma_capable(s_fb);
+    ESP_LOGI(TAG, "Framebuffer %ux%u in %s memory", g_screen_width, g_screen_height, s_fb_dma_capable ? "internal" : "external");
+
+    uint16_t back = painter_px(g_back_color);
+    for (size_t i = 0; i < g_screen_width * g_screen_height; i++) {
+        s_fb[i] = back;
+    }
+    s_canvas.buf = s_fb;
+    s_canvas.width = g_screen_width;
+    s_canvas.height = g_screen_height;
+    s_canvas.swap = s_wire_swap;
+    return ESP_OK;
+}
+#endif
+
+/**
+ * Output stage of all primitives. Everything is drawn as bitmaps, filled
+ * rectangles or single pixels, either into the current canvas or to the screen.
+ * Pixels outside of a canvas are clipped.
+ */
+static inline bool canvas_is_fb(void)
+{
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    return s_fb && s_canvas.buf == s_fb;
+#else
+    return false;
+#endif
+}
+
+static inline int target_width(void)
+{
+    return s_canvas.buf ? s_canvas.width : g_screen_width;
+}
+
+static inline int target_height(void)
+{
+    return s_canvas.buf ? s_canvas.height : g_screen_height;
+}
+
+/** swap tells whether the bitmap is stored byte swapped, see painter_px() */
+static void painter_blit(int x, int y, int w, int h, const uint16_t *bitmap, bool swap)
+{
+    if (s_canvas.buf) {
+        int x0 = MAX(x, 0), y0 = MAX(y, 0);
+        int x1 = MIN(x + w, s_canvas.width) - 1, y1 = MIN(y + h, s_canvas.height) - 1;
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+        for (int row = y0; row <= y1; row++) {
+            uint16_t *dst = &s_canvas.buf[row * s_canvas.width + x0];
+            const uint16_t *src = &bitmap[(row - y) * w + (x0 - x)];
+            if (swap == s_canvas.swap) {
+                memcpy(dst, src, (x1 - x0 + 1) * sizeof(uint16_t));
+                continue;
+            }
+            for (int i = x0; i <= x1; i++) {
+                *dst++ = *src >> 8 | *src << 8;
+                src++;
+            }
+        }
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+        if (canvas_is_fb()) {
+            fb_mark_dirty(x0, y0, x1, y1);
+        }
+#endif
+        return;
+    }
+    painter_send(swap ? g_lcd.draw_bitmap_wire : g_lcd.draw_bitmap, x, y, w, h, bitmap);
+}
+
+static void painter_fill(int x, int y, int w, int h, uint16_t color)
+{
+    int x0 = MAX(x, 0), y0 = MAX(y, 0);
+    int x1 = MIN(x + w, target_width()) - 1, y1 = MIN(y + h, target_height()) - 1;
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    if (s_canvas.buf) {
+        if (s_canvas.swap) {
+            color = color >> 8 | color << 8;
+        }
+        for (int row = y0; row <= y1; row++) {
+            uint16_t *p = &s_canvas.buf[row * s_canvas.width + x0];
+            for (int i = x0; i <= x1; i++) {
+                *p++ = color;
+            }
+        }
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+        if (canvas_is_fb()) {
+            fb_mark_dirty(x0, y0, x1, y1);
+        }
+#endif
+        return;
+    }
+    for (int y = y0; y <= y1;) {
+        int mem_y;
+        int n = scroll_map(y, y1 - y + 1, &mem_y);
+        if (g_lcd.fill_rect) {
+            g_lcd.fill_rect(x0, mem_y, x1 - x0 + 1, n, color);
+        } else {
+            for (int row = mem_y; row < mem_y + n; row++) {
+                for (int i = x0; i <= x1; i++) {
+                    g_lcd.draw_pixel(i, row, color);
+                }
+            }
+        }
+        y += n;
+    }
+}
+
+/** Horizontal and vertical runs of one color, what the line and circle rasterisers emit */
+static inline void painter_hspan(int x, int y, int len, uint16_t color)
+{
+    painter_fill(x, y, len, 1, color);
+}
+
+static inline void painter_vspan(int x, int y, int len, uint16_t color)
+{
+    painter_fill(x, y, 1, len, color);
+}
+
 esp_err_t painter_init(scr_driver_t *driver)
 {
     g_lcd = *driver;
@@ -57,6 +340,97 @@ esp_err_t painter_init(scr_driver_t *driver)
     s_font = Font16;
     g_screen_width = info.width;
     g_screen_height = info.height;
+    s_wire_swap = false;
+    if (g_lcd.draw_bitmap_wire && g_lcd.get_wire_swap) {
+        g_lcd.get_wire_swap(&s_wire_swap);
+    }
+    if (s_scroll.start && g_lcd.set_scroll_start) {
+        /* scrolled by an earlier painter_init(), the screen rows are memory rows again */
+        g_lcd.set_scroll_start(0);
+    }
+    memset(&s_scroll, 0, sizeof(s_scroll));
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    fb_init();
+#endif
+    return ESP_OK;
+}
+
+esp_err_t painter_flush(void)
+{
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    esp_err_t ret = ESP_OK;
+    /* with an asynchronous driver the bounce buffer is used in two halves,
+     * one is filled while the other is being sent */
+    /* the framebuffer is in bus order if s_wire_swap is set */
+    esp_err_t (*draw)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t *) =
+        s_wire_swap ? g_lcd.draw_bitmap_wire : g_lcd.draw_bitmap;
+    esp_err_t (*draw_async)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t *) =
+        s_wire_swap ? g_lcd.draw_bitmap_wire_async : g_lcd.draw_bitmap_async;
+    bool async = draw_async && g_lcd.draw_wait;
+    size_t half_px = async ? s_flush_buf_px / 2 : s_flush_buf_px;
+    uint16_t *buf = s_flush_buf;
+    for (int i = 0; i < s_dirty_num && s_fb; i++) {
+        const painter_rect_t *r = &s_dirty[i];
+        int w = r->x1 - r->x0 + 1;
+        int h = r->y1 - r->y0 + 1;
+        if (w == g_screen_width && s_fb_dma_capable) {
+            /* full lines are contiguous, no copy needed */
+            ret |= painter_send(async ? draw_async : draw, 0, r->y0, w, h, &s_fb[r->y0 * g_screen_width]);
+            continue;
+        }
+        if (async && half_px < w) {
+            /* a half holds less than one line, wait for every chunk */
+            async = false;
+            half_px = s_flush_buf_px;
+            ret |= g_lcd.draw_wait();
+        }
+        int rows = half_px / w;
+        for (int y = r->y0; y <= r->y1; y += rows) {
+            int n = MIN(rows, r->y1 - y + 1);
+            for (int row = 0; row < n; row++) {
+                memcpy(&buf[row * w], &s_fb[(y + row) * g_screen_width + r->x0], w * sizeof(uint16_t));
+            }
+            if (async) {
+                /* only one transfer is in flight, queueing waits for the other half */
+                ret |= painter_send(draw_async, r->x0, y, w, n, buf);
+                buf = (buf == s_flush_buf) ? s_flush_buf + half_px : s_flush_buf;
+            } else {
+                ret |= painter_send(draw, r->x0, y, w, n, buf);
+            }
+        }
+    }
+    if (g_lcd.draw_wait) {
+        /* the framebuffer may be drawn into again after return */
+        ret |= g_lcd.draw_wait();
+    }
+    s_dirty_num = 0;
+    return ret == ESP_OK ? ESP_OK : ESP_FAIL;
+#else
+    return ESP_OK;
+#endif
+}
+
+esp_err_t painter_set_canvas(uint16_t *buffer, uint16_t width, uint16_t height)
+{
+    if (NULL == buffer) {
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+        s_canvas.buf = s_fb;
+        s_canvas.width = g_screen_width;
+        s_canvas.height = g_screen_height;
+        s_canvas.swap = s_wire_swap;
+#else
+        s_canvas.buf = NULL;
+#endif
+        return ESP_OK;
+    }
+    if (0 == width || 0 == height) {
+        ESP_LOGE(TAG, "canvas size invalid");
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_canvas.buf = buffer;
+    s_canvas.width = width;
+    s_canvas.height = height;
+    s_canvas.swap = false;
     return ESP_OK;
 }
 
@@ -83,6 +457,21 @@ uint16_t painter_get_back_color(void)
 void painter_clear(uint16_t color)
 {
     PAINTER_CHECK(NULL != g_lcd.init, "paint not initial");
+    if (s_scroll.start && (NULL == s_canvas.buf || canvas_is_fb())) {
+        /* every row is drawn anyway, it is cheaper to stop scrolling than to map rows */
+        g_lcd.set_scroll_start(0);
+        s_scroll.start = 0;
+    }
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    if (canvas_is_fb()) {
+        /* nothing drawn before the clear needs to be sent any more */
+        s_dirty_num = 0;
+    }
+#endif
+    if (s_canvas.buf || g_lcd.fill_rect) {
+        painter_fill(0, 0, target_width(), target_height(), color);
+        return;
+    }
     scr_info_t info;
     g_lcd.get_info(&info);
     uint16_t *buffer = malloc(info.width * sizeof(uint16_t));
@@ -99,28 +488,223 @@ void painter_clear(uint16_t color)
     free(buffer);
 }
 
-void painter_draw_char(int x, int y, char ascii_char, const font_t *font, uint16_t color)
+/** Move rows y + lines to y + h - 1 of the canvas to row y */
+static void canvas_move_up(int y, int h, int lines)
+{
+    uint16_t *row = &s_canvas.buf[y * s_canvas.width];
+    memmove(row, row + lines * s_canvas.width, (size_t)(h - lines) * s_canvas.width * sizeof(uint16_t));
+}
+
+/** Set the scroll area of the controller, false if it can not scroll the screen */
+static bool scroll_hw_area(int y, int h)
+{
+    if (NULL == g_lcd.set_scroll_area || NULL == g_lcd.set_scroll_start || s_scroll.failed) {
+        return false;
+    }
+    if (s_scroll.h == h && s_scroll.y == y) {
+        return true;
+    }
+    if (ESP_OK != g_lcd.set_scroll_area(y, h)) {
+        ESP_LOGW(TAG, "screen does not scroll, rows are moved by the painter");
+        s_scroll.failed = true;
+        return false;
+    }
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    if (s_scroll.start && s_fb) {
+        /* the rows of the old area are shown in memory order now */
+        fb_mark_dirty(0, s_scroll.y, g_screen_width - 1, s_scroll.y + s_scroll.h - 1);
+    }
+#endif
+    s_scroll.y = y;
+    s_scroll.h = h;
+    s_scroll.start = 0;
+    return true;
+}
+
+esp_err_t painter_scroll(int y, int h, int lines, uint16_t color)
+{
+    if (y < 0 || h <= 0 || y + h > target_height() || lines < 0) {
+        ESP_LOGE(TAG, "scroll area %d+%d invalid", y, h);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (0 == lines) {
+        return ESP_OK;
+    }
+    if (lines >= h) {
+        painter_fill(0, y, target_width(), h, color);
+        return ESP_OK;
+    }
+
+    bool screen = NULL == s_canvas.buf || canvas_is_fb();
+    if (screen && scroll_hw_area(y, h)) {
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+        if (canvas_is_fb()) {
+            /* the framebuffer keeps screen rows, it moves along with what the controller shows */
+            painter_flush();
+            canvas_move_up(y, h, lines);
+        }
+#endif
+        s_scroll.start = (s_scroll.start + lines) % h;
+        esp_err_t ret = g_lcd.set_scroll_start(s_scroll.start);
+        painter_fill(0, y + h - lines, target_width(), lines, color);
+        return ret;
+    }
+    if (NULL == s_canvas.buf) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    canvas_move_up(y, h, lines);
+#if CONFIG_PAINTER_FRAMEBUFFER_ENABLE
+    if (canvas_is_fb()) {
+        fb_mark_dirty(0, y, s_canvas.width - 1, y + h - lines - 1);
+    }
+#endif
+    painter_fill(0, y + h - lines, s_canvas.width, lines, color);
+    return ESP_OK;
+}
+
+/**
+ * Glyphs are cached as ready-to-send RGB565 pixels, in bus order if s_wire_swap
+ * is set. The key is the font data or table and not the font_t pointer,
+ * display_printf passes copies of the font.
+ */
+typedef struct {
+    const void *font;
+    uint16_t fg;
+    uint16_t bg;
+    uint16_t glyph;             ///< Glyph index in the font
+    uint8_t width;
+    uint8_t height;
+    uint16_t *pixels;
+    size_t capacity;            ///< Pixels allocated, kept when the slot is reused
+} painter_glyph_t;
+
+#define PAINTER_GLYPH_WAYS 2
+#define PAINTER_GLYPH_SETS (CONFIG_PAINTER_GLYPH_CACHE_ENTRIES / PAINTER_GLYPH_WAYS)
+
+static painter_glyph_t s_glyphs[PAINTER_GLYPH_SETS][PAINTER_GLYPH_WAYS];
+static uint8_t s_glyph_lru[PAINTER_GLYPH_SETS];       ///< Way to replace next in each set
+static uint16_t *s_strip = NULL;                       ///< One line of text, sent with one window
+static size_t s_strip_px = 0;
+
+#define PAINTER_STRIP_PX 4096    ///< Pixels of an expanded image sent with one window at most
+
+/** The strip buffer, grown to at least px pixels */
+static uint16_t *strip_get(size_t px)
+{
+    if (s_strip_px < px) {
+        heap_caps_free(s_strip);
+        s_strip = heap_caps_malloc(px * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        s_strip_px = s_strip ? px : 0;
+    }
+    return s_strip;
+}
+
+/**
+ * Next code point of UTF-8 text. A byte that does not start a complete
+ * sequence is taken as Latin-1, so Latin-1 strings print as well.
+ */
+static uint32_t utf8_next(const char **text)
+{
+    const uint8_t *s = (const uint8_t *)*text;
+    uint32_t cp = s[0];
+    int len = 1;
+
+    if (cp >= 0xC2 && cp <= 0xF4) {
+        int n = cp >= 0xF0 ? 3 : (cp >= 0xE0 ? 2 : 1);
+        uint32_t v = cp & (0x3F >> n);
+        int i = 1;
+        for (; i <= n && (s[i] & 0xC0) == 0x80; i++) {
+            v = v << 6 | (s[i] & 0x3F);
+        }
+        if (i > n) {
+            cp = v;
+            len = n + 1;
+        }
+    }
+    *text += len;
+    return cp;
+}
+
+static int font_find(const painter_font_data_t *data, uint32_t cp)
+{
+    for (int i = 0; i < data->range_num; i++) {
+        const painter_font_range_t *r = &data->ranges[i];
+        if (cp >= r->first && cp - r->first < r->count) {
+            return r->glyph + cp - r->first;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Glyph index of a code point. Control characters are drawn as space,
+ * characters the font does not have as '?' (as space by table fonts).
+ */
+static int glyph_index(const font_t *font, uint32_t cp)
+{
+    if (NULL == font->data) {
+        return (cp >= ' ' && cp <= '~') ? cp - ' ' : 0;
+    }
+    if (cp < ' ' || (cp >= 0x7F && cp < 0xA0)) {
+        cp = ' ';
+    }
+    int glyph = font_find(font->data, cp);
+    if (glyph < 0) {
+        glyph = font_find(font->data, '?');
+    }
+    return glyph < 0 ? 0 : glyph;
+}
+
+/** Width of the glyph's cell, which is also the advance without kerning */
+static inline int glyph_width(const font_t *font, int glyph)
+{
+    return font->data && font->data->advance ? font->data->advance[glyph] : font->Width;
+}
+
+/**
+ * Pixels added to the advance of the left glyph of a pair, the pairs are sorted.
+ * A glyph never moves back past the start of either cell of the pair.
+ */
+static int glyph_kerning(const font_t *font, int left, int right)
+{
+    if (left < 0 || NULL == font->data || NULL == font->data->kerning) {
+        return 0;
+    }
+    const painter_font_kern_t *kern = font->data->kerning;
+    int lo = 0;
+    int hi = font->data->kerning_num - 1;
+    int key = left << 8 | right;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int k = kern[mid].left << 8 | kern[mid].right;
+        if (k == key) {
+            return MAX(kern[mid].adjust, -MIN(glyph_width(font, left), glyph_width(font, right)));
+        }
+        if (k < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return 0;
+}
+
+/** Table fonts store every pixel of the cell */
+static void glyph_expand_table(const font_t *font, int glyph, uint16_t fg, uint16_t bg, uint16_t *buf)
 {
-    PAINTER_CHECK(ascii_char >= ' ', "ACSII code invalid");
-    PAINTER_CHECK(NULL != font, "Font pointer invalid");
-    int i, j;
     uint16_t char_size = font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    unsigned int char_offset = (ascii_char - ' ') * char_size;
-    const unsigned char *ptr = &font->table[char_offset];
-    uint16_t buf[18 * 25];
-    PAINTER_CHECK(font->Height * font->Width * sizeof(uint16_t) <= sizeof(buf), "Font size is too large");
-    painter_set_point_color(color);
+    const unsigned char *ptr = &font->table[glyph * char_size];
     int ox = 0;
     int oy = 0;
 
-    for (i = 0; i < font->Width * font->Height; i++) {
-        buf[i] = g_back_color;
+    for (int i = 0; i < font->Width * font->Height; i++) {
+        buf[i] = bg;
     }
-    for (j = 0; j < char_size; j++) {
+    for (int j = 0; j < char_size; j++) {
         uint8_t temp = ptr[j];
-        for (i = 0; i < 8; i++) {
+        for (int i = 0; i < 8; i++) {
             if (temp & 0x80) {
-                buf[ox + (font->Width * oy)] = g_point_color;
+                buf[ox + (font->Width * oy)] = fg;
             }
             temp <<= 1;
             ox++;
@@ -131,7 +715,202 @@ void painter_draw_char(int x, int y, char ascii_char, const font_t *font, uint16
             }
         }
     }
-    g_lcd.draw_bitmap(x, y, font->Width, font->Height, buf);         // Draw NxN char
+}
+
+/** Packed fonts store the ink box only, the rest of the cell is background */
+static void glyph_expand_packed(const font_t *font, int glyph, int width, uint16_t fg, uint16_t bg, uint16_t *buf)
+{
+    const painter_font_data_t *data = font->data;
+    const painter_glyph_dsc_t *dsc = &data->glyphs[glyph];
+    const uint8_t *bits = &data->bitmap[dsc->offset];
+
+    for (int i = 0; i < width * font->Height; i++) {
+        buf[i] = bg;
+    }
+    uint16_t *row = buf + dsc->y_ofs * width + (data->advance ? data->bearing : dsc->x_ofs);
+    uint32_t bit = 0;
+    for (int y = 0; y < dsc->box_h; y++, row += width) {
+        for (int x = 0; x < dsc->box_w; x++, bit++) {
+            if (bits[bit >> 3] & (0x80 >> (bit & 7))) {
+                row[x] = fg;
+            }
+        }
+    }
+}
+
+/**
+ * Return the pixels of a glyph in the given colors, glyph_width() by
+ * font->Height, or NULL without memory.
+ */
+static const uint16_t *glyph_get(const font_t *font, int glyph, uint16_t fg, uint16_t bg)
+{
+    const void *key = font->data ? (const void *)font->data : (const void *)font->table;
+    int width = glyph_width(font, glyph);
+    uint32_t hash = (uint32_t)(uintptr_t)key ^ (fg * 31u) ^ (bg * 131u) ^ (glyph * 2654435761u);
+    uint32_t set = (hash ^ (hash >> 16)) % PAINTER_GLYPH_SETS;
+    painter_glyph_t *ways = s_glyphs[set];
+
+    for (int w = 0; w < PAINTER_GLYPH_WAYS; w++) {
+        painter_glyph_t *g = &ways[w];
+        if (g->font == key && g->glyph == glyph && g->fg == fg && g->bg == bg &&
+                g->width == width && g->height == font->Height) {
+            s_glyph_lru[set] = !w;
+            return g->pixels;
+        }
+    }
+
+    painter_glyph_t *g = &ways[s_glyph_lru[set]];
+    s_glyph_lru[set] = !s_glyph_lru[set];
+    size_t px = width * font->Height;
+    if (g->capacity < px) {
+        free(g->pixels);
+        g->pixels = malloc(px * sizeof(uint16_t));
+        g->capacity = g->pixels ? px : 0;
+        if (NULL == g->pixels) {
+            g->font = NULL;
+            return NULL;
+        }
+    }
+    g->font = key;
+    g->glyph = glyph;
+    g->fg = fg;
+    g->bg = bg;
+    g->width = width;
+    g->height = font->Height;
+    if (font->data) {
+        glyph_expand_packed(font, glyph, width, painter_px(fg), painter_px(bg), g->pixels);
+    } else {
+        glyph_expand_table(font, glyph, painter_px(fg), painter_px(bg), g->pixels);
+    }
+    return g->pixels;
+}
+
+/**
+ * Number of bytes of the first len bytes of text that fit into max_w pixels,
+ * stopping at the end of the line, and their width.
+ */
+static int text_fit(const char *text, int len, const font_t *font, int max_w, int *width)
+{
+    const char *p = text;
+    int prev = -1;
+    int w = 0;
+
+    while (p - text < len && *p != 0 && *p != '\n') {
+        const char *next = p;
+        int glyph = glyph_index(font, utf8_next(&next));
+        int end = w + glyph_kerning(font, prev, glyph) + glyph_width(font, glyph);
+        if (end > max_w) {
+            break;
+        }
+        w = end;
+        prev = glyph;
+        p = next;
+    }
+    *width = w;
+    return p - text;
+}
+
+int painter_get_text_width(const char *text, const font_t *font)
+{
+    if (NULL == text || NULL == font) {
+        return 0;
+    }
+    int widest = 0;
+    while (1) {
+        int w;
+        text += text_fit(text, INT_MAX, font, INT_MAX, &w);
+        widest = MAX(widest, w);
+        if (*text++ != '\n') {
+            return widest;
+        }
+    }
+}
+
+size_t painter_get_text_advances(const char *text, size_t len, const font_t *font, int16_t *ends)
+{
+    if (NULL == text || NULL == font || NULL == ends) {
+        return 0;
+    }
+    const char *p = text;
+    int prev = -1;
+    int pen = 0;
+
+    while ((size_t)(p - text) < len && *p != 0 && *p != '\n') {
+        const char *c = p;
+        int glyph = glyph_index(font, utf8_next(&p));
+        pen += glyph_kerning(font, prev, glyph) + glyph_width(font, glyph);
+        prev = glyph;
+        /* a character cut by len is measured as far as it goes */
+        if ((size_t)(p - text) > len) {
+            p = text + len;
+        }
+        for (; c < p; c++) {
+            ends[c - text] = pen;
+        }
+    }
+    return p - text;
+}
+
+/** Draw len bytes of text side by side with one window */
+static void painter_draw_run(int x, int y, const char *text, int len, const font_t *font, uint16_t color)
+{
+    if (len <= 0) {
+        return;
+    }
+    /* characters past the right edge can not be drawn by the controller */
+    int strip_w;
+    const char *end = text + text_fit(text, len, font, target_width() - x, &strip_w);
+    if (strip_w <= 0) {
+        return;
+    }
+
+    PAINTER_CHECK(NULL != strip_get(strip_w * font->Height), "Memory not enough");
+
+    uint16_t bg = painter_px(g_back_color);
+    int pen = 0;
+    int prev = -1;
+    for (const char *p = text; p < end;) {
+        int glyph = glyph_index(font, utf8_next(&p));
+        /* a tightened glyph overlaps the cell before it, only its ink is copied
+         * there; a loosened one leaves a gap in the background color */
+        int kern = glyph_kerning(font, prev, glyph);
+        int overlap = MAX(-kern, 0);
+        int gap = MAX(kern, 0);
+        int w = glyph_width(font, glyph);
+        const uint16_t *pixels = glyph_get(font, glyph, color, g_back_color);
+        PAINTER_CHECK(NULL != pixels, "Memory not enough");
+        for (int row = 0; gap > 0 && row < font->Height; row++) {
+            for (int i = 0; i < gap; i++) {
+                s_strip[row * strip_w + pen + i] = bg;
+            }
+        }
+        pen += gap - overlap;
+        uint16_t *dst = &s_strip[pen];
+        for (int row = 0; row < font->Height; row++) {
+            for (int i = 0; i < overlap; i++) {
+                if (pixels[i] != bg) {
+                    dst[i] = pixels[i];
+                }
+            }
+            memcpy(dst + overlap, pixels + overlap, (w - overlap) * sizeof(uint16_t));
+            dst += strip_w;
+            pixels += w;
+        }
+        pen += w;
+        prev = glyph;
+    }
+    painter_blit(x, y, strip_w, font->Height, s_strip, s_wire_swap);
+}
+
+void painter_draw_char(int x, int y, char ascii_char, const font_t *font, uint16_t color)
+{
+    PAINTER_CHECK((uint8_t)ascii_char >= ' ', "ACSII code invalid");
+    PAINTER_CHECK(NULL != font, "Font pointer invalid");
+    painter_set_point_color(color);
+    int glyph = glyph_index(font, (uint8_t)ascii_char);
+    const uint16_t *pixels = glyph_get(font, glyph, g_point_color, g_back_color);
+    PAINTER_CHECK(NULL != pixels, "Memory not enough");
+    painter_blit(x, y, glyph_width(font, glyph), font->Height, pixels, s_wire_swap);
 }
 
 void painter_draw_string(int x, int y, const char *text, const font_t *font, uint16_t color)
@@ -143,24 +922,46 @@ void painter_draw_string(int x, int y, const char *text, const font_t *font, uin
     uint16_t y0 = y;
     scr_info_t info;
     g_lcd.get_info(&info);
+    painter_set_point_color(color);
+
+    /* consecutive characters on the same line are collected and drawn at once */
+    const char *run = p_text;
+    int run_x = x;
+    int run_len = 0;
+    int prev = -1;
 
     while (*p_text != 0) {
-        if (x > (x0 + info.width - font->Width)) {
+        const char *c = p_text;
+        uint32_t cp = utf8_next(&p_text);
+        if (cp == '\n') {
+            painter_draw_run(run_x, y, run, run_len, font, color);
+            run_len = 0;
+            y += font->Height;
+            x = x0;
+            continue;
+        }
+        int glyph = glyph_index(font, cp);
+        int w = glyph_width(font, glyph);
+        int kern = run_len ? glyph_kerning(font, prev, glyph) : 0;
+        if (x + kern + w > x0 + info.width) {
+            painter_draw_run(run_x, y, run, run_len, font, color);
+            run_len = 0;
             y += font->Height;
             x = x0;
+            kern = 0;
         }
         if (y > (y0 + info.height - font->Height)) {
             break;
         }
-        if (*p_text == '\n') {
-            y += font->Height;
-            x = x0;
-        } else {
-            painter_draw_char(x, y, *p_text, font, color);
+        if (run_len == 0) {
+            run = c;
+            run_x = x;
         }
-        x += font->Width;
-        p_text++;
+        run_len += p_text - c;
+        x += kern + w;
+        prev = glyph;
     }
+    painter_draw_run(run_x, y, run, run_len, font, color);
 }
 
 void painter_draw_num(int x, int y, uint32_t num, uint8_t len, const font_t *font, uint16_t color)
@@ -172,91 +973,130 @@ void painter_draw_num(int x, int y, uint32_t num, uint8_t len, const font_t *fon
 
     itoa(num, buf, 10);
     num_len = strlen(buf);
-    x += (font->Width * (len - 1));
+    for (size_t i = num_len; i < len; i++) {
+        buf[i] = '0';
+    }
 
+    /* proportional fonts have digits of their own width, start from the right end */
     for (size_t i = 0; i < len; i++) {
-        if (i < num_len) {
-            painter_draw_char(x, y, buf[i], font, color);
-        } else {
-            painter_draw_char(x, y, '0', font, color);
-        }
-
-        x -= font->Width;
+        x += glyph_width(font, glyph_index(font, (uint8_t)buf[i]));
+    }
+    for (size_t i = 0; i < len; i++) {
+        x -= glyph_width(font, glyph_index(font, (uint8_t)buf[i]));
+        painter_draw_char(x, y, buf[i], font, color);
     }
 }
 
 void painter_draw_image(int x, int y, int width, int height, uint16_t *img)
 {
     PAINTER_CHECK(NULL != img, "Image pointer invalid");
-    g_lcd.draw_bitmap(x, y, width, height, img);
+    painter_blit(x, y, width, height, img, false);
 }
 
-void painter_draw_horizontal_line(int x, int y, int line_length, uint16_t color)
+void painter_draw_image_wire(int x, int y, int width, int height, const uint16_t *img)
+{
+    PAINTER_CHECK(NULL != img, "Image pointer invalid");
+    painter_blit(x, y, width, height, img, s_wire_swap);
+}
+
+bool painter_get_wire_swap(void)
 {
-    int i;
+    return s_wire_swap;
+}
 
-    for (i = x; i < x + line_length; i++) {
-        g_lcd.draw_pixel(i, y, color);
+void painter_draw_image_rle(int x, int y, int width, int height, const uint16_t *rle)
+{
+    PAINTER_CHECK(NULL != rle && width > 0 && height > 0, "Image invalid");
+    const int rows = MIN(height, MAX(1, PAINTER_STRIP_PX / width));
+    uint16_t *strip = strip_get(rows * width);
+    PAINTER_CHECK(NULL != strip, "Memory not enough");
+
+    /* a run or literal may go on in the next strip */
+    int left = 0;
+    bool repeat = false;
+    for (int row = 0; row < height; row += rows) {
+        int n = MIN(rows, height - row);
+        uint16_t *dst = strip;
+        uint16_t *end = strip + n * width;
+        while (dst < end) {
+            if (0 == left) {
+                repeat = *rle & 0x8000;
+                left = *rle++ & 0x7FFF;
+                continue;
+            }
+            int k = MIN(left, end - dst);
+            left -= k;
+            if (repeat) {
+                uint16_t c = painter_px(*rle);
+                while (k--) {
+                    *dst++ = c;
+                }
+                rle += 0 == left;
+            } else {
+                while (k--) {
+                    *dst++ = painter_px(*rle++);
+                }
+            }
+        }
+        painter_blit(x, y + row, width, n, strip, s_wire_swap);
     }
 }
 
-void painter_draw_vertical_line(int x, int y, int line_length, uint16_t color)
+void painter_draw_horizontal_line(int x, int y, int line_length, uint16_t color)
 {
-    int i;
+    painter_hspan(x, y, line_length, color);
+}
 
-    for (i = y; i < y + line_length; i++) {
-        g_lcd.draw_pixel(x, i, color);
-    }
+void painter_draw_vertical_line(int x, int y, int line_length, uint16_t color)
+{
+    painter_vspan(x, y, line_length, color);
 }
 
 void painter_draw_line(int x1, int y1, int x2, int y2, uint16_t color)
 {
-    uint16_t t;
-    int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-    int incx, incy, uRow, uCol;
-    delta_x = x2 - x1;
-    delta_y = y2 - y1;
-    uRow = x1;
-    uCol = y1;
-
-    if (delta_x > 0) {
-        incx = 1;    //set direction
-    } else if (delta_x == 0) {
-        incx = 0;    //vertical line
-    } else {
-        incx = -1;
-        delta_x = -delta_x;
-    }
-
-    if (delta_y > 0) {
-        incy = 1;
-    } else if (delta_y == 0) {
-        incy = 0;    //horizontal line
-    } else {
-        incy = -1;
-        delta_y = -delta_y;
+    if (y1 == y2) {
+        painter_hspan(MIN(x1, x2), y1, abs(x2 - x1) + 1, color);
+        return;
     }
-
-    if (delta_x > delta_y) {
-        distance = delta_x;
-    } else {
-        distance = delta_y;
+    if (x1 == x2) {
+        painter_vspan(x1, MIN(y1, y2), abs(y2 - y1) + 1, color);
+        return;
     }
 
-    for (t = 0; t <= distance + 1; t++) {
-        g_lcd.draw_pixel(uRow, uCol, color);
-        xerr += delta_x ;
-        yerr += delta_y ;
-
-        if (xerr > distance) {
-            xerr -= distance;
-            uRow += incx;
+    /* Bresenham, pixels that share a row (or a column for steep lines) are sent as one span */
+    int dx = abs(x2 - x1), incx = x1 < x2 ? 1 : -1;
+    int dy = -abs(y2 - y1), incy = y1 < y2 ? 1 : -1;
+    int err = dx + dy;
+    bool steep = -dy > dx;
+    int run_x = x1, run_y = y1, run_len = 1;
+
+    while (x1 != x2 || y1 != y2) {
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += incx;
         }
-
-        if (yerr > distance) {
-            yerr -= distance;
-            uCol += incy;
+        if (e2 <= dx) {
+            err += dx;
+            y1 += incy;
+        }
+        if (steep ? x1 == run_x : y1 == run_y) {
+            run_len++;
+            continue;
         }
+        if (steep) {
+            painter_vspan(run_x, incy > 0 ? run_y : run_y - run_len + 1, run_len, color);
+        } else {
+            painter_hspan(incx > 0 ? run_x : run_x - run_len + 1, run_y, run_len, color);
+        }
+        run_x = x1;
+        run_y = y1;
+        run_len = 1;
+    }
+    if (steep) {
+        painter_vspan(run_x, incy > 0 ? run_y : run_y - run_len + 1, run_len, color);
+    } else {
+        painter_hspan(incx > 0 ? run_x : run_x - run_len + 1, run_y, run_len, color);
     }
 }
 
@@ -277,122 +1117,220 @@ void painter_draw_rectangle(int x0, int y0, int x1, int y1, uint16_t color)
 void painter_draw_filled_rectangle(int x0, int y0, int x1, int y1, uint16_t color)
 {
     int min_x, min_y, max_x, max_y;
-    int i;
     min_x = x1 > x0 ? x0 : x1;
     max_x = x1 > x0 ? x1 : x0;
     min_y = y1 > y0 ? y0 : y1;
     max_y = y1 > y0 ? y1 : y0;
 
-    for (i = min_x; i <= max_x; i++) {
-        painter_draw_vertical_line(i, min_y, max_y - min_y + 1, color);
-    }
+    painter_fill(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1, color);
 }
 
-void painter_draw_circle(int x, int y, int radius, uint16_t color)
+/**
+ * Midpoint circle. While x_pos stays the same the points of the flat octants
+ * share a row and those of the steep octants share a column, each such run is
+ * sent as one span. Filled circles are drawn as one span per row.
+ */
+static void painter_circle_spans(int x, int y, int radius, uint16_t color, bool filled)
 {
-    /* Bresenham algorithm */
-    int x_pos = -radius;
+    int x_pos = radius;
     int y_pos = 0;
-    int err = 2 - 2 * radius;
-    int e2;
-
-    do {
-        g_lcd.draw_pixel(x - x_pos, y + y_pos, color);
-        g_lcd.draw_pixel(x + x_pos, y + y_pos, color);
-        g_lcd.draw_pixel(x + x_pos, y - y_pos, color);
-        g_lcd.draw_pixel(x - x_pos, y - y_pos, color);
-        e2 = err;
-
-        if (e2 <= y_pos) {
-            err += ++y_pos * 2 + 1;
+    int err = 1 - radius;
+    int run_start = 0;      // first y_pos drawn with the current x_pos
+
+    while (x_pos >= y_pos) {
+        int next_x = x_pos;
+        int next_y = y_pos + 1;
+        if (err < 0) {
+            err += 2 * next_y + 1;
+        } else {
+            next_x--;
+            err += 2 * (next_y - next_x) + 1;
+        }
+        bool run_end = next_x != x_pos || next_x < next_y;
 
-            if (-x_pos == y_pos && e2 <= x_pos) {
-                e2 = 0;
+        if (filled) {
+            painter_hspan(x - x_pos, y + y_pos, 2 * x_pos + 1, color);
+            if (y_pos) {
+                painter_hspan(x - x_pos, y - y_pos, 2 * x_pos + 1, color);
+            }
+            if (run_end && x_pos != y_pos) {
+                painter_hspan(x - y_pos, y + x_pos, 2 * y_pos + 1, color);
+                painter_hspan(x - y_pos, y - x_pos, 2 * y_pos + 1, color);
             }
+        } else if (run_end) {
+            int len = y_pos - run_start + 1;
+            painter_hspan(x + run_start, y + x_pos, len, color);
+            painter_hspan(x - y_pos, y + x_pos, len, color);
+            painter_hspan(x + run_start, y - x_pos, len, color);
+            painter_hspan(x - y_pos, y - x_pos, len, color);
+            painter_vspan(x + x_pos, y + run_start, len, color);
+            painter_vspan(x + x_pos, y - y_pos, len, color);
+            painter_vspan(x - x_pos, y + run_start, len, color);
+            painter_vspan(x - x_pos, y - y_pos, len, color);
         }
-
-        if (e2 > x_pos) {
-            err += ++x_pos * 2 + 1;
+        if (run_end) {
+            run_start = next_y;
         }
-    } while (x_pos <= 0);
+        x_pos = next_x;
+        y_pos = next_y;
+    }
+}
+
+void painter_draw_circle(int x, int y, int radius, uint16_t color)
+{
+    painter_circle_spans(x, y, radius, color, false);
 }
 
 void painter_draw_filled_circle(int x, int y, int radius, uint16_t color)
 {
-    /* Bresenham algorithm */
-    int x_pos = -radius;
-    int y_pos = 0;
-    int err = 2 - 2 * radius;
-    int e2;
-
-    do {
-        g_lcd.draw_pixel(x - x_pos, y + y_pos, color);
-        g_lcd.draw_pixel(x + x_pos, y + y_pos, color);
-        g_lcd.draw_pixel(x + x_pos, y - y_pos, color);
-        g_lcd.draw_pixel(x - x_pos, y - y_pos, color);
-        painter_draw_horizontal_line(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, color);
-        painter_draw_horizontal_line(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, color);
-        e2 = err;
-
-        if (e2 <= y_pos) {
-            err += ++y_pos * 2 + 1;
-
-            if (-x_pos == y_pos && e2 <= x_pos) {
-                e2 = 0;
-            }
+    painter_circle_spans(x, y, radius, color, true);
+}
+
+static int s_height_current = 0; //current line on screen
+
+/**
+ * The lines of the display_printf() log on the screen. They are only drawn
+ * again when the screen scrolls without painter_scroll(), on a driver without
+ * hardware scrolling and without framebuffer, and only kept there. A driver
+ * that turns out not to scroll clears the screen once before the log starts.
+ */
+#define DISPLAY_PRINTF_LOG_LINES 32
+#define DISPLAY_PRINTF_LOG_TEXT 96
+
+typedef struct {
+    font_t font;
+    int16_t y;
+    uint16_t color;
+    char text[DISPLAY_PRINTF_LOG_TEXT];
+} display_log_line_t;
+
+static display_log_line_t *s_log;   ///< Ring of lines, oldest at s_log_first
+static int s_log_first;
+static int s_log_num;
+
+static inline void _display_printf_lock_init(void)
+{
+    if (unlikely(!s_log_mutex)) {
+        s_log_mutex = xSemaphoreCreateMutex();
+    }
+}
+
+/** painter_scroll() can move the whole screen, so there is no need to draw it again */
+static bool display_log_scrolls(void)
+{
+    return s_canvas.buf || (g_lcd.set_scroll_area && g_lcd.set_scroll_start && !s_scroll.failed);
+}
+
+static void display_log_add(const font_t *font, uint16_t color, int y, const char *msg)
+{
+    if (NULL == s_log) {
+        if (display_log_scrolls()) {
+            return;
+        }
+        s_log = calloc(DISPLAY_PRINTF_LOG_LINES, sizeof(display_log_line_t));
+        if (NULL == s_log) {
+            return;
         }
+    }
+    if (s_log_num == DISPLAY_PRINTF_LOG_LINES) {
+        s_log_first = (s_log_first + 1) % DISPLAY_PRINTF_LOG_LINES;
+        s_log_num--;
+    }
+    display_log_line_t *line = &s_log[(s_log_first + s_log_num++) % DISPLAY_PRINTF_LOG_LINES];
+    line->font = *font;
+    line->y = y;
+    line->color = color;
+    snprintf(line->text, sizeof(line->text), "%s", msg);
+}
+
+/** Scroll by drawing the log again, lines moved partly off the top are dropped */
+static void display_log_redraw(int rows)
+{
+    painter_clear(g_back_color);
+    while (s_log_num && s_log[s_log_first].y < rows) {
+        s_log_first = (s_log_first + 1) % DISPLAY_PRINTF_LOG_LINES;
+        s_log_num--;
+    }
+    for (int i = 0; i < s_log_num; i++) {
+        display_log_line_t *line = &s_log[(s_log_first + i) % DISPLAY_PRINTF_LOG_LINES];
+        line->y -= rows;
+        painter_draw_string(0, line->y, line->text, &line->font, line->color);
+    }
+}
+
+void display_printf_draw_clear(void)
+{
+    painter_clear(g_back_color);
+    s_height_current = 0;
+    s_log_num = 0;
+}
 
-        if (e2 > x_pos) {
-            err += ++x_pos * 2 + 1;
+void display_printf_draw(const font_t *font, uint16_t color, const char *msg)
+{
+    int over = s_height_current + font->Height - g_screen_height;
+    if (over > 0) {
+        /* the whole screen scrolls, one line costs the line and a register write */
+        if (ESP_OK == painter_scroll(0, g_screen_height, over, g_back_color)) {
+            s_height_current -= over;
+        } else if (s_log) {
+            display_log_redraw(over);
+            s_height_current -= over;
+        } else {
+            painter_clear(g_back_color);
+            s_height_current = 0;
         }
-    } while (x_pos <= 0);
+    }
+    painter_draw_string(0, s_height_current, msg, font, color);
+    display_log_add(font, color, s_height_current, msg);
+    s_height_current += font->Height;
 }
 
-static int s_height_current = 0; //current line on screen
+void display_printf_draw_line(const font_t *font, uint16_t line, uint16_t color, const char *msg)
+{
+    painter_draw_string(0, line * font->Height, msg, font, color);
+}
 
 static inline void _display_printf_clear(void)
 {
+    if (display_server_running()) {
+        display_server_clear();
+        return;
+    }
+    _display_printf_lock_init();
     if (xSemaphoreTake(s_log_mutex, portMAX_DELAY) != pdTRUE) {
         ESP_LOGE(TAG, "clear failed");
         return;
     }
-    painter_clear(g_back_color);
-    s_height_current = 0;
+    display_printf_draw_clear();
+    painter_flush();
     xSemaphoreGive(s_log_mutex);
 }
 
 static void _display_printfv(display_level_t level, const char *tag, uint16_t color, const char *format, va_list args)
 {
-    if (unlikely(!s_log_mutex)) {
-        s_log_mutex = xSemaphoreCreateMutex();
-    }
-
-    if (xSemaphoreTake(s_log_mutex, DISPLAY_MAX_MUTEX_WAIT_MS / portTICK_RATE_MS) != pdTRUE) {
-        ESP_LOGW(tag, "display printf timeout");
-        return;
-    }
-    font_t font = s_font;
-    int height_step = font.Height;
+    font_t font = display_printf_get_font();
     uint32_t max_char_num = g_screen_width / font.Width;
     char *msg = calloc(max_char_num + 1  , 1);
     vsnprintf(msg, max_char_num, format, args);
-    if (s_height_current + height_step > g_screen_height) {
-        painter_clear(g_back_color);
-        s_height_current = 0;
+    if (display_server_running()) {
+        /* the display task draws it, this task does not wait for the screen */
+        if (display_server_print(&font, color, msg) != ESP_OK) {
+            ESP_LOGW(tag, "display queue full");
+        }
+    } else if (xSemaphoreTake(s_log_mutex, DISPLAY_MAX_MUTEX_WAIT_MS / portTICK_RATE_MS) != pdTRUE) {
+        ESP_LOGW(tag, "display printf timeout");
+    } else {
+        display_printf_draw(&font, color, msg);
+        painter_flush();
+        xSemaphoreGive(s_log_mutex);
     }
-    painter_draw_string(0, s_height_current, msg, &font, color);
-    s_height_current += height_step;
-    xSemaphoreGive(s_log_mutex);
     ESP_LOGI(tag, "%s", msg);
     free(msg);
 }
 
 void display_printf_set_font(font_t font)
 {
-    if (unlikely(!s_log_mutex)) {
-        s_log_mutex = xSemaphoreCreateMutex();
-    }
-
+    _display_printf_lock_init();
     if (xSemaphoreTake(s_log_mutex, portMAX_DELAY) != pdTRUE) {
         ESP_LOGE(TAG, "font set failed");
         return;
@@ -403,10 +1341,7 @@ void display_printf_set_font(font_t font)
 
 font_t display_printf_get_font()
 {
-    if (unlikely(!s_log_mutex)) {
-        s_log_mutex = xSemaphoreCreateMutex();
-    }
-
+    _display_printf_lock_init();
     if (xSemaphoreTake(s_log_mutex, portMAX_DELAY) != pdTRUE) {
         ESP_LOGE(TAG, "font set failed");
         return s_font;
@@ -431,21 +1366,11 @@ void display_printf(display_level_t level, const char *tag, uint16_t color, cons
 
 void display_printf_line(const char *tag, uint16_t line, uint16_t color, const char *format, ...)
 {
-    if (unlikely(!s_log_mutex)) {
-        s_log_mutex = xSemaphoreCreateMutex();
-    }
-
-    if (xSemaphoreTake(s_log_mutex, DISPLAY_MAX_MUTEX_WAIT_MS / portTICK_RATE_MS) != pdTRUE) {
-        ESP_LOGW(tag, "display printf timeout");
-        return;
-    }
-
-    font_t font = s_font;
+    font_t font = display_printf_get_font();
     int height_step = font.Height;
     int height_current = line * height_step;
     if (height_current + height_step > g_screen_height) {
         ESP_LOGE(tag, "display height overflow");
-        xSemaphoreGive(s_log_mutex);
         return;
     }
 
@@ -455,43 +1380,152 @@ void display_printf_line(const char *tag, uint16_t line, uint16_t color, const c
     va_start(args, format);
     vsnprintf(msg, max_char_num, format, args);
     va_end(args);
-    painter_draw_string(0, height_current, msg, &font, color);
-    xSemaphoreGive(s_log_mutex);
+    if (display_server_running()) {
+        /* a newer text for the line replaces this one if it is still queued */
+        if (display_server_print_line(&font, line, color, msg) != ESP_OK) {
+            ESP_LOGW(tag, "display queue full");
+        }
+    } else if (xSemaphoreTake(s_log_mutex, DISPLAY_MAX_MUTEX_WAIT_MS / portTICK_RATE_MS) != pdTRUE) {
+        ESP_LOGW(tag, "display printf timeout");
+    } else {
+        display_printf_draw_line(&font, line, color, msg);
+        painter_flush();
+        xSemaphoreGive(s_log_mutex);
+    }
     ESP_LOGI(tag, "char_num=%d: %s", max_char_num, msg);
     free(msg);
 }
 
+/**
+ * QR codes are kept as one bit per module, row by row, MSB first. The last
+ * few texts drawn with painter_draw_qr_code() stay cached, so showing a page
+ * again does not encode its code again.
+ */
+#define PAINTER_QR_SIZE_MAX (10 * 4 + 17)                 ///< Modules of a version 10 code
+#define PAINTER_QR_STRIDE_MAX ((PAINTER_QR_SIZE_MAX + 7) / 8)
+#define PAINTER_QR_CACHE_ENTRIES 2
+#define PAINTER_QR_DRAW_MAX 200                           ///< Pixels the modules are scaled to fit in
+
+typedef struct {
+    char *text;                 ///< Payload the modules were encoded from, NULL when unused
+    uint8_t size;
+    uint8_t bits[PAINTER_QR_SIZE_MAX * PAINTER_QR_STRIDE_MAX];
+} painter_qr_t;
+
+static painter_qr_t s_qr_cache[PAINTER_QR_CACHE_ENTRIES];
+static uint8_t s_qr_next;                   ///< Cache entry to replace next
+static painter_qr_t s_qr_scratch;           ///< Codes drawn without painter_draw_qr_code()
+static painter_qr_t *s_qr_pending;          ///< Where the display function stores the modules
+
+static inline bool qr_module(const painter_qr_t *qr, int x, int y)
+{
+    return qr->bits[y * ((qr->size + 7) / 8) + x / 8] >> (7 - x % 8) & 1;
+}
+
+/**
+ * Draw the modules scaled by an integer factor. Each module row is expanded
+ * run by run into one row of pixels and repeated for the module height,
+ * several module rows go out with one window.
+ */
+static void qr_draw(const painter_qr_t *qr)
+{
+    const int size = qr->size;
+    const int block_width = PAINTER_QR_DRAW_MAX / size;
+    const int block_height = PAINTER_QR_DRAW_MAX / size;
+    const int border_x = (36 + PAINTER_QR_DRAW_MAX - block_width * size) / block_width / 2;
+    const int border_y = 1;
+    const int w = size * block_width;
+    const int h = size * block_height;
+    const int x0 = border_x * block_width;
+    const int y0 = border_y * block_height;
+    /* the rest of the screen is black, the code itself is sent once */
+    painter_fill(0, 0, target_width(), y0, COLOR_BLACK);
+    painter_fill(0, y0 + h, target_width(), target_height() - y0 - h, COLOR_BLACK);
+    painter_fill(0, y0, x0, h, COLOR_BLACK);
+    painter_fill(x0 + w, y0, target_width() - x0 - w, h, COLOR_BLACK);
+
+    const int rows = MAX(1, PAINTER_STRIP_PX / (w * block_height));
+    uint16_t *strip = strip_get(rows * block_height * w);
+    PAINTER_CHECK(NULL != strip, "Memory not enough");
+    const uint16_t white = painter_px(COLOR_WHITE);
+    const uint16_t black = painter_px(COLOR_BLACK);
+
+    for (int row = 0; row < size; row += rows) {
+        int n = MIN(rows, size - row);
+        uint16_t *dst = strip;
+        for (int y = row; y < row + n; y++) {
+            const uint16_t *line = dst;
+            for (int x = 0; x < size;) {
+                bool on = qr_module(qr, x, y);
+                int run = 1;
+                while (x + run < size && qr_module(qr, x + run, y) == on) {
+                    run++;
+                }
+                uint16_t c = on ? white : black;
+                for (int i = run * block_width; i > 0; i--) {
+                    *dst++ = c;
+                }
+                x += run;
+            }
+            for (int r = 1; r < block_height; r++) {
+                memcpy(dst, line, w * sizeof(uint16_t));
+                dst += w;
+            }
+        }
+        painter_blit(x0, y0 + row * block_height, w, n * block_height, strip, s_wire_swap);
+    }
+    painter_flush();
+}
+
 void painter_draw_qr_code_v10(esp_qrcode_handle_t qrcode)
 {
     esp_qrcode_print_console(qrcode);
-    painter_clear(COLOR_BLACK);
+    painter_qr_t *qr = s_qr_pending ? s_qr_pending : &s_qr_scratch;
     int size = esp_qrcode_get_size(qrcode);
-    int border_x = 2;
-    int border_y = 1;
-#define draw_width_max 200
-#define draw_height_max 200
-#define buffer_width_max (draw_width_max / 21)
-#define buffer_height_max (draw_height_max / 21)
-    uint16_t buf_white[buffer_width_max * buffer_height_max] = {0};
-    uint16_t buf_black[buffer_width_max * buffer_height_max] = {0};
-    uint16_t *buf;
-
-    const uint16_t block_width = draw_width_max / size;
-    const uint16_t block_height = draw_height_max / size;
-    border_x = (36 + draw_width_max - block_width * size) / block_width / 2;
-
-    for (uint16_t i = 0; i < block_width * block_height; i++) {
-        buf_white[i] = COLOR_WHITE;
-        buf_black[i] = COLOR_BLACK;
-    }
-
-    for (int y = -border_y; y < size + border_y; y++) {
-        for (int x = -border_x; x < size + border_x; x++) {
-            buf = buf_black;
+    PAINTER_CHECK(size > 0 && size <= PAINTER_QR_SIZE_MAX, "QR code too large");
+    int stride = (size + 7) / 8;
+    qr->size = size;
+    memset(qr->bits, 0, size * stride);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
             if (esp_qrcode_get_module(qrcode, x, y)) {
-                buf = buf_white;
+                qr->bits[y * stride + x / 8] |= 0x80 >> (x % 8);
             }
-            g_lcd.draw_bitmap((x + border_x) * block_width, (y + border_y) * block_height, block_width, block_height, buf); 
         }
     }
-}
\ No newline at end of file
+    qr_draw(qr);
+}
+
+esp_err_t painter_draw_qr_code(const char *text)
+{
+    if (NULL == text) {
+        ESP_LOGE(TAG, "QR code text invalid");
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < PAINTER_QR_CACHE_ENTRIES; i++) {
+        if (s_qr_cache[i].text && 0 == strcmp(s_qr_cache[i].text, text)) {
+            qr_draw(&s_qr_cache[i]);
+            return ESP_OK;
+        }
+    }
+
+    painter_qr_t *qr = &s_qr_cache[s_qr_next];
+    free(qr->text);
+    qr->text = NULL;
+    esp_qrcode_config_t cfg = PAINTER_QRCODE_CONFIG_DEFAULT();
+    s_qr_pending = qr;
+    qr->size = 0;
+    esp_err_t ret = esp_qrcode_generate(&cfg, text);
+    s_qr_pending = NULL;
+    if (ESP_OK != ret || 0 == qr->size) {
+        ESP_LOGE(TAG, "QR code encoding failed");
+        return ESP_FAIL;
+    }
+    /* drawn already, only the cache entry is lost without memory */
+    qr->text = strdup(text);
+    if (NULL == qr->text) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_qr_next = (s_qr_next + 1) % PAINTER_QR_CACHE_ENTRIES;
+    return ESP_OK;
+}
@@ -17,6 +17,9 @@
 #include "painter_fonts.h"
 #include "qrcode.h"
 
+/* painter_get_text_width() is available, checked by code shared with older painters */
+#define HAVE_PAINTER_GET_TEXT_WIDTH 1
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -32,6 +35,36 @@ extern "C" {
  */
 esp_err_t painter_init(scr_driver_t *driver);
 
+/**
+ * @brief Send the regions changed since the last flush to the screen
+ *
+ * @note Only needed with CONFIG_PAINTER_FRAMEBUFFER_ENABLE, where all drawing goes to
+ *       a RAM framebuffer. Without it the painter draws directly and this does nothing.
+ *       display_printf and the QR code display function flush by themselves.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed to write the screen
+ */
+esp_err_t painter_flush(void);
+
+/**
+ * @brief Draw into a RGB565 buffer instead of the screen
+ *
+ * All painter functions draw into the buffer until it is reset with NULL,
+ * pixels outside of it are clipped. Once reset, the buffer can be sent to
+ * the screen with painter_draw_image().
+ *
+ * @param buffer RGB565 pixels row by row, NULL to draw to the screen again
+ * @param width width of the buffer in pixels
+ * @param height height of the buffer in pixels
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG Size is 0
+ */
+esp_err_t painter_set_canvas(uint16_t *buffer, uint16_t width, uint16_t height);
+
 /**
  * @brief Set point color
  * 
@@ -71,12 +104,31 @@ uint16_t painter_get_back_color(void);
  */
 void painter_clear(uint16_t color);
 
+/**
+ * @brief Scroll rows y to y + h - 1 up, the rows that come in at the bottom get one color
+ *
+ * A screen driver with set_scroll_area scrolls in the controller, only the new
+ * rows are sent. Otherwise the rows of the framebuffer or canvas are moved and
+ * sent again on flush. Drawing keeps using screen coordinates either way.
+ *
+ * @param y First row of the area, keep it the same between calls
+ * @param h Rows of the area
+ * @param lines Rows to scroll up
+ * @param color Color of the new rows
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG Area outside of the screen
+ *      - ESP_ERR_NOT_SUPPORTED Neither the screen nor the painter can scroll, redraw the area
+ */
+esp_err_t painter_scroll(int y, int h, int lines, uint16_t color);
+
 /**
  * @brief Draw a character on screen
  * 
  * @param x Starting point in X direction
  * @param y Starting point in Y direction
- * @param ascii_char ASCII characters to display
+ * @param ascii_char Character to display, Latin-1 above 0x7F
  * @param font Pointer to a font
  * @param color Color to display
  */
@@ -87,12 +139,37 @@ void painter_draw_char(int x, int y, char ascii_char, const font_t* font, uint16
  * 
  * @param x Starting point in X direction
  * @param y Starting point in Y direction
- * @param text ASCII string to display
+ * @param text UTF-8 string to display, '\n' starts a new line and long lines wrap
  * @param font Pointer to a font
  * @param color Color to display
  */
 void painter_draw_string(int x, int y, const char* text, const font_t* font, uint16_t color);
 
+/**
+ * @brief Get the width of a string as painter_draw_string() draws it
+ *
+ * @param text UTF-8 string
+ * @param font Pointer to a font
+ *
+ * @return Width of the widest line in pixels, without wrapping
+ */
+int painter_get_text_width(const char *text, const font_t *font);
+
+/**
+ * @brief Get the width of a string after each of its characters
+ *
+ * Lets layout code find all line breaks of a text in one pass instead of
+ * measuring every candidate line with painter_get_text_width().
+ *
+ * @param text UTF-8 string
+ * @param len Bytes to measure at most, the line also ends at '\0' and '\n'
+ * @param font Pointer to a font
+ * @param ends ends[i] is the width up to and including the character that byte i belongs to, kerning included
+ *
+ * @return Bytes measured
+ */
+size_t painter_get_text_advances(const char *text, size_t len, const font_t *font, int16_t *ends);
+
 /**
  * @brief Draw a number on screen
  * 
@@ -129,6 +206,40 @@ void painter_draw_float(int x, int y, uint32_t num, uint8_t len, uint8_t point,
  */
 void painter_draw_image(int x, int y, int width, int height, uint16_t *img);
 
+/**
+ * @brief Draw a image stored in the byte order of the screen bus
+ *
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param width width of image
+ * @param height height of image
+ * @param img RGB565 pixels, high byte first if painter_get_wire_swap() is true
+ */
+void painter_draw_image_wire(int x, int y, int width, int height, const uint16_t *img);
+
+/**
+ * @brief Whether painter_draw_image_wire() takes pixels high byte first
+ *
+ * True when the screen driver sends such pixels without swapping them.
+ */
+bool painter_get_wire_swap(void);
+
+/**
+ * @brief Draw a run-length encoded image
+ *
+ * The image is a sequence of uint16_t. A count with bit 15 set is followed by
+ * one pixel repeated count & 0x7FFF times, a count without it by that many
+ * pixels. Pixels are RGB565 like those of painter_draw_image(). The image is
+ * read while it is drawn, it can stay in memory mapped flash.
+ *
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param width width of image
+ * @param height height of image
+ * @param rle encoded pixels, row by row
+ */
+void painter_draw_image_rle(int x, int y, int width, int height, const uint16_t *rle);
+
 /**
  * @brief Draw a horizontal line on screen
  * 
@@ -203,12 +314,28 @@ void painter_draw_circle(int x, int y, int radius, uint16_t color);
 void painter_draw_filled_circle(int x, int y, int radius, uint16_t color);
 
 /**
-  * @brief  Displays QR Code on the console
+  * @brief  Displays QR Code on the console and the screen
   *
   * @param  qrcode  QR Code handle used by the display function.
   */
 void painter_draw_qr_code_v10(esp_qrcode_handle_t qrcode);
 
+/**
+ * @brief Clear the screen and draw the QR code of a text, like painter_draw_qr_code_v10()
+ *
+ * The modules of the last two texts are cached, drawing one of them again
+ * does not encode it again.
+ *
+ * @param text Payload of the code, up to version 10 with low error correction
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG text is NULL
+ *      - ESP_ERR_NO_MEM Drawn, but not cached
+ *      - ESP_FAIL The text does not fit a version 10 code
+ */
+esp_err_t painter_draw_qr_code(const char *text);
+
 #define PAINTER_QRCODE_CONFIG_DEFAULT() (esp_qrcode_config_t) { \
     .display_func = painter_draw_qr_code_v10, \
     .max_qrcode_version = 10, \
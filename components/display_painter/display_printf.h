@@ -15,7 +15,9 @@
 #ifndef _DISPLAY_PRINTF_H_
 #define _DISPLAY_PRINTF_H_
 
+#include "sdkconfig.h"
 #include "display_painter.h"
+#include "display_server.h"
 #include "screen_driver.h"
 
 #define DISPLAY_PRINT_LEVEL DISPLAY_PRINTF_LEVEL_VERBOSE
@@ -39,6 +41,11 @@ font_t display_printf_get_font();
 void display_printf(display_level_t level, const char *tag, uint16_t color, const char *format, ...);
 void display_printf_line(const char *tag, uint16_t line, uint16_t color, const char *format, ...);
 
+/* Drawing without the lock and without flush, for the task that owns the screen (display_server.c) */
+void display_printf_draw(const font_t *font, uint16_t color, const char *msg);
+void display_printf_draw_line(const font_t *font, uint16_t line, uint16_t color, const char *msg);
+void display_printf_draw_clear(void);
+
 #define DISPLAY_PRINTF_COLOR_E COLOR_RED
 #define DISPLAY_PRINTF_COLOR_W COLOR_YELLOW
 #define DISPLAY_PRINTF_COLOR_I COLOR_GREEN
@@ -59,7 +66,11 @@ void display_printf_line(const char *tag, uint16_t line, uint16_t color, const c
         if ( DISPLAY_PRINT_LEVEL >= level ) display_printf_LOCAL(level, tag, format __VA_OPT__(,) __VA_ARGS__); \
     } while(0)
 
+#if CONFIG_DISPLAY_SERVER_ENABLE
+#define DISPLAY_PRINTF_INIT(lcd) display_server_start(lcd)
+#else
 #define DISPLAY_PRINTF_INIT(lcd) painter_init(lcd)
+#endif
 #define DISPLAY_PRINTF_SET_FONT(font) display_printf_set_font(font)
 #define DISPLAY_PRINTF_CLEAR() display_printf_clear()
 #define DISPLAY_PRINTF_LINE(tag, line, color, format, ... ) display_printf_line(tag, line, color, format __VA_OPT__(,) __VA_ARGS__);
@@ -0,0 +1,416 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "screen_driver.h"
+#include "display_painter.h"
+#include "display_printf.h"
+#include "display_server.h"
+
+static const char *TAG = "display server";
+
+#define DISPLAY_SERVER_CHECK(a, str, ret)  if(!(a)) {                          \
+        ESP_LOGE(TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str);   \
+        return (ret);                                                           \
+    }
+
+#ifndef CONFIG_DISPLAY_SERVER_QUEUE_LEN
+#define CONFIG_DISPLAY_SERVER_QUEUE_LEN 16
+#endif
+#ifndef CONFIG_DISPLAY_SERVER_FRAME_MS
+#define CONFIG_DISPLAY_SERVER_FRAME_MS 33
+#endif
+#ifndef CONFIG_DISPLAY_SERVER_CORE
+#define CONFIG_DISPLAY_SERVER_CORE 1
+#endif
+#ifndef CONFIG_DISPLAY_SERVER_PRIORITY
+#define CONFIG_DISPLAY_SERVER_PRIORITY 5
+#endif
+
+#define DISPLAY_SERVER_QUEUE_LEN CONFIG_DISPLAY_SERVER_QUEUE_LEN
+_Static_assert((DISPLAY_SERVER_QUEUE_LEN & (DISPLAY_SERVER_QUEUE_LEN - 1)) == 0,
+               "CONFIG_DISPLAY_SERVER_QUEUE_LEN must be a power of two");
+
+#define DISPLAY_SERVER_STACK_SIZE 4096
+#define DISPLAY_SERVER_STRIP_DONE_BIT BIT0
+
+typedef enum {
+    DISPLAY_CMD_CALL = 0,
+    DISPLAY_CMD_PRINT,
+    DISPLAY_CMD_LINE,
+    DISPLAY_CMD_CLEAR,
+    DISPLAY_CMD_STRIP,
+} display_cmd_type_t;
+
+typedef struct {
+    display_cmd_type_t type;
+    uint32_t key;                   ///< Replaced by a later command of the same type and key, 0 never
+    union {
+        display_server_fn_t fn;
+        struct {
+            font_t font;
+            uint16_t line;
+            uint16_t color;
+        } text;
+        struct {
+            int16_t x;
+            int16_t y;
+            int16_t w;
+            int16_t h;
+            bool wire;
+            const uint16_t *pixels;
+            display_server_done_t done;
+            void *ctx;
+        } strip;
+    };
+    uint32_t arg[DISPLAY_SERVER_ARG_MAX / sizeof(uint32_t)];   ///< Text or call argument, word aligned
+} display_cmd_t;
+
+/**
+ * Bounded multi-producer queue. A slot belongs to the producer that moved
+ * s_head past it, which writes the command and then publishes it by setting
+ * the slot sequence to its position + 1. The display task is the only
+ * consumer, it gives the slot back for the next round by setting the
+ * sequence to the position + queue length.
+ */
+typedef struct {
+    uint32_t seq;
+    display_cmd_t cmd;
+} display_slot_t;
+
+static display_slot_t s_ring[DISPLAY_SERVER_QUEUE_LEN];
+static uint32_t s_head;             ///< Next position to claim, producers
+static uint32_t s_tail;             ///< Next position to run, display task only
+static uint32_t s_dropped;
+static uint32_t s_strips_posted;
+static uint32_t s_strips_done;
+static TaskHandle_t s_task;
+static EventGroupHandle_t s_events;
+static volatile bool s_running;
+
+static display_cmd_t *queue_claim(uint32_t *pos)
+{
+    uint32_t head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+    while (1) {
+        display_slot_t *slot = &s_ring[head & (DISPLAY_SERVER_QUEUE_LEN - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - head);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&s_head, &head, head + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *pos = head;
+                return &slot->cmd;
+            }
+            /* head was reloaded by the failed exchange */
+        } else if (diff < 0) {
+            /* the display task has not run this slot of the previous round */
+            __atomic_fetch_add(&s_dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        } else {
+            head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void queue_publish(uint32_t pos)
+{
+    __atomic_store_n(&s_ring[pos & (DISPLAY_SERVER_QUEUE_LEN - 1)].seq, pos + 1, __ATOMIC_RELEASE);
+    xTaskNotifyGive(s_task);
+}
+
+/** The command at position pos if it is published, NULL otherwise */
+static display_cmd_t *queue_peek(uint32_t pos)
+{
+    display_slot_t *slot = &s_ring[pos & (DISPLAY_SERVER_QUEUE_LEN - 1)];
+    if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1) {
+        return NULL;
+    }
+    return &slot->cmd;
+}
+
+static void queue_release(uint32_t pos)
+{
+    __atomic_store_n(&s_ring[pos & (DISPLAY_SERVER_QUEUE_LEN - 1)].seq, pos + DISPLAY_SERVER_QUEUE_LEN,
+                     __ATOMIC_RELEASE);
+}
+
+static esp_err_t post_text(display_cmd_type_t type, uint32_t key, const font_t *font, uint16_t line,
+                           uint16_t color, const char *text)
+{
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint32_t pos;
+    display_cmd_t *cmd = queue_claim(&pos);
+    if (NULL == cmd) {
+        return ESP_ERR_NO_MEM;
+    }
+    cmd->type = type;
+    cmd->key = key;
+    if (font) {
+        cmd->text.font = *font;
+    }
+    cmd->text.line = line;
+    cmd->text.color = color;
+    snprintf((char *)cmd->arg, sizeof(cmd->arg), "%s", text ? text : "");
+    queue_publish(pos);
+    return ESP_OK;
+}
+
+/** Whether a later command in the queue makes this one pointless */
+static bool cmd_superseded(const display_cmd_t *cmd, uint32_t pos, uint32_t end)
+{
+    bool drawing = cmd->type == DISPLAY_CMD_PRINT || cmd->type == DISPLAY_CMD_LINE ||
+                   cmd->type == DISPLAY_CMD_STRIP || cmd->type == DISPLAY_CMD_CLEAR;
+    for (uint32_t p = pos + 1; p != end; p++) {
+        const display_cmd_t *later = queue_peek(p);
+        if (drawing && later->type == DISPLAY_CMD_CLEAR) {
+            return true;
+        }
+        if (cmd->key && later->key == cmd->key && later->type == cmd->type &&
+                (cmd->type != DISPLAY_CMD_CALL || later->fn == cmd->fn)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void cmd_run(display_cmd_t *cmd, bool skip)
+{
+    switch (cmd->type) {
+    case DISPLAY_CMD_CALL:
+        if (!skip) {
+            cmd->fn(cmd->arg);
+        }
+        break;
+    case DISPLAY_CMD_PRINT:
+        if (!skip) {
+            display_printf_draw(&cmd->text.font, cmd->text.color, (const char *)cmd->arg);
+        }
+        break;
+    case DISPLAY_CMD_LINE:
+        if (!skip) {
+            display_printf_draw_line(&cmd->text.font, cmd->text.line, cmd->text.color, (const char *)cmd->arg);
+        }
+        break;
+    case DISPLAY_CMD_CLEAR:
+        if (!skip) {
+            display_printf_draw_clear();
+        }
+        break;
+    case DISPLAY_CMD_STRIP:
+        if (!skip) {
+            if (cmd->strip.wire) {
+                painter_draw_image_wire(cmd->strip.x, cmd->strip.y, cmd->strip.w, cmd->strip.h, cmd->strip.pixels);
+            } else {
+                painter_draw_image(cmd->strip.x, cmd->strip.y, cmd->strip.w, cmd->strip.h, (uint16_t *)cmd->strip.pixels);
+            }
+        }
+        /* a skipped strip is done as well, its pixels are free */
+        if (cmd->strip.done) {
+            cmd->strip.done(cmd->strip.ctx);
+        }
+        __atomic_fetch_add(&s_strips_done, 1, __ATOMIC_RELEASE);
+        xEventGroupSetBits(s_events, DISPLAY_SERVER_STRIP_DONE_BIT);
+        break;
+    }
+}
+
+static void display_server_task(void *arg)
+{
+    int64_t last_flush = 0;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        /* text waits for the next frame and may be replaced meanwhile, strips are drawn at once */
+        int64_t due = last_flush + CONFIG_DISPLAY_SERVER_FRAME_MS * 1000;
+        int64_t now = esp_timer_get_time();
+        while (now < due && __atomic_load_n(&s_strips_posted, __ATOMIC_ACQUIRE) ==
+                __atomic_load_n(&s_strips_done, __ATOMIC_RELAXED)) {
+            ulTaskNotifyTake(pdTRUE, (due - now) / 1000 / portTICK_PERIOD_MS + 1);
+            now = esp_timer_get_time();
+        }
+
+        /* what is published now is one batch, later commands wait for the next one */
+        uint32_t end = s_tail;
+        while (queue_peek(end)) {
+            end++;
+        }
+        for (; s_tail != end; s_tail++) {
+            display_cmd_t *cmd = queue_peek(s_tail);
+            cmd_run(cmd, cmd_superseded(cmd, s_tail, end));
+            queue_release(s_tail);
+        }
+        painter_flush();
+        last_flush = esp_timer_get_time();
+    }
+}
+
+esp_err_t display_server_start(scr_driver_t *driver)
+{
+#if CONFIG_DISPLAY_SERVER_ENABLE
+    static uint32_t s_started;
+    if (__atomic_exchange_n(&s_started, 1, __ATOMIC_ACQ_REL)) {
+        return ESP_OK;
+    }
+    esp_err_t ret = painter_init(driver);
+    DISPLAY_SERVER_CHECK(ESP_OK == ret, "painter init failed", ret);
+    for (uint32_t i = 0; i < DISPLAY_SERVER_QUEUE_LEN; i++) {
+        s_ring[i].seq = i;
+    }
+    s_events = xEventGroupCreate();
+    DISPLAY_SERVER_CHECK(NULL != s_events, "no memory for the event group", ESP_ERR_NO_MEM);
+    BaseType_t created = xTaskCreatePinnedToCore(display_server_task, "display", DISPLAY_SERVER_STACK_SIZE, NULL,
+                                                 CONFIG_DISPLAY_SERVER_PRIORITY, &s_task, CONFIG_DISPLAY_SERVER_CORE);
+    DISPLAY_SERVER_CHECK(pdPASS == created, "no memory for the display task", ESP_ERR_NO_MEM);
+    s_running = true;
+    ESP_LOGI(TAG, "display task on core %d, %d commands queued at most", CONFIG_DISPLAY_SERVER_CORE,
+             DISPLAY_SERVER_QUEUE_LEN);
+    return ESP_OK;
+#else
+    return painter_init(driver);
+#endif
+}
+
+bool display_server_running(void)
+{
+    return s_running;
+}
+
+esp_err_t display_server_call(uint32_t key, display_server_fn_t fn, const void *arg, size_t len)
+{
+    DISPLAY_SERVER_CHECK(NULL != fn, "function invalid", ESP_ERR_INVALID_ARG);
+    DISPLAY_SERVER_CHECK(len <= DISPLAY_SERVER_ARG_MAX, "argument too long", ESP_ERR_INVALID_ARG);
+    if (!s_running) {
+        uint32_t copy[DISPLAY_SERVER_ARG_MAX / sizeof(uint32_t)];
+        if (len) {
+            memcpy(copy, arg, len);
+        }
+        fn(copy);
+        painter_flush();
+        return ESP_OK;
+    }
+    uint32_t pos;
+    display_cmd_t *cmd = queue_claim(&pos);
+    if (NULL == cmd) {
+        return ESP_ERR_NO_MEM;
+    }
+    cmd->type = DISPLAY_CMD_CALL;
+    cmd->key = key;
+    cmd->fn = fn;
+    if (len) {
+        memcpy(cmd->arg, arg, len);
+    }
+    queue_publish(pos);
+    return ESP_OK;
+}
+
+esp_err_t display_server_print_line(const font_t *font, uint16_t line, uint16_t color, const char *text)
+{
+    DISPLAY_SERVER_CHECK(NULL != font, "font invalid", ESP_ERR_INVALID_ARG);
+    return post_text(DISPLAY_CMD_LINE, line + 1, font, line, color, text);
+}
+
+esp_err_t display_server_print(const font_t *font, uint16_t color, const char *text)
+{
+    DISPLAY_SERVER_CHECK(NULL != font, "font invalid", ESP_ERR_INVALID_ARG);
+    return post_text(DISPLAY_CMD_PRINT, 0, font, 0, color, text);
+}
+
+esp_err_t display_server_clear(void)
+{
+    return post_text(DISPLAY_CMD_CLEAR, 0, NULL, 0, 0, NULL);
+}
+
+esp_err_t display_server_draw_strip(int x, int y, int w, int h, const uint16_t *pixels, bool wire,
+                                    display_server_done_t done, void *ctx)
+{
+    DISPLAY_SERVER_CHECK(NULL != pixels, "pixels invalid", ESP_ERR_INVALID_ARG);
+    if (!s_running) {
+        if (wire) {
+            painter_draw_image_wire(x, y, w, h, pixels);
+        } else {
+            painter_draw_image(x, y, w, h, (uint16_t *)pixels);
+        }
+        painter_flush();
+        if (done) {
+            done(ctx);
+        }
+        return ESP_OK;
+    }
+    uint32_t pos;
+    display_cmd_t *cmd = queue_claim(&pos);
+    if (NULL == cmd) {
+        return ESP_ERR_NO_MEM;
+    }
+    cmd->type = DISPLAY_CMD_STRIP;
+    cmd->key = 0;
+    cmd->strip.x = x;
+    cmd->strip.y = y;
+    cmd->strip.w = w;
+    cmd->strip.h = h;
+    cmd->strip.wire = wire;
+    cmd->strip.pixels = pixels;
+    cmd->strip.done = done;
+    cmd->strip.ctx = ctx;
+    __atomic_fetch_add(&s_strips_posted, 1, __ATOMIC_RELEASE);
+    queue_publish(pos);
+    return ESP_OK;
+}
+
+void display_server_wait_strips(void)
+{
+    if (!s_running) {
+        return;
+    }
+    uint32_t posted = __atomic_load_n(&s_strips_posted, __ATOMIC_ACQUIRE);
+    while (1) {
+        /* cleared before the check, a strip finished after it sets the bit again */
+        xEventGroupClearBits(s_events, DISPLAY_SERVER_STRIP_DONE_BIT);
+        if ((int32_t)(__atomic_load_n(&s_strips_done, __ATOMIC_ACQUIRE) - posted) >= 0) {
+            return;
+        }
+        xEventGroupWaitBits(s_events, DISPLAY_SERVER_STRIP_DONE_BIT, pdFALSE, pdFALSE, portMAX_DELAY);
+    }
+}
+
+bool display_server_strip_cb(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data)
+{
+    /* the decoder waits for its strips anyway, a full queue only delays it */
+    esp_err_t ret;
+    while ((ret = display_server_draw_strip(x, y, w, h, data, display_server_wire_swap(), NULL, NULL)) == ESP_ERR_NO_MEM) {
+        vTaskDelay(1);
+    }
+    return ESP_OK == ret;
+}
+
+bool display_server_wait_cb(void)
+{
+    display_server_wait_strips();
+    return true;
+}
+
+bool display_server_wire_swap(void)
+{
+    return painter_get_wire_swap();
+}
+
+uint32_t display_server_dropped(void)
+{
+    return __atomic_load_n(&s_dropped, __ATOMIC_RELAXED);
+}
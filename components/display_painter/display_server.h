@@ -0,0 +1,156 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _DISPLAY_SERVER_H_
+#define _DISPLAY_SERVER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "screen_driver.h"
+#include "display_painter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * One task owns the painter and the screen.
+ *
+ * Other tasks post commands to a lock-free queue and return at once, the
+ * display task runs them in order. Commands posted with the same non-zero
+ * key replace each other while they wait, so a value updated faster than the
+ * screen is drawn only in its latest state. Everything drawn during one frame
+ * (CONFIG_DISPLAY_SERVER_FRAME_MS) is flushed together.
+ *
+ * Before display_server_start() and with CONFIG_DISPLAY_SERVER_ENABLE off
+ * display_server_call() and the strip functions draw right away in the
+ * calling task, so code using them runs either way. display_printf() keeps
+ * its own locked path then.
+ */
+
+#define DISPLAY_SERVER_ARG_MAX 128      ///< Bytes of a command argument, a text or a display_server_call() argument
+
+/** Drawing code run by the display task, arg is its copy of the posted argument */
+typedef void (*display_server_fn_t)(void *arg);
+
+/** Called by the display task when a strip was drawn and its pixels are free again */
+typedef void (*display_server_done_t)(void *ctx);
+
+/**
+ * @brief Initialise the painter and start the display task, once
+ *
+ * @param driver Screen driver, only used by the first call
+ *
+ * @return
+ *      - ESP_OK Success, or already running
+ *      - ESP_ERR_NO_MEM No memory for the task
+ */
+esp_err_t display_server_start(scr_driver_t *driver);
+
+/**
+ * @brief Whether drawing goes through the display task
+ */
+bool display_server_running(void);
+
+/**
+ * @brief Run drawing code in the display task
+ *
+ * @param key Commands with the same non-zero key replace each other while queued, 0 for none
+ * @param fn Drawing code
+ * @param arg Copied with the command, may be NULL
+ * @param len Bytes of arg, at most DISPLAY_SERVER_ARG_MAX
+ *
+ * @return
+ *      - ESP_OK Queued, or run when there is no display task
+ *      - ESP_ERR_INVALID_ARG fn is NULL or arg too long
+ *      - ESP_ERR_NO_MEM Queue full, the command was dropped
+ */
+esp_err_t display_server_call(uint32_t key, display_server_fn_t fn, const void *arg, size_t len);
+
+/**
+ * @brief Draw a line of text at a display_printf_line() line, display_printf_line() calls it
+ *
+ * A newer text for the same line replaces a queued one.
+ *
+ * @return
+ *      - ESP_OK Queued
+ *      - ESP_ERR_INVALID_STATE No display task
+ *      - ESP_ERR_NO_MEM Queue full, the text was dropped
+ */
+esp_err_t display_server_print_line(const font_t *font, uint16_t line, uint16_t color, const char *text);
+
+/**
+ * @brief Append a line of text, display_printf() calls it
+ *
+ * @return Same as display_server_print_line()
+ */
+esp_err_t display_server_print(const font_t *font, uint16_t color, const char *text);
+
+/**
+ * @brief Clear the screen like display_printf_clear(), drawing queued before it is skipped
+ *
+ * @return Same as display_server_print_line()
+ */
+esp_err_t display_server_clear(void);
+
+/**
+ * @brief Draw a strip of pixels without copying them
+ *
+ * The pixels must stay unchanged until done is called, or until
+ * display_server_wait_strips() returns.
+ *
+ * @param wire Pixels are in the bus byte order, see display_server_wire_swap()
+ * @param done Called from the display task when the strip is drawn, may be NULL
+ *
+ * @return
+ *      - ESP_OK Queued, or drawn when there is no display task
+ *      - ESP_ERR_NO_MEM Queue full, the strip was dropped and done is not called
+ */
+esp_err_t display_server_draw_strip(int x, int y, int w, int h, const uint16_t *pixels, bool wire,
+                                    display_server_done_t done, void *ctx);
+
+/**
+ * @brief Wait until all posted strips are drawn
+ */
+void display_server_wait_strips(void);
+
+/**
+ * @brief lcd_write_cb of mjpegdraw_async(), posts the strip and retries while the queue is full
+ *
+ * Decode with swap_output = display_server_wire_swap().
+ */
+bool display_server_strip_cb(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data);
+
+/**
+ * @brief lcd_wait_cb of mjpegdraw_async()
+ */
+bool display_server_wait_cb(void);
+
+/**
+ * @brief Whether strips should be given in the bus byte order, high byte first
+ */
+bool display_server_wire_swap(void);
+
+/**
+ * @brief Commands dropped because the queue was full
+ */
+uint32_t display_server_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
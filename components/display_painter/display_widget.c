@@ -0,0 +1,187 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <string.h>
+#include <sys/param.h>
+#include "esp_log.h"
+#include "screen_driver.h"
+#include "display_painter.h"
+#include "display_widget.h"
+
+static const char *TAG = "display widget";
+
+static uint32_t text_hash(const char *s)
+{
+    uint32_t h = 2166136261u;
+    for (; *s; ++s) {
+        h = (h ^ (uint8_t)*s) * 16777619u;
+    }
+    return h;
+}
+
+static void fill_columns(int x0, int x1, int y, int h, uint16_t color)
+{
+    if (x0 < x1) {
+        painter_draw_filled_rectangle(x0, y, x1 - 1, y + h - 1, color);
+    }
+}
+
+static bool widget_draw_text(display_widget_t *w, const char *text)
+{
+    if (NULL == w->font) {
+        ESP_LOGE(TAG, "text widget at %d,%d without font", w->x, w->y);
+        return false;
+    }
+    uintptr_t key = text_hash(text);
+    if (w->drawn && w->drawn_key == key) {
+        return false;
+    }
+
+    /* the longest part of the text that fits into the box */
+    int16_t ends[DISPLAY_WIDGET_TEXT_MAX];
+    int box_w = w->width > 0 ? w->width : INT16_MAX;
+    size_t len = painter_get_text_advances(text, MIN(strlen(text), DISPLAY_WIDGET_TEXT_MAX - 1), w->font, ends);
+    while (len > 0 && (ends[len - 1] > box_w || ((uint8_t)text[len] & 0xC0) == 0x80)) {
+        len--;
+    }
+    int tw = len ? ends[len - 1] : 0;
+    int x = w->x;
+    if (w->width > 0 && w->align == DISPLAY_WIDGET_ALIGN_CENTER) {
+        x += (w->width - tw) / 2;
+    } else if (w->width > 0 && w->align == DISPLAY_WIDGET_ALIGN_RIGHT) {
+        x += w->width - tw;
+    }
+
+    if (!w->drawn) {
+        /* whatever was in the box before goes */
+        w->drawn_x0 = w->x;
+        w->drawn_x1 = w->width > 0 ? w->x + w->width : x + tw;
+    }
+    char buf[DISPLAY_WIDGET_TEXT_MAX];
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+    uint16_t back_color = painter_get_back_color();
+    painter_set_back_color(w->back_color);
+    painter_draw_string(x, w->y, buf, w->font, w->color);
+    painter_set_back_color(back_color);
+
+    /* only the columns of the last text that the new one does not cover */
+    fill_columns(w->drawn_x0, MIN(x, w->drawn_x1), w->y, w->font->Height, w->back_color);
+    fill_columns(MAX(x + tw, w->drawn_x0), w->drawn_x1, w->y, w->font->Height, w->back_color);
+    w->drawn_x0 = x;
+    w->drawn_x1 = x + tw;
+    w->drawn_key = key;
+    return true;
+}
+
+static bool widget_draw_bar(display_widget_t *w)
+{
+    if (w->width < 3 || w->height < 3) {
+        ESP_LOGE(TAG, "bar at %d,%d too small", w->x, w->y);
+        return false;
+    }
+    int level = w->level_gen ? w->level_gen(w->arg) : 0;
+    level = MAX(0, MIN(level, DISPLAY_WIDGET_LEVEL_MAX));
+    int inner_w = w->width - 2;
+    int fill = inner_w * level / DISPLAY_WIDGET_LEVEL_MAX;
+    if (w->drawn && w->drawn_key == (uintptr_t)fill) {
+        return false;
+    }
+
+    int x = w->x + 1;
+    int y = w->y + 1;
+    int h = w->height - 2;
+    int old = (int)w->drawn_key;
+    if (!w->drawn) {
+        painter_draw_rectangle(w->x, w->y, w->x + w->width - 1, w->y + w->height - 1, w->color);
+        fill_columns(x, x + fill, y, h, w->color);
+        fill_columns(x + fill, x + inner_w, y, h, w->back_color);
+    } else if (fill > old) {
+        fill_columns(x + old, x + fill, y, h, w->color);
+    } else {
+        fill_columns(x + fill, x + old, y, h, w->back_color);
+    }
+    w->drawn_key = fill;
+    return true;
+}
+
+static bool widget_draw_icon(display_widget_t *w)
+{
+    const uint16_t *image = w->image_gen ? w->image_gen(w->arg) : w->image;
+    if (w->drawn && w->drawn_key == (uintptr_t)image) {
+        return false;
+    }
+    if (image) {
+        painter_draw_image(w->x, w->y, w->width, w->height, (uint16_t *)image);
+    } else {
+        fill_columns(w->x, w->x + w->width, w->y, w->height, w->back_color);
+    }
+    w->drawn_key = (uintptr_t)image;
+    return true;
+}
+
+int display_widget_refresh(display_widget_t *widgets, size_t num)
+{
+    if (NULL == widgets) {
+        return 0;
+    }
+    int drawn = 0;
+    for (size_t i = 0; i < num; i++) {
+        display_widget_t *w = &widgets[i];
+        bool changed = false;
+        char text[DISPLAY_WIDGET_TEXT_MAX];
+        switch (w->type) {
+        case DISPLAY_WIDGET_LABEL:
+            changed = widget_draw_text(w, w->text ? w->text : "");
+            break;
+        case DISPLAY_WIDGET_VALUE:
+            text[0] = '\0';
+            if (w->text_gen) {
+                w->text_gen(text, sizeof(text), w->arg);
+                text[sizeof(text) - 1] = '\0';
+            }
+            changed = widget_draw_text(w, text);
+            break;
+        case DISPLAY_WIDGET_ICON:
+            changed = widget_draw_icon(w);
+            break;
+        case DISPLAY_WIDGET_BAR:
+            changed = widget_draw_bar(w);
+            break;
+        }
+        if (changed) {
+            w->drawn = true;
+            drawn++;
+        }
+    }
+    if (drawn) {
+        painter_flush();
+    }
+    return drawn;
+}
+
+void display_widget_invalidate(display_widget_t *widgets, size_t num)
+{
+    for (size_t i = 0; widgets && i < num; i++) {
+        widgets[i].drawn = false;
+    }
+}
+
+void display_widget_show(display_widget_t *widgets, size_t num, uint16_t back_color)
+{
+    painter_clear(back_color);
+    display_widget_invalidate(widgets, num);
+    if (0 == display_widget_refresh(widgets, num)) {
+        painter_flush();
+    }
+}
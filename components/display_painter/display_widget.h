@@ -0,0 +1,135 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _DISPLAY_WIDGET_H_
+#define _DISPLAY_WIDGET_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "display_painter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Retained screen elements drawn with the painter.
+ *
+ * A screen is an array of widgets. Each widget remembers what it showed last,
+ * display_widget_refresh() asks the generators of all widgets for their
+ * current content and draws only the widgets whose content changed, a text
+ * that got shorter clears just the columns it no longer covers and a bar only
+ * the part between its old and new level. Refreshing a screen whose values did
+ * not change costs no bus traffic, so live values can be polled several times
+ * a second.
+ *
+ * Widgets are drawn by the task that owns the screen, they take no lock.
+ */
+
+#define DISPLAY_WIDGET_TEXT_MAX 64      ///< Longest text of a widget in bytes, including the '\0'
+#define DISPLAY_WIDGET_LEVEL_MAX 1000   ///< Bar level of a full bar
+
+typedef enum {
+    DISPLAY_WIDGET_LABEL = 0,   ///< Fixed text
+    DISPLAY_WIDGET_VALUE,       ///< Text of a generator
+    DISPLAY_WIDGET_ICON,        ///< RGB565 image, fixed or from a generator
+    DISPLAY_WIDGET_BAR,         ///< Framed progress bar, level from a generator
+} display_widget_type_t;
+
+typedef enum {
+    DISPLAY_WIDGET_ALIGN_LEFT = 0,
+    DISPLAY_WIDGET_ALIGN_CENTER,
+    DISPLAY_WIDGET_ALIGN_RIGHT,
+} display_widget_align_t;
+
+/** Write the text of a value widget to buf, UTF-8 */
+typedef void (*display_widget_text_gen_t)(char *buf, size_t len, void *arg);
+/** Level of a bar widget, 0 to DISPLAY_WIDGET_LEVEL_MAX */
+typedef int (*display_widget_level_gen_t)(void *arg);
+/** Image of an icon widget, width x height RGB565 pixels */
+typedef const uint16_t *(*display_widget_image_gen_t)(void *arg);
+
+typedef struct {
+    display_widget_type_t type;
+    int16_t x;
+    int16_t y;
+    int16_t width;                          ///< Box width, 0 for text up to the right edge, needed to align text
+    int16_t height;                         ///< Box height, the font height for text
+    const font_t *font;
+    uint16_t color;                         ///< Text, bar and frame color
+    uint16_t back_color;
+    display_widget_align_t align;           ///< Text alignment in the box
+    const char *text;                       ///< Label text
+    display_widget_text_gen_t text_gen;
+    display_widget_level_gen_t level_gen;
+    const uint16_t *image;                  ///< Icon image if there is no image_gen
+    display_widget_image_gen_t image_gen;
+    void *arg;                              ///< Passed to the generator
+
+    /* what the widget shows, kept by display_widget_refresh() */
+    bool drawn;
+    uintptr_t drawn_key;                    ///< Text hash, bar fill width or image address
+    int16_t drawn_x0;                       ///< Columns covered by the text
+    int16_t drawn_x1;
+} display_widget_t;
+
+#define DISPLAY_WIDGET_LABEL_INIT(_x, _y, _font, _color, _text) \
+    { .type = DISPLAY_WIDGET_LABEL, .x = _x, .y = _y, .font = _font, .color = _color, .text = _text }
+
+#define DISPLAY_WIDGET_VALUE_INIT(_x, _y, _width, _font, _color, _gen, _arg) \
+    { .type = DISPLAY_WIDGET_VALUE, .x = _x, .y = _y, .width = _width, .font = _font, .color = _color, \
+      .text_gen = _gen, .arg = _arg }
+
+#define DISPLAY_WIDGET_BAR_INIT(_x, _y, _width, _height, _color, _gen, _arg) \
+    { .type = DISPLAY_WIDGET_BAR, .x = _x, .y = _y, .width = _width, .height = _height, .color = _color, \
+      .level_gen = _gen, .arg = _arg }
+
+#define DISPLAY_WIDGET_ICON_INIT(_x, _y, _width, _height, _image) \
+    { .type = DISPLAY_WIDGET_ICON, .x = _x, .y = _y, .width = _width, .height = _height, .image = _image }
+
+/**
+ * @brief Draw the widgets whose content changed since they were drawn last
+ *
+ * @param widgets Array of widgets
+ * @param num Number of widgets
+ *
+ * @return Number of widgets drawn
+ */
+int display_widget_refresh(display_widget_t *widgets, size_t num);
+
+/**
+ * @brief Forget what the widgets show, the next refresh draws all of them
+ *
+ * Needed when something else drew over the widgets, like a cleared screen.
+ *
+ * @param widgets Array of widgets
+ * @param num Number of widgets
+ */
+void display_widget_invalidate(display_widget_t *widgets, size_t num);
+
+/**
+ * @brief Clear the screen and draw all widgets
+ *
+ * @param widgets Array of widgets
+ * @param num Number of widgets
+ * @param back_color Color of the screen
+ */
+void display_widget_show(display_widget_t *widgets, size_t num, uint16_t back_color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""Convert a BDF bitmap font into a packed painter font
+
+    bdf2font.py bdf/font16.bdf font16.c
+
+The C file defines the font twice, named after the FONT line of the BDF file:
+Font16 keeps the glyphs in their monospaced cells, Font16P sets the same
+bitmaps proportionally with kerning. Both share one bitmap, the linker drops
+whatever the firmware does not use. The COMMENT lines of the BDF file, usually
+the license, are copied to the top of the C file.
+
+The proportional advance is the ink width plus a spacing of Width / 8 (at
+least one pixel), blank glyphs advance half a cell. Kerning pairs are found
+from the glyph outlines: a pair moves closer as long as no ink of the two
+glyphs comes closer than the spacing, including diagonally, and by at most a
+quarter of the cell width. Only letters and . , are kerned, and only after the
+--kern-left or before the --kern-right glyphs, where the gaps are wide enough
+to be worth the flash.
+"""
+
+import argparse
+import os
+import sys
+
+
+class Glyph:
+    def __init__(self, cp):
+        self.cp = cp
+        self.rows = []          # ink box rows, lists of 0/1
+        self.w = self.h = self.x = self.y = 0
+
+
+def parse_bdf(path):
+    comments = []
+    props = {}
+    glyphs = []
+    with open(path) as f:
+        lines = [l.rstrip('\n') for l in f]
+    i = 0
+    g = None
+    while i < len(lines):
+        words = lines[i].split()
+        key = words[0] if words else ''
+        if key == 'COMMENT':
+            comments.append(lines[i][8:])
+        elif key in ('FONT', 'FONT_ASCENT', 'FONT_DESCENT'):
+            props[key] = words[1]
+        elif key == 'FONTBOUNDINGBOX':
+            props['bbx'] = [int(v) for v in words[1:5]]
+        elif key == 'STARTCHAR':
+            g = None
+        elif key == 'ENCODING':
+            g = Glyph(int(words[1]))
+        elif key == 'BBX':
+            g.w, g.h, g.x, g.y = [int(v) for v in words[1:5]]
+        elif key == 'BITMAP':
+            for row in lines[i + 1:i + 1 + g.h]:
+                bits = int(row, 16)
+                nbits = len(row) * 4
+                g.rows.append([(bits >> (nbits - 1 - x)) & 1 for x in range(g.w)])
+            i += g.h
+        elif key == 'ENDCHAR':
+            if g is not None and 0 <= g.cp <= 0xFFFF:
+                glyphs.append(g)
+        i += 1
+    glyphs.sort(key=lambda g: g.cp)
+    return comments, props, glyphs
+
+
+def pack(g):
+    bits = [b for row in g.rows for b in row]
+    out = []
+    for i in range(0, len(bits), 8):
+        chunk = bits[i:i + 8] + [0] * (8 - len(bits[i:i + 8]))
+        out.append(sum(b << (7 - k) for k, b in enumerate(chunk)))
+    return out
+
+
+def ranges_of(cps):
+    ranges = []
+    for idx, cp in enumerate(cps):
+        if ranges and ranges[-1][0] + ranges[-1][1] == cp:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([cp, 1, idx])
+    return ranges
+
+
+def profile(g, cell_h, top):
+    """Leftmost and rightmost ink column of every cell row, None without ink"""
+    left = [None] * cell_h
+    right = [None] * cell_h
+    for r, row in enumerate(g.rows):
+        cols = [x for x, b in enumerate(row) if b]
+        if cols and 0 <= top + r < cell_h:
+            left[top + r] = cols[0]
+            right[top + r] = cols[-1]
+    return left, right
+
+
+def kernable(cp):
+    return chr(cp).isalpha() or chr(cp) in '.,'
+
+
+def kern_pairs(glyphs, tops, cell_w, cell_h, spacing, kern_left, kern_right):
+    limit = max(1, cell_w // 4)
+    profiles = [profile(g, cell_h, t) for g, t in zip(glyphs, tops)]
+    pairs = []
+    for a, ga in enumerate(glyphs):
+        if not ga.w or not kernable(ga.cp):
+            continue
+        right_a = profiles[a][1]
+        for b, gb in enumerate(glyphs):
+            if not gb.w or not kernable(gb.cp):
+                continue
+            if chr(ga.cp) not in kern_left and chr(gb.cp) not in kern_right:
+                continue
+            left_b = profiles[b][0]
+            # blank columns between the ink of a and b, with b placed at the advance of a
+            gap = None
+            for y in range(cell_h):
+                if right_a[y] is None:
+                    continue
+                for yb in (y - 1, y, y + 1):
+                    if 0 <= yb < cell_h and left_b[yb] is not None:
+                        d = (ga.w + spacing + left_b[yb]) - right_a[y] - 1
+                        gap = d if gap is None else min(gap, d)
+            if gap is None:
+                continue        # no rows in common, like ' and .
+            adjust = -min(limit, gap - spacing)
+            if adjust < 0:
+                pairs.append((a, b, adjust))
+    return pairs
+
+
+def c_char(cp):
+    if cp == 0x27:
+        return "'\\''"
+    if cp == 0x5C:
+        return "'\\\\'"
+    if 0x20 <= cp <= 0x7E:
+        return "'%c'" % cp
+    return 'U+%04X' % cp
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('bdf')
+    ap.add_argument('out')
+    ap.add_argument('--kern-left', default='AFLPTVWY\u00c4', help='glyphs kerned with the letter after them')
+    ap.add_argument('--kern-right', default='ATVWY\u00c4', help='glyphs kerned with the letter before them')
+    args = ap.parse_args()
+
+    comments, props, glyphs = parse_bdf(args.bdf)
+    name = props['FONT']
+    cell_w, cell_h, _, _ = props['bbx']
+    ascent = int(props['FONT_ASCENT'])
+    if cell_w > 31 or cell_h > 31:
+        sys.exit('%s: cells are limited to 31x31 pixels' % args.bdf)
+    if len(glyphs) > 256:
+        sys.exit('%s: more than 256 glyphs, kerning stores glyph indices as bytes' % args.bdf)
+
+    spacing = max(1, cell_w // 8)
+    bearing = spacing // 2
+    blank = max(2, (cell_w + 1) // 2)
+    tops = [ascent - (g.y + g.h) for g in glyphs]
+    for g, t in zip(glyphs, tops):
+        if g.w and (g.x < 0 or g.x + g.w > cell_w or t < 0 or t + g.h > cell_h):
+            sys.exit('%s: U+%04X leaves the %dx%d cell' % (args.bdf, g.cp, cell_w, cell_h))
+    advance = [g.w + spacing if g.w else blank for g in glyphs]
+    kerning = kern_pairs(glyphs, tops, cell_w, cell_h, spacing, args.kern_left, args.kern_right)
+    ranges = ranges_of([g.cp for g in glyphs])
+
+    o = []
+    o.append('/* Generated by bdf2font.py from %s, do not edit' % os.path.basename(args.bdf))
+    if comments:
+        o.append(' *')
+        o.extend((' * ' + c).rstrip() for c in comments)
+    o.append(' */')
+    o.append('#include "painter_fonts.h"')
+    o.append('')
+
+    o.append('static const uint8_t s_bitmap[] = {')
+    offsets = []
+    size = 0
+    for g in glyphs:
+        data = pack(g)
+        offsets.append(size)
+        size += len(data)
+        if data:
+            o.append('    %s  /* %s */' % (' '.join('0x%02X,' % b for b in data), c_char(g.cp)))
+    if offsets[-1] > 0xFFF:
+        sys.exit('%s: bitmap larger than 4 KiB' % args.bdf)
+    if not size:
+        o.append('    0')
+    o.append('};')
+    o.append('')
+
+    o.append('static const painter_glyph_dsc_t s_glyphs[] = {')
+    for g, off, t in zip(glyphs, offsets, tops):
+        o.append('    {%5d, %2d, %2d, %2d, %2d},  /* %s */' % (off, g.w, g.h, g.x if g.w else 0,
+                                                          t if g.w else 0, c_char(g.cp)))
+    o.append('};')
+    o.append('')
+
+    o.append('static const painter_font_range_t s_ranges[] = {')
+    for first, count, idx in ranges:
+        o.append('    {0x%04X, %d, %d},' % (first, count, idx))
+    o.append('};')
+    o.append('')
+
+    o.append('static const uint8_t s_advance[] = {')
+    for i in range(0, len(advance), 16):
+        o.append('    ' + ' '.join('%d,' % a for a in advance[i:i + 16]))
+    o.append('};')
+    o.append('')
+
+    o.append('static const painter_font_kern_t s_kerning[] = {')
+    for a, b, adj in kerning:
+        o.append('    {%d, %d, %d},  /* %s %s */' % (a, b, adj, c_char(glyphs[a].cp), c_char(glyphs[b].cp)))
+    if not kerning:
+        o.append('    {0, 0, 0}')
+    o.append('};')
+    o.append('')
+
+    for suffix, adv, kern, width in (('', 'NULL', 'NULL', cell_w), ('P', 's_advance', 's_kerning', max(advance))):
+        o.append('static const painter_font_data_t s_data%s = {' % suffix.lower())
+        o.append('    .bitmap = s_bitmap,')
+        o.append('    .glyphs = s_glyphs,')
+        o.append('    .ranges = s_ranges,')
+        o.append('    .range_num = %d,' % len(ranges))
+        o.append('    .glyph_num = %d,' % len(glyphs))
+        o.append('    .advance = %s,' % adv)
+        o.append('    .bearing = %d,' % (bearing if suffix else 0))
+        o.append('    .kerning = %s,' % (kern if kerning else 'NULL'))
+        o.append('    .kerning_num = %d,' % (len(kerning) if suffix else 0))
+        o.append('};')
+        o.append('')
+        o.append('const font_t %s%s = {' % (name, suffix))
+        o.append('    NULL,')
+        o.append('    %d, /* Width */' % width)
+        o.append('    %d, /* Height */' % cell_h)
+        o.append('    &s_data%s,' % suffix.lower())
+        o.append('};')
+        o.append('')
+
+    with open(args.out, 'w') as f:
+        f.write('\n'.join(o))
+    print('%s: %d glyphs, bitmap %d bytes, %d kerning pairs' % (name, len(glyphs), size, len(kerning)))
+
+
+if __name__ == '__main__':
+    main()
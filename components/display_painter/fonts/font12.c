@@ -1,1384 +1,645 @@
-/**
-  ******************************************************************************
-  * @file    Font12.cpp
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text Font12. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
+/* Generated by bdf2font.py from font12.bdf, do not edit
+ *
+ * Courier New bitmap font of the display painter, 7x12 pixels, converted
+ * from font12.c of the STMicroelectronics MCD Application Team. The German
+ * letters were added for the painter.
+ *
+ * COPYRIGHT(c) 2014 STMicroelectronics
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of STMicroelectronics nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
 #include "painter_fonts.h"
 
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font12_Table[] = 
-{
-	// @0 ' ' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @12 '!' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @24 '"' (7 pixels wide)
-	0x00, //        
-	0x6C, //  ## ## 
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @36 '#' (7 pixels wide)
-	0x00, //        
-	0x14, //    # # 
-	0x14, //    # # 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x50, //  # #   
-	0x50, //  # #   
-	0x00, //        
-	0x00, //        
-
-	// @48 '$' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x38, //   ###  
-	0x40, //  #     
-	0x40, //  #     
-	0x38, //   ###  
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @60 '%' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x50, //  # #   
-	0x20, //   #    
-	0x0C, //     ## 
-	0x70, //  ###   
-	0x08, //     #  
-	0x14, //    # # 
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @72 '&' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x20, //   #    
-	0x20, //   #    
-	0x54, //  # # # 
-	0x48, //  #  #  
-	0x34, //   ## # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @84 ''' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @96 '(' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-
-	// @108 ')' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x00, //        
-
-	// @120 '*' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @132 '+' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @144 ',' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x10, //    #   
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-
-	// @156 '-' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @168 '.' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @180 '/' (7 pixels wide)
-	0x00, //        
-	0x04, //      # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x40, //  #     
-	0x00, //        
-	0x00, //        
-
-	// @192 '0' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @204 '1' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @216 '2' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @228 '3' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x18, //    ##  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @240 '4' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x14, //    # # 
-	0x14, //    # # 
-	0x24, //   #  # 
-	0x44, //  #   # 
-	0x7E, //  ######
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @252 '5' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @264 '6' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x40, //  #     
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @276 '7' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @288 '8' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @300 '9' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @312 ':' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @324 ';' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x18, //    ##  
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-
-	// @336 '<' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x0C, //     ## 
-	0x10, //    #   
-	0x60, //  ##    
-	0x80, // #      
-	0x60, //  ##    
-	0x10, //    #   
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @348 '=' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @360 '>' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xC0, // ##     
-	0x20, //   #    
-	0x18, //    ##  
-	0x04, //      # 
-	0x18, //    ##  
-	0x20, //   #    
-	0xC0, // ##     
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @372 '?' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x24, //   #  # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x00, //        
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @384 '@' (7 pixels wide)
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-
-	// @396 'A' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @408 'B' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @420 'C' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @432 'D' (7 pixels wide)
-	0x00, //        
-	0xF0, // ####   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0xF0, // ####   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @444 'E' (7 pixels wide)
-	0x00, //        
-	0xFC, // ###### 
-	0x44, //  #   # 
-	0x50, //  # #   
-	0x70, //  ###   
-	0x50, //  # #   
-	0x40, //  #     
-	0x44, //  #   # 
-	0xFC, // ###### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @456 'F' (7 pixels wide)
-	0x00, //        
-	0x7E, //  ######
-	0x22, //   #   #
-	0x28, //   # #  
-	0x38, //   ###  
-	0x28, //   # #  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @468 'G' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x4E, //  #  ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @480 'H' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @492 'I' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @504 'J' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @516 'K' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0x50, //  # #   
-	0x70, //  ###   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE6, // ###  ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @528 'L' (7 pixels wide)
-	0x00, //        
-	0x70, //  ###   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @540 'M' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x6C, //  ## ## 
-	0x6C, //  ## ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @552 'N' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x64, //  ##  # 
-	0x64, //  ##  # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0xEC, // ### ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @564 'O' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @576 'P' (7 pixels wide)
-	0x00, //        
-	0x78, //  ####  
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @588 'Q' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-
-	// @600 'R' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE2, // ###   #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @612 'S' (7 pixels wide)
-	0x00, //        
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x64, //  ##  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @624 'T' (7 pixels wide)
-	0x00, //        
-	0xFE, // #######
-	0x92, // #  #  #
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @636 'U' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @648 'V' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @660 'W' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @672 'X' (7 pixels wide)
-	0x00, //        
-	0xC6, // ##   ##
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0xC6, // ##   ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @684 'Y' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @696 'Z' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @708 '[' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x00, //        
-
-	// @720 '\' (7 pixels wide)
-	0x00, //        
-	0x40, //  #     
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-
-	// @732 ']' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x38, //   ###  
-	0x00, //        
-
-	// @744 '^' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @756 '_' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xFE, // #######
-
-	// @768 '`' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @780 'a' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @792 'b' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @804 'c' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @816 'd' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x04, //      # 
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @828 'e' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x40, //  #     
-	0x40, //  #     
-	0x3C, //   #### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @840 'f' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @852 'g' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x38, //   ###  
-	0x00, //        
-
-	// @864 'h' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @876 'i' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @888 'j' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x78, //  ####  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-
-	// @900 'k' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x5C, //  # ### 
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x50, //  # #   
-	0x48, //  #  #  
-	0xDC, // ## ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @912 'l' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @924 'm' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xE8, // ### #  
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0xFE, // #######
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @936 'n' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @948 'o' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @960 'p' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x40, //  #     
-	0xE0, // ###    
-	0x00, //        
-
-	// @972 'q' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-
-	// @984 'r' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x6C, //  ## ## 
-	0x30, //   ##   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @996 's' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x04, //      # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1008 't' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x22, //   #   #
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1020 'u' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x36, //   ## ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1032 'v' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1044 'w' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1056 'x' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x30, //   ##   
-	0x48, //  #  #  
-	0xCC, // ##  ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1068 'y' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x24, //   #  # 
-	0x28, //   # #  
-	0x18, //    ##  
-	0x10, //    #   
-	0x10, //    #   
-	0x78, //  ####  
-	0x00, //        
+static const uint8_t s_bitmap[] = {
+    0xF9,  /* '!' */
+    0xDC, 0xA4,  /* '"' */
+    0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0,  /* '#' */
+    0x27, 0x88, 0x79, 0xE2, 0x20,  /* '$' */
+    0x45, 0x10, 0x3E, 0x08, 0xA2,  /* '%' */
+    0x32, 0x11, 0x59, 0x34,  /* '&' */
+    0xF0,  /* '\'' */
+    0x5A, 0xAA, 0x50,  /* '(' */
+    0xA5, 0x55, 0xA0,  /* ')' */
+    0x27, 0xC8, 0xA5, 0x00,  /* '*' */
+    0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,  /* '+' */
+    0x6B, 0x40,  /* ',' */
+    0xF8,  /* '-' */
+    0xF0,  /* '.' */
+    0x08, 0x44, 0x22, 0x11, 0x08, 0x80,  /* '/' */
+    0x74, 0x63, 0x18, 0xC6, 0x2E,  /* '0' */
+    0x61, 0x08, 0x42, 0x10, 0x9F,  /* '1' */
+    0x74, 0x42, 0x22, 0x22, 0x3F,  /* '2' */
+    0x74, 0x42, 0x60, 0x86, 0x2E,  /* '3' */
+    0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87,  /* '4' */
+    0x7A, 0x10, 0xE0, 0x86, 0x2E,  /* '5' */
+    0x3A, 0x21, 0xE8, 0xC6, 0x2E,  /* '6' */
+    0xFC, 0x42, 0x21, 0x08, 0x84,  /* '7' */
+    0x74, 0x62, 0xE8, 0xC6, 0x2E,  /* '8' */
+    0x74, 0x63, 0x17, 0x84, 0x5C,  /* '9' */
+    0xF0, 0xF0,  /* ':' */
+    0x6C, 0x07, 0xA0,  /* ';' */
+    0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0,  /* '<' */
+    0xF8, 0x3E,  /* '=' */
+    0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00,  /* '>' */
+    0x69, 0x12, 0x40, 0xC0,  /* '?' */
+    0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,  /* '@' */
+    0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77,  /* 'A' */
+    0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E,  /* 'B' */
+    0x7C, 0x61, 0x08, 0x42, 0x2E,  /* 'C' */
+    0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,  /* 'D' */
+    0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F,  /* 'E' */
+    0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,  /* 'F' */
+    0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C,  /* 'G' */
+    0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,  /* 'H' */
+    0xF9, 0x08, 0x42, 0x10, 0x9F,  /* 'I' */
+    0x78, 0x84, 0x29, 0x4A, 0x4C,  /* 'J' */
+    0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73,  /* 'K' */
+    0xE2, 0x10, 0x84, 0x25, 0x3F,  /* 'L' */
+    0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77,  /* 'M' */
+    0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76,  /* 'N' */
+    0x74, 0x63, 0x18, 0xC6, 0x2E,  /* 'O' */
+    0xF2, 0x52, 0x97, 0x21, 0x1C,  /* 'P' */
+    0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38,  /* 'Q' */
+    0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,  /* 'R' */
+    0x6C, 0xE0, 0xE0, 0x87, 0x36,  /* 'S' */
+    0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,  /* 'T' */
+    0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C,  /* 'U' */
+    0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08,  /* 'V' */
+    0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14,  /* 'W' */
+    0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63,  /* 'X' */
+    0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C,  /* 'Y' */
+    0xFC, 0x44, 0x42, 0x22, 0x3F,  /* 'Z' */
+    0xF2, 0x49, 0x24, 0x9C,  /* '[' */
+    0x84, 0x44, 0x22, 0x11, 0x10,  /* '\\' */
+    0xE4, 0x92, 0x49, 0x3C,  /* ']' */
+    0x21, 0x15, 0x10,  /* '^' */
+    0xFE,  /* '_' */
+    0x90,  /* '`' */
+    0x72, 0x27, 0xA2, 0x89, 0xF0,  /* 'a' */
+    0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E,  /* 'b' */
+    0x7C, 0x61, 0x08, 0xB8,  /* 'c' */
+    0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F,  /* 'd' */
+    0x74, 0x7F, 0x08, 0x3C,  /* 'e' */
+    0x3A, 0x3E, 0x84, 0x21, 0x1F,  /* 'f' */
+    0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C,  /* 'g' */
+    0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77,  /* 'h' */
+    0x20, 0x38, 0x42, 0x10, 0x9F,  /* 'i' */
+    0x20, 0xF1, 0x11, 0x11, 0x1E,  /* 'j' */
+    0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7,  /* 'k' */
+    0x61, 0x08, 0x42, 0x10, 0x9F,  /* 'l' */
+    0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,  /* 'm' */
+    0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0,  /* 'n' */
+    0x74, 0x63, 0x18, 0xB8,  /* 'o' */
+    0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,  /* 'p' */
+    0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87,  /* 'q' */
+    0xDB, 0x10, 0x84, 0x7C,  /* 'r' */
+    0x7C, 0x5C, 0x18, 0xF8,  /* 's' */
+    0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,  /* 't' */
+    0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0,  /* 'u' */
+    0xEE, 0x89, 0x11, 0x42, 0x82, 0x00,  /* 'v' */
+    0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00,  /* 'w' */
+    0xCD, 0x23, 0x0C, 0x4B, 0x30,  /* 'x' */
+    0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C,  /* 'y' */
+    0xFC, 0x88, 0x88, 0xFC,  /* 'z' */
+    0x29, 0x25, 0x12, 0x44,  /* '{' */
+    0xFF, 0x80,  /* '|' */
+    0x89, 0x24, 0x52, 0x50,  /* '}' */
+    0x4D, 0x80,  /* '~' */
+    0x28, 0x00, 0xC0, 0x82, 0x85, 0x0A, 0x3E, 0x45, 0xDC,  /* U+00C4 */
+    0x50, 0x1D, 0x18, 0xC6, 0x31, 0x8B, 0x80,  /* U+00D6 */
+    0x28, 0x03, 0xBA, 0x24, 0x48, 0x91, 0x22, 0x44, 0x70,  /* U+00DC */
+    0xF4, 0x63, 0xE8, 0xC6, 0x3E, 0x80,  /* U+00DF */
+    0x50, 0x07, 0x22, 0x7A, 0x28, 0x9F,  /* U+00E4 */
+    0x50, 0x1D, 0x18, 0xC6, 0x2E,  /* U+00F6 */
+    0x28, 0x03, 0x32, 0x24, 0x48, 0x93, 0x1B,  /* U+00FC */
+};
 
-	// @1080 'z' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x48, //  #  #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
+static const painter_glyph_dsc_t s_glyphs[] = {
+    {    0,  0,  0,  0,  0},  /* ' ' */
+    {    0,  1,  8,  3,  1},  /* '!' */
+    {    1,  5,  3,  1,  1},  /* '"' */
+    {    3,  5,  9,  1,  1},  /* '#' */
+    {    9,  4,  9,  1,  1},  /* '$' */
+    {   14,  5,  8,  1,  1},  /* '%' */
+    {   19,  5,  6,  1,  3},  /* '&' */
+    {   23,  1,  4,  3,  1},  /* '\'' */
+    {   24,  2, 10,  3,  1},  /* '(' */
+    {   27,  2, 10,  2,  1},  /* ')' */
+    {   30,  5,  5,  1,  1},  /* '*' */
+    {   34,  7,  7,  0,  2},  /* '+' */
+    {   41,  3,  4,  2,  7},  /* ',' */
+    {   43,  5,  1,  1,  5},  /* '-' */
+    {   44,  2,  2,  2,  7},  /* '.' */
+    {   45,  5,  9,  1,  1},  /* '/' */
+    {   51,  5,  8,  1,  1},  /* '0' */
+    {   56,  5,  8,  1,  1},  /* '1' */
+    {   61,  5,  8,  1,  1},  /* '2' */
+    {   66,  5,  8,  1,  1},  /* '3' */
+    {   71,  6,  8,  1,  1},  /* '4' */
+    {   77,  5,  8,  1,  1},  /* '5' */
+    {   82,  5,  8,  1,  1},  /* '6' */
+    {   87,  5,  8,  1,  1},  /* '7' */
+    {   92,  5,  8,  1,  1},  /* '8' */
+    {   97,  5,  8,  1,  1},  /* '9' */
+    {  102,  2,  6,  2,  3},  /* ':' */
+    {  104,  3,  7,  2,  3},  /* ';' */
+    {  107,  6,  7,  0,  2},  /* '<' */
+    {  113,  5,  3,  1,  4},  /* '=' */
+    {  115,  6,  7,  0,  2},  /* '>' */
+    {  121,  4,  7,  2,  2},  /* '?' */
+    {  125,  5, 10,  1,  0},  /* '@' */
+    {  132,  7,  8,  0,  1},  /* 'A' */
+    {  139,  6,  8,  0,  1},  /* 'B' */
+    {  145,  5,  8,  1,  1},  /* 'C' */
+    {  150,  6,  8,  0,  1},  /* 'D' */
+    {  156,  6,  8,  0,  1},  /* 'E' */
+    {  162,  6,  8,  1,  1},  /* 'F' */
+    {  168,  6,  8,  1,  1},  /* 'G' */
+    {  174,  7,  8,  0,  1},  /* 'H' */
+    {  181,  5,  8,  1,  1},  /* 'I' */
+    {  186,  5,  8,  1,  1},  /* 'J' */
+    {  191,  7,  8,  0,  1},  /* 'K' */
+    {  198,  5,  8,  1,  1},  /* 'L' */
+    {  203,  7,  8,  0,  1},  /* 'M' */
+    {  210,  7,  8,  0,  1},  /* 'N' */
+    {  217,  5,  8,  1,  1},  /* 'O' */
+    {  222,  5,  8,  1,  1},  /* 'P' */
+    {  227,  5,  9,  1,  1},  /* 'Q' */
+    {  233,  7,  8,  0,  1},  /* 'R' */
+    {  240,  5,  8,  1,  1},  /* 'S' */
+    {  245,  7,  8,  0,  1},  /* 'T' */
+    {  252,  7,  8,  0,  1},  /* 'U' */
+    {  259,  7,  8,  0,  1},  /* 'V' */
+    {  266,  7,  8,  0,  1},  /* 'W' */
+    {  273,  7,  8,  0,  1},  /* 'X' */
+    {  280,  7,  8,  0,  1},  /* 'Y' */
+    {  287,  5,  8,  1,  1},  /* 'Z' */
+    {  292,  3, 10,  2,  1},  /* '[' */
+    {  296,  4,  9,  1,  1},  /* '\\' */
+    {  301,  3, 10,  2,  1},  /* ']' */
+    {  305,  5,  4,  1,  1},  /* '^' */
+    {  308,  7,  1,  0, 11},  /* '_' */
+    {  309,  2,  2,  3,  1},  /* '`' */
+    {  310,  6,  6,  1,  3},  /* 'a' */
+    {  315,  6,  8,  0,  1},  /* 'b' */
+    {  321,  5,  6,  1,  3},  /* 'c' */
+    {  325,  6,  8,  1,  1},  /* 'd' */
+    {  331,  5,  6,  1,  3},  /* 'e' */
+    {  335,  5,  8,  1,  1},  /* 'f' */
+    {  340,  6,  8,  1,  3},  /* 'g' */
+    {  346,  7,  8,  0,  1},  /* 'h' */
+    {  353,  5,  8,  1,  1},  /* 'i' */
+    {  358,  4, 10,  1,  1},  /* 'j' */
+    {  363,  6,  8,  0,  1},  /* 'k' */
+    {  369,  5,  8,  1,  1},  /* 'l' */
+    {  374,  7,  6,  0,  3},  /* 'm' */
+    {  380,  7,  6,  0,  3},  /* 'n' */
+    {  386,  5,  6,  1,  3},  /* 'o' */
+    {  390,  6,  8,  0,  3},  /* 'p' */
+    {  396,  6,  8,  1,  3},  /* 'q' */
+    {  402,  5,  6,  1,  3},  /* 'r' */
+    {  406,  5,  6,  1,  3},  /* 's' */
+    {  410,  6,  7,  1,  2},  /* 't' */
+    {  416,  7,  6,  0,  3},  /* 'u' */
+    {  422,  7,  6,  0,  3},  /* 'v' */
+    {  428,  7,  6,  0,  3},  /* 'w' */
+    {  434,  6,  6,  0,  3},  /* 'x' */
+    {  439,  7,  8,  0,  3},  /* 'y' */
+    {  446,  5,  6,  1,  3},  /* 'z' */
+    {  450,  3, 10,  2,  1},  /* '{' */
+    {  454,  1,  9,  3,  1},  /* '|' */
+    {  456,  3, 10,  2,  1},  /* '}' */
+    {  460,  5,  2,  1,  5},  /* '~' */
+    {  462,  7, 10,  0,  0},  /* U+00C4 */
+    {  471,  5, 10,  1,  0},  /* U+00D6 */
+    {  478,  7, 10,  0,  0},  /* U+00DC */
+    {  487,  5,  9,  1,  1},  /* U+00DF */
+    {  493,  6,  8,  1,  1},  /* U+00E4 */
+    {  499,  5,  8,  1,  1},  /* U+00F6 */
+    {  504,  7,  8,  0,  1},  /* U+00FC */
+};
 
-	// @1092 '{' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
+static const painter_font_range_t s_ranges[] = {
+    {0x0020, 95, 0},
+    {0x00C4, 1, 95},
+    {0x00D6, 1, 96},
+    {0x00DC, 1, 97},
+    {0x00DF, 1, 98},
+    {0x00E4, 1, 99},
+    {0x00F6, 1, 100},
+    {0x00FC, 1, 101},
+};
 
-	// @1104 '|' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
+static const uint8_t s_advance[] = {
+    4, 2, 6, 6, 5, 6, 6, 2, 3, 3, 6, 8, 4, 6, 3, 6,
+    6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 3, 4, 7, 6, 7, 5,
+    6, 8, 7, 6, 7, 7, 7, 7, 8, 6, 6, 8, 6, 8, 8, 6,
+    6, 6, 8, 6, 8, 8, 8, 8, 8, 8, 6, 4, 5, 4, 6, 8,
+    3, 7, 7, 6, 7, 6, 6, 7, 8, 6, 5, 7, 6, 8, 8, 6,
+    7, 7, 6, 6, 7, 8, 8, 8, 7, 8, 6, 4, 2, 4, 6, 8,
+    6, 8, 6, 7, 6, 8,
+};
 
-	// @1116 '}' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x00, //        
+static const painter_font_kern_t s_kerning[] = {
+    {12, 52, -1},  /* ',' 'T' */
+    {12, 54, -1},  /* ',' 'V' */
+    {12, 55, -1},  /* ',' 'W' */
+    {12, 57, -1},  /* ',' 'Y' */
+    {12, 95, -1},  /* ',' U+00C4 */
+    {14, 52, -1},  /* '.' 'T' */
+    {14, 54, -1},  /* '.' 'V' */
+    {14, 55, -1},  /* '.' 'W' */
+    {14, 57, -1},  /* '.' 'Y' */
+    {33, 52, -1},  /* 'A' 'T' */
+    {33, 53, -1},  /* 'A' 'U' */
+    {33, 54, -1},  /* 'A' 'V' */
+    {33, 55, -1},  /* 'A' 'W' */
+    {33, 57, -1},  /* 'A' 'Y' */
+    {33, 74, -1},  /* 'A' 'j' */
+    {33, 80, -1},  /* 'A' 'p' */
+    {33, 84, -1},  /* 'A' 't' */
+    {33, 85, -1},  /* 'A' 'u' */
+    {33, 86, -1},  /* 'A' 'v' */
+    {33, 87, -1},  /* 'A' 'w' */
+    {33, 89, -1},  /* 'A' 'y' */
+    {33, 97, -1},  /* 'A' U+00DC */
+    {33, 101, -1},  /* 'A' U+00FC */
+    {34, 95, -1},  /* 'B' U+00C4 */
+    {35, 95, -1},  /* 'C' U+00C4 */
+    {36, 33, -1},  /* 'D' 'A' */
+    {36, 54, -1},  /* 'D' 'V' */
+    {36, 55, -1},  /* 'D' 'W' */
+    {36, 57, -1},  /* 'D' 'Y' */
+    {36, 95, -1},  /* 'D' U+00C4 */
+    {38, 12, -1},  /* 'F' ',' */
+    {38, 14, -1},  /* 'F' '.' */
+    {38, 33, -1},  /* 'F' 'A' */
+    {38, 42, -1},  /* 'F' 'J' */
+    {38, 65, -1},  /* 'F' 'a' */
+    {38, 67, -1},  /* 'F' 'c' */
+    {38, 68, -1},  /* 'F' 'd' */
+    {38, 69, -1},  /* 'F' 'e' */
+    {38, 71, -1},  /* 'F' 'g' */
+    {38, 76, -1},  /* 'F' 'l' */
+    {38, 79, -1},  /* 'F' 'o' */
+    {38, 81, -1},  /* 'F' 'q' */
+    {38, 83, -1},  /* 'F' 's' */
+    {38, 95, -1},  /* 'F' U+00C4 */
+    {38, 99, -1},  /* 'F' U+00E4 */
+    {38, 100, -1},  /* 'F' U+00F6 */
+    {39, 33, -1},  /* 'G' 'A' */
+    {39, 52, -1},  /* 'G' 'T' */
+    {39, 54, -1},  /* 'G' 'V' */
+    {39, 55, -1},  /* 'G' 'W' */
+    {39, 57, -1},  /* 'G' 'Y' */
+    {39, 95, -1},  /* 'G' U+00C4 */
+    {42, 33, -1},  /* 'J' 'A' */
+    {42, 95, -1},  /* 'J' U+00C4 */
+    {44, 52, -1},  /* 'L' 'T' */
+    {44, 53, -1},  /* 'L' 'U' */
+    {44, 54, -1},  /* 'L' 'V' */
+    {44, 55, -1},  /* 'L' 'W' */
+    {44, 57, -1},  /* 'L' 'Y' */
+    {44, 74, -1},  /* 'L' 'j' */
+    {44, 80, -1},  /* 'L' 'p' */
+    {44, 84, -1},  /* 'L' 't' */
+    {44, 85, -1},  /* 'L' 'u' */
+    {44, 86, -1},  /* 'L' 'v' */
+    {44, 87, -1},  /* 'L' 'w' */
+    {44, 89, -1},  /* 'L' 'y' */
+    {44, 97, -1},  /* 'L' U+00DC */
+    {44, 101, -1},  /* 'L' U+00FC */
+    {46, 33, -1},  /* 'N' 'A' */
+    {46, 95, -1},  /* 'N' U+00C4 */
+    {47, 95, -1},  /* 'O' U+00C4 */
+    {48, 12, -1},  /* 'P' ',' */
+    {48, 14, -1},  /* 'P' '.' */
+    {48, 33, -1},  /* 'P' 'A' */
+    {48, 76, -1},  /* 'P' 'l' */
+    {48, 95, -1},  /* 'P' U+00C4 */
+    {50, 52, -1},  /* 'R' 'T' */
+    {50, 54, -1},  /* 'R' 'V' */
+    {50, 55, -1},  /* 'R' 'W' */
+    {50, 57, -1},  /* 'R' 'Y' */
+    {51, 95, -1},  /* 'S' U+00C4 */
+    {52, 12, -1},  /* 'T' ',' */
+    {52, 14, -1},  /* 'T' '.' */
+    {52, 33, -1},  /* 'T' 'A' */
+    {52, 42, -1},  /* 'T' 'J' */
+    {52, 65, -1},  /* 'T' 'a' */
+    {52, 67, -1},  /* 'T' 'c' */
+    {52, 68, -1},  /* 'T' 'd' */
+    {52, 69, -1},  /* 'T' 'e' */
+    {52, 71, -1},  /* 'T' 'g' */
+    {52, 76, -1},  /* 'T' 'l' */
+    {52, 79, -1},  /* 'T' 'o' */
+    {52, 81, -1},  /* 'T' 'q' */
+    {52, 83, -1},  /* 'T' 's' */
+    {52, 95, -1},  /* 'T' U+00C4 */
+    {52, 99, -1},  /* 'T' U+00E4 */
+    {52, 100, -1},  /* 'T' U+00F6 */
+    {53, 33, -1},  /* 'U' 'A' */
+    {53, 95, -1},  /* 'U' U+00C4 */
+    {54, 12, -1},  /* 'V' ',' */
+    {54, 14, -1},  /* 'V' '.' */
+    {54, 33, -1},  /* 'V' 'A' */
+    {54, 42, -1},  /* 'V' 'J' */
+    {54, 65, -1},  /* 'V' 'a' */
+    {54, 67, -1},  /* 'V' 'c' */
+    {54, 68, -1},  /* 'V' 'd' */
+    {54, 69, -1},  /* 'V' 'e' */
+    {54, 70, -1},  /* 'V' 'f' */
+    {54, 71, -1},  /* 'V' 'g' */
+    {54, 73, -1},  /* 'V' 'i' */
+    {54, 74, -1},  /* 'V' 'j' */
+    {54, 76, -1},  /* 'V' 'l' */
+    {54, 77, -1},  /* 'V' 'm' */
+    {54, 78, -1},  /* 'V' 'n' */
+    {54, 79, -1},  /* 'V' 'o' */
+    {54, 80, -1},  /* 'V' 'p' */
+    {54, 81, -1},  /* 'V' 'q' */
+    {54, 82, -1},  /* 'V' 'r' */
+    {54, 83, -1},  /* 'V' 's' */
+    {54, 84, -1},  /* 'V' 't' */
+    {54, 85, -1},  /* 'V' 'u' */
+    {54, 86, -1},  /* 'V' 'v' */
+    {54, 87, -1},  /* 'V' 'w' */
+    {54, 88, -1},  /* 'V' 'x' */
+    {54, 89, -1},  /* 'V' 'y' */
+    {54, 90, -1},  /* 'V' 'z' */
+    {54, 95, -1},  /* 'V' U+00C4 */
+    {54, 96, -1},  /* 'V' U+00D6 */
+    {54, 99, -1},  /* 'V' U+00E4 */
+    {54, 100, -1},  /* 'V' U+00F6 */
+    {54, 101, -1},  /* 'V' U+00FC */
+    {55, 12, -1},  /* 'W' ',' */
+    {55, 14, -1},  /* 'W' '.' */
+    {55, 33, -1},  /* 'W' 'A' */
+    {55, 42, -1},  /* 'W' 'J' */
+    {55, 65, -1},  /* 'W' 'a' */
+    {55, 67, -1},  /* 'W' 'c' */
+    {55, 68, -1},  /* 'W' 'd' */
+    {55, 69, -1},  /* 'W' 'e' */
+    {55, 70, -1},  /* 'W' 'f' */
+    {55, 71, -1},  /* 'W' 'g' */
+    {55, 73, -1},  /* 'W' 'i' */
+    {55, 74, -1},  /* 'W' 'j' */
+    {55, 76, -1},  /* 'W' 'l' */
+    {55, 77, -1},  /* 'W' 'm' */
+    {55, 78, -1},  /* 'W' 'n' */
+    {55, 79, -1},  /* 'W' 'o' */
+    {55, 80, -1},  /* 'W' 'p' */
+    {55, 81, -1},  /* 'W' 'q' */
+    {55, 82, -1},  /* 'W' 'r' */
+    {55, 83, -1},  /* 'W' 's' */
+    {55, 84, -1},  /* 'W' 't' */
+    {55, 85, -1},  /* 'W' 'u' */
+    {55, 86, -1},  /* 'W' 'v' */
+    {55, 87, -1},  /* 'W' 'w' */
+    {55, 88, -1},  /* 'W' 'x' */
+    {55, 89, -1},  /* 'W' 'y' */
+    {55, 90, -1},  /* 'W' 'z' */
+    {55, 95, -1},  /* 'W' U+00C4 */
+    {55, 96, -1},  /* 'W' U+00D6 */
+    {55, 99, -1},  /* 'W' U+00E4 */
+    {55, 100, -1},  /* 'W' U+00F6 */
+    {55, 101, -1},  /* 'W' U+00FC */
+    {57, 12, -1},  /* 'Y' ',' */
+    {57, 14, -1},  /* 'Y' '.' */
+    {57, 33, -1},  /* 'Y' 'A' */
+    {57, 42, -1},  /* 'Y' 'J' */
+    {57, 65, -1},  /* 'Y' 'a' */
+    {57, 67, -1},  /* 'Y' 'c' */
+    {57, 68, -1},  /* 'Y' 'd' */
+    {57, 69, -1},  /* 'Y' 'e' */
+    {57, 70, -1},  /* 'Y' 'f' */
+    {57, 71, -1},  /* 'Y' 'g' */
+    {57, 73, -1},  /* 'Y' 'i' */
+    {57, 74, -1},  /* 'Y' 'j' */
+    {57, 76, -1},  /* 'Y' 'l' */
+    {57, 77, -1},  /* 'Y' 'm' */
+    {57, 78, -1},  /* 'Y' 'n' */
+    {57, 79, -1},  /* 'Y' 'o' */
+    {57, 80, -1},  /* 'Y' 'p' */
+    {57, 81, -1},  /* 'Y' 'q' */
+    {57, 82, -1},  /* 'Y' 'r' */
+    {57, 83, -1},  /* 'Y' 's' */
+    {57, 84, -1},  /* 'Y' 't' */
+    {57, 85, -1},  /* 'Y' 'u' */
+    {57, 86, -1},  /* 'Y' 'v' */
+    {57, 87, -1},  /* 'Y' 'w' */
+    {57, 88, -1},  /* 'Y' 'x' */
+    {57, 89, -1},  /* 'Y' 'y' */
+    {57, 90, -1},  /* 'Y' 'z' */
+    {57, 95, -1},  /* 'Y' U+00C4 */
+    {57, 96, -1},  /* 'Y' U+00D6 */
+    {57, 99, -1},  /* 'Y' U+00E4 */
+    {57, 100, -1},  /* 'Y' U+00F6 */
+    {57, 101, -1},  /* 'Y' U+00FC */
+    {65, 52, -1},  /* 'a' 'T' */
+    {65, 54, -1},  /* 'a' 'V' */
+    {65, 55, -1},  /* 'a' 'W' */
+    {65, 57, -1},  /* 'a' 'Y' */
+    {66, 52, -1},  /* 'b' 'T' */
+    {66, 54, -1},  /* 'b' 'V' */
+    {66, 55, -1},  /* 'b' 'W' */
+    {66, 57, -1},  /* 'b' 'Y' */
+    {66, 95, -1},  /* 'b' U+00C4 */
+    {67, 54, -1},  /* 'c' 'V' */
+    {67, 55, -1},  /* 'c' 'W' */
+    {67, 57, -1},  /* 'c' 'Y' */
+    {67, 95, -1},  /* 'c' U+00C4 */
+    {68, 52, -1},  /* 'd' 'T' */
+    {68, 54, -1},  /* 'd' 'V' */
+    {68, 55, -1},  /* 'd' 'W' */
+    {68, 57, -1},  /* 'd' 'Y' */
+    {69, 52, -1},  /* 'e' 'T' */
+    {69, 54, -1},  /* 'e' 'V' */
+    {69, 55, -1},  /* 'e' 'W' */
+    {69, 57, -1},  /* 'e' 'Y' */
+    {71, 33, -1},  /* 'g' 'A' */
+    {71, 54, -1},  /* 'g' 'V' */
+    {71, 55, -1},  /* 'g' 'W' */
+    {71, 57, -1},  /* 'g' 'Y' */
+    {71, 95, -1},  /* 'g' U+00C4 */
+    {72, 52, -1},  /* 'h' 'T' */
+    {72, 54, -1},  /* 'h' 'V' */
+    {72, 55, -1},  /* 'h' 'W' */
+    {72, 57, -1},  /* 'h' 'Y' */
+    {73, 52, -1},  /* 'i' 'T' */
+    {73, 54, -1},  /* 'i' 'V' */
+    {73, 55, -1},  /* 'i' 'W' */
+    {73, 57, -1},  /* 'i' 'Y' */
+    {74, 54, -1},  /* 'j' 'V' */
+    {74, 55, -1},  /* 'j' 'W' */
+    {74, 57, -1},  /* 'j' 'Y' */
+    {75, 54, -1},  /* 'k' 'V' */
+    {75, 55, -1},  /* 'k' 'W' */
+    {75, 57, -1},  /* 'k' 'Y' */
+    {76, 52, -1},  /* 'l' 'T' */
+    {76, 54, -1},  /* 'l' 'V' */
+    {76, 55, -1},  /* 'l' 'W' */
+    {76, 57, -1},  /* 'l' 'Y' */
+    {77, 52, -1},  /* 'm' 'T' */
+    {77, 54, -1},  /* 'm' 'V' */
+    {77, 55, -1},  /* 'm' 'W' */
+    {77, 57, -1},  /* 'm' 'Y' */
+    {78, 52, -1},  /* 'n' 'T' */
+    {78, 54, -1},  /* 'n' 'V' */
+    {78, 55, -1},  /* 'n' 'W' */
+    {78, 57, -1},  /* 'n' 'Y' */
+    {79, 52, -1},  /* 'o' 'T' */
+    {79, 54, -1},  /* 'o' 'V' */
+    {79, 55, -1},  /* 'o' 'W' */
+    {79, 57, -1},  /* 'o' 'Y' */
+    {79, 95, -1},  /* 'o' U+00C4 */
+    {80, 52, -1},  /* 'p' 'T' */
+    {80, 54, -1},  /* 'p' 'V' */
+    {80, 55, -1},  /* 'p' 'W' */
+    {80, 57, -1},  /* 'p' 'Y' */
+    {80, 95, -1},  /* 'p' U+00C4 */
+    {81, 33, -1},  /* 'q' 'A' */
+    {81, 54, -1},  /* 'q' 'V' */
+    {81, 55, -1},  /* 'q' 'W' */
+    {81, 57, -1},  /* 'q' 'Y' */
+    {82, 54, -1},  /* 'r' 'V' */
+    {82, 55, -1},  /* 'r' 'W' */
+    {82, 57, -1},  /* 'r' 'Y' */
+    {83, 54, -1},  /* 's' 'V' */
+    {83, 55, -1},  /* 's' 'W' */
+    {83, 57, -1},  /* 's' 'Y' */
+    {83, 95, -1},  /* 's' U+00C4 */
+    {84, 52, -1},  /* 't' 'T' */
+    {84, 54, -1},  /* 't' 'V' */
+    {84, 55, -1},  /* 't' 'W' */
+    {84, 57, -1},  /* 't' 'Y' */
+    {84, 95, -1},  /* 't' U+00C4 */
+    {85, 52, -1},  /* 'u' 'T' */
+    {85, 54, -1},  /* 'u' 'V' */
+    {85, 55, -1},  /* 'u' 'W' */
+    {85, 57, -1},  /* 'u' 'Y' */
+    {86, 33, -1},  /* 'v' 'A' */
+    {86, 54, -1},  /* 'v' 'V' */
+    {86, 55, -1},  /* 'v' 'W' */
+    {86, 57, -1},  /* 'v' 'Y' */
+    {86, 95, -1},  /* 'v' U+00C4 */
+    {87, 33, -1},  /* 'w' 'A' */
+    {87, 54, -1},  /* 'w' 'V' */
+    {87, 55, -1},  /* 'w' 'W' */
+    {87, 57, -1},  /* 'w' 'Y' */
+    {87, 95, -1},  /* 'w' U+00C4 */
+    {88, 54, -1},  /* 'x' 'V' */
+    {88, 55, -1},  /* 'x' 'W' */
+    {88, 57, -1},  /* 'x' 'Y' */
+    {89, 33, -1},  /* 'y' 'A' */
+    {89, 54, -1},  /* 'y' 'V' */
+    {89, 55, -1},  /* 'y' 'W' */
+    {89, 57, -1},  /* 'y' 'Y' */
+    {89, 95, -1},  /* 'y' U+00C4 */
+    {90, 54, -1},  /* 'z' 'V' */
+    {90, 55, -1},  /* 'z' 'W' */
+    {90, 57, -1},  /* 'z' 'Y' */
+    {95, 35, -1},  /* U+00C4 'C' */
+    {95, 39, -1},  /* U+00C4 'G' */
+    {95, 42, -1},  /* U+00C4 'J' */
+    {95, 47, -1},  /* U+00C4 'O' */
+    {95, 49, -1},  /* U+00C4 'Q' */
+    {95, 52, -1},  /* U+00C4 'T' */
+    {95, 53, -1},  /* U+00C4 'U' */
+    {95, 54, -1},  /* U+00C4 'V' */
+    {95, 55, -1},  /* U+00C4 'W' */
+    {95, 57, -1},  /* U+00C4 'Y' */
+    {95, 65, -1},  /* U+00C4 'a' */
+    {95, 67, -1},  /* U+00C4 'c' */
+    {95, 68, -1},  /* U+00C4 'd' */
+    {95, 69, -1},  /* U+00C4 'e' */
+    {95, 71, -1},  /* U+00C4 'g' */
+    {95, 79, -1},  /* U+00C4 'o' */
+    {95, 81, -1},  /* U+00C4 'q' */
+    {95, 84, -1},  /* U+00C4 't' */
+    {95, 85, -1},  /* U+00C4 'u' */
+    {95, 86, -1},  /* U+00C4 'v' */
+    {95, 87, -1},  /* U+00C4 'w' */
+    {95, 89, -1},  /* U+00C4 'y' */
+    {95, 97, -1},  /* U+00C4 U+00DC */
+    {95, 99, -1},  /* U+00C4 U+00E4 */
+    {95, 100, -1},  /* U+00C4 U+00F6 */
+    {95, 101, -1},  /* U+00C4 U+00FC */
+    {96, 54, -1},  /* U+00D6 'V' */
+    {96, 55, -1},  /* U+00D6 'W' */
+    {96, 57, -1},  /* U+00D6 'Y' */
+    {97, 33, -1},  /* U+00DC 'A' */
+    {97, 95, -1},  /* U+00DC U+00C4 */
+    {98, 95, -1},  /* U+00DF U+00C4 */
+    {99, 52, -1},  /* U+00E4 'T' */
+    {99, 54, -1},  /* U+00E4 'V' */
+    {99, 55, -1},  /* U+00E4 'W' */
+    {99, 57, -1},  /* U+00E4 'Y' */
+    {100, 52, -1},  /* U+00F6 'T' */
+    {100, 54, -1},  /* U+00F6 'V' */
+    {100, 55, -1},  /* U+00F6 'W' */
+    {100, 57, -1},  /* U+00F6 'Y' */
+    {100, 95, -1},  /* U+00F6 U+00C4 */
+    {101, 52, -1},  /* U+00FC 'T' */
+    {101, 54, -1},  /* U+00FC 'V' */
+    {101, 55, -1},  /* U+00FC 'W' */
+    {101, 57, -1},  /* U+00FC 'Y' */
+};
 
-	// @1128 '~' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x24, //   #  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
+static const painter_font_data_t s_data = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = NULL,
+    .bearing = 0,
+    .kerning = NULL,
+    .kerning_num = 0,
 };
 
 const font_t Font12 = {
-  Font12_Table,
-  7, /* Width */
-  12, /* Height */
+    NULL,
+    7, /* Width */
+    12, /* Height */
+    &s_data,
 };
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+static const painter_font_data_t s_datap = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = s_advance,
+    .bearing = 0,
+    .kerning = s_kerning,
+    .kerning_num = 343,
+};
+
+const font_t Font12P = {
+    NULL,
+    8, /* Width */
+    12, /* Height */
+    &s_datap,
+};
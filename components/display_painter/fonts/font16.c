@@ -1,1764 +1,676 @@
-/**
-  ******************************************************************************
-  * @file    font16.cpp
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font16. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
+/* Generated by bdf2font.py from font16.bdf, do not edit
+ *
+ * Courier New bitmap font of the display painter, 11x16 pixels, converted
+ * from font16.c of the STMicroelectronics MCD Application Team. The German
+ * letters were added for the painter.
+ *
+ * COPYRIGHT(c) 2014 STMicroelectronics
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of STMicroelectronics nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
 #include "painter_fonts.h"
 
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font16_Table[] = 
-{
-	// @0 ' ' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @32 '!' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @64 '"' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x1D, 0xC0, //    ### ### 
-	0x08, 0x80, //     #   #  
-	0x08, 0x80, //     #   #  
-	0x08, 0x80, //     #   #  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @96 '#' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x3F, 0xC0, //   ######## 
-	0x1B, 0x00, //    ## ##   
-	0x3F, 0xC0, //   ######## 
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @128 '$' (11 pixels wide)
-	0x04, 0x00, //      #     
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x38, 0x00, //   ###      
-	0x1E, 0x00, //    ####    
-	0x0F, 0x00, //     ####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @160 '%' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x24, 0x00, //   #  #     
-	0x24, 0x00, //   #  #     
-	0x18, 0xC0, //    ##   ## 
-	0x07, 0x80, //      ####  
-	0x1E, 0x00, //    ####    
-	0x31, 0x80, //   ##   ##  
-	0x02, 0x40, //       #  # 
-	0x02, 0x40, //       #  # 
-	0x01, 0x80, //        ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @192 '&' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0F, 0x00, //     ####   
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x1D, 0x80, //    ### ##  
-	0x37, 0x00, //   ## ###   
-	0x33, 0x00, //   ##  ##   
-	0x1D, 0x80, //    ### ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @224 ''' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x07, 0x00, //      ###   
-	0x07, 0x00, //      ###   
-	0x02, 0x00, //       #    
-	0x02, 0x00, //       #    
-	0x02, 0x00, //       #    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @256 '(' (11 pixels wide)
-	0x00, 0x00, //            
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0E, 0x00, //     ###    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0E, 0x00, //     ###    
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @288 ')' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x1C, 0x00, //    ###     
-	0x18, 0x00, //    ##      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @320 '*' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x3F, 0xC0, //   ######## 
-	0x0F, 0x00, //     ####   
-	0x1F, 0x80, //    ######  
-	0x19, 0x80, //    ##  ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @352 '+' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x3F, 0x80, //   #######  
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @384 ',' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x0C, 0x00, //     ##     
-	0x08, 0x00, //     #      
-	0x08, 0x00, //     #      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @416 '-' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @448 '.' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @480 '/' (11 pixels wide)
-	0x00, 0xC0, //         ## 
-	0x00, 0xC0, //         ## 
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @512 '0' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @544 '1' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x3E, 0x00, //   #####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @576 '2' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0F, 0x00, //     ####   
-	0x19, 0x80, //    ##  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @608 '3' (11 pixels wide)
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x61, 0x80, //  ##    ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x61, 0x80, //  ##    ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @640 '4' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x00, //      ###   
-	0x07, 0x00, //      ###   
-	0x0F, 0x00, //     ####   
-	0x0B, 0x00, //     # ##   
-	0x1B, 0x00, //    ## ##   
-	0x13, 0x00, //    #  ##   
-	0x33, 0x00, //   ##  ##   
-	0x3F, 0x80, //   #######  
-	0x03, 0x00, //       ##   
-	0x0F, 0x80, //     #####  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @672 '5' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x1F, 0x00, //    #####   
-	0x11, 0x80, //    #   ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x21, 0x80, //   #    ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @704 '6' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x80, //      ####  
-	0x1C, 0x00, //    ###     
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x19, 0x80, //    ##  ##  
-	0x0F, 0x00, //     ####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @736 '7' (11 pixels wide)
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x43, 0x00, //  #    ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @768 '8' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @800 '9' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x07, 0x00, //      ###   
-	0x3C, 0x00, //   ####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @832 ':' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @864 ';' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x08, 0x00, //     #      
-	0x08, 0x00, //     #      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @896 '<' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0xC0, //         ## 
-	0x03, 0x00, //       ##   
-	0x04, 0x00, //      #     
-	0x18, 0x00, //    ##      
-	0x60, 0x00, //  ##        
-	0x18, 0x00, //    ##      
-	0x04, 0x00, //      #     
-	0x03, 0x00, //       ##   
-	0x00, 0xC0, //         ## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @928 '=' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @960 '>' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x60, 0x00, //  ##        
-	0x18, 0x00, //    ##      
-	0x04, 0x00, //      #     
-	0x03, 0x00, //       ##   
-	0x00, 0xC0, //         ## 
-	0x03, 0x00, //       ##   
-	0x04, 0x00, //      #     
-	0x18, 0x00, //    ##      
-	0x60, 0x00, //  ##        
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @992 '?' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x01, 0x80, //        ##  
-	0x07, 0x00, //      ###   
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1024 '@' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0E, 0x00, //     ###    
-	0x11, 0x00, //    #   #   
-	0x21, 0x00, //   #    #   
-	0x21, 0x00, //   #    #   
-	0x27, 0x00, //   #  ###   
-	0x29, 0x00, //   # #  #   
-	0x29, 0x00, //   # #  #   
-	0x27, 0x00, //   #  ###   
-	0x20, 0x00, //   #        
-	0x11, 0x00, //    #   #   
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1056 'A' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x0F, 0x00, //     ####   
-	0x09, 0x00, //     #  #   
-	0x19, 0x80, //    ##  ##  
-	0x19, 0x80, //    ##  ##  
-	0x1F, 0x80, //    ######  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x79, 0xE0, //  ####  ####
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1088 'B' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1120 'C' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x40, //    ##### # 
-	0x30, 0xC0, //   ##    ## 
-	0x60, 0x40, //  ##      # 
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x60, 0x40, //  ##      # 
-	0x30, 0x80, //   ##    #  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1152 'D' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x31, 0x80, //   ##   ##  
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1184 'E' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x30, 0x80, //   ##    #  
-	0x30, 0x80, //   ##    #  
-	0x32, 0x00, //   ##  #    
-	0x3E, 0x00, //   #####    
-	0x32, 0x00, //   ##  #    
-	0x30, 0x80, //   ##    #  
-	0x30, 0x80, //   ##    #  
-	0x7F, 0x80, //  ########  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1216 'F' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x30, 0x40, //   ##     # 
-	0x30, 0x40, //   ##     # 
-	0x32, 0x00, //   ##  #    
-	0x3E, 0x00, //   #####    
-	0x32, 0x00, //   ##  #    
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7C, 0x00, //  #####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1248 'G' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1E, 0x80, //    #### #  
-	0x31, 0x80, //   ##   ##  
-	0x60, 0x80, //  ##     #  
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x67, 0xC0, //  ##  ##### 
-	0x61, 0x80, //  ##    ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1280 'H' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x80, //   #######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1312 'I' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0xC0, //   ######## 
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1344 'J' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0xC0, //    ####### 
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x63, 0x00, //  ##   ##   
-	0x63, 0x00, //  ##   ##   
-	0x63, 0x00, //  ##   ##   
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1376 'K' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x00, //   ##  ##   
-	0x36, 0x00, //   ## ##    
-	0x3C, 0x00, //   ####     
-	0x3E, 0x00, //   #####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x79, 0xC0, //  ####  ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1408 'L' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7E, 0x00, //  ######    
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x40, //    ##    # 
-	0x18, 0x40, //    ##    # 
-	0x18, 0x40, //    ##    # 
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1440 'M' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xE0, 0xE0, // ###     ###
-	0x60, 0xC0, //  ##     ## 
-	0x71, 0xC0, //  ###   ### 
-	0x7B, 0xC0, //  #### #### 
-	0x6A, 0xC0, //  ## # # ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x60, 0xC0, //  ##     ## 
-	0xFB, 0xE0, // ##### #####
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1472 'N' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x73, 0xC0, //  ###  #### 
-	0x31, 0x80, //   ##   ##  
-	0x39, 0x80, //   ###  ##  
-	0x3D, 0x80, //   #### ##  
-	0x35, 0x80, //   ## # ##  
-	0x37, 0x80, //   ## ####  
-	0x33, 0x80, //   ##  ###  
-	0x31, 0x80, //   ##   ##  
-	0x79, 0x80, //  ####  ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1504 'O' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1536 'P' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7E, 0x00, //  ######    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1568 'Q' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x0C, 0xC0, //     ##  ## 
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1600 'R' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3E, 0x00, //   #####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7C, 0xE0, //  #####  ###
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1632 'S' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x38, 0x00, //   ###      
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1664 'T' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x4C, 0x80, //  #  ##  #  
-	0x4C, 0x80, //  #  ##  #  
-	0x4C, 0x80, //  #  ##  #  
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1696 'U' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1728 'V' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x0A, 0x00, //     # #    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1760 'W' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xFB, 0xE0, // ##### #####
-	0x60, 0xC0, //  ##     ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x2A, 0x80, //   # # # #  
-	0x3B, 0x80, //   ### ###  
-	0x3B, 0x80, //   ### ###  
-	0x31, 0x80, //   ##   ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1792 'X' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1824 'Y' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x79, 0xE0, //  ####  ####
-	0x30, 0xC0, //   ##    ## 
-	0x19, 0x80, //    ##  ##  
-	0x0F, 0x00, //     ####   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1856 'Z' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x21, 0x80, //   #    ##  
-	0x23, 0x00, //   #   ##   
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x0C, 0x00, //     ##     
-	0x18, 0x80, //    ##   #  
-	0x30, 0x80, //   ##    #  
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1888 '[' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x80, //      ####  
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x07, 0x80, //      ####  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1920 '\' (11 pixels wide)
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x00, 0xC0, //         ## 
-	0x00, 0xC0, //         ## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1952 ']' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x1E, 0x00, //    ####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1984 '^' (11 pixels wide)
-	0x04, 0x00, //      #     
-	0x0A, 0x00, //     # #    
-	0x0A, 0x00, //     # #    
-	0x11, 0x00, //    #   #   
-	0x20, 0x80, //   #     #  
-	0x20, 0x80, //   #     #  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2016 '_' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xFF, 0xE0, // ###########
-
-	// @2048 '`' (11 pixels wide)
-	0x08, 0x00, //     #      
-	0x04, 0x00, //      #     
-	0x02, 0x00, //       #    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2080 'a' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2112 'b' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x39, 0x80, //   ###  ##  
-	0x77, 0x00, //  ### ###   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2144 'c' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1E, 0x80, //    #### #  
-	0x31, 0x80, //   ##   ##  
-	0x60, 0x80, //  ##     #  
-	0x60, 0x00, //  ##        
-	0x60, 0x80, //  ##     #  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2176 'd' (11 pixels wide)
-	0x00, 0x00, //            
-	0x03, 0x80, //       ###  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1D, 0x80, //    ### ##  
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2208 'e' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x7F, 0xC0, //  ######### 
-	0x60, 0x00, //  ##        
-	0x30, 0xC0, //   ##    ## 
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2240 'f' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0xE0, //      ######
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x80, //   #######  
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2272 'g' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2304 'h' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2336 'i' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2368 'j' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2400 'k' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x80, //   ## ####  
-	0x36, 0x00, //   ## ##    
-	0x3C, 0x00, //   ####     
-	0x3C, 0x00, //   ####     
-	0x36, 0x00, //   ## ##    
-	0x33, 0x00, //   ##  ##   
-	0x77, 0xC0, //  ### ##### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2432 'l' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2464 'm' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x76, 0xE0, //  ### ## ###
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2496 'n' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x77, 0x00, //  ### ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2528 'o' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2560 'p' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x77, 0x00, //  ### ###   
-	0x39, 0x80, //   ###  ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x39, 0x80, //   ###  ##  
-	0x37, 0x00, //   ## ###   
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7C, 0x00, //  #####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2592 'q' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x07, 0xC0, //      ##### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2624 'r' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0x80, //  #### ###  
-	0x1C, 0xC0, //    ###  ## 
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2656 's' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x3C, 0x00, //   ####     
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2688 't' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x7F, 0x00, //  #######   
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x80, //    ##   #  
-	0x0F, 0x00, //     ####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2720 'u' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x73, 0x80, //  ###  ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2752 'v' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2784 'w' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xF1, 0xE0, // ####   ####
-	0x60, 0xC0, //  ##     ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x3B, 0x80, //   ### ###  
-	0x3B, 0x80, //   ### ###  
-	0x31, 0x80, //   ##   ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2816 'x' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2848 'y' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x79, 0xE0, //  ####  ####
-	0x30, 0xC0, //   ##    ## 
-	0x19, 0x80, //    ##  ##  
-	0x19, 0x80, //    ##  ##  
-	0x0B, 0x00, //     # ##   
-	0x0F, 0x00, //     ####   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const uint8_t s_bitmap[] = {
+    0xFF, 0xFF, 0x30,  /* '!' */
+    0xEF, 0xDD, 0x12, 0x24, 0x40,  /* '"' */
+    0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C,  /* '#' */
+    0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00,  /* '$' */
+    0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06,  /* '%' */
+    0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76,  /* '&' */
+    0xFD, 0x24,  /* '\'' */
+    0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33,  /* '(' */
+    0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC,  /* ')' */
+    0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,  /* '*' */
+    0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,  /* '+' */
+    0x6B, 0x48,  /* ',' */
+    0xFE,  /* '-' */
+    0xF0,  /* '.' */
+    0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0,  /* '/' */
+    0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,  /* '0' */
+    0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,  /* '1' */
+    0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,  /* '2' */
+    0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,  /* '3' */
+    0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,  /* '4' */
+    0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,  /* '5' */
+    0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,  /* '6' */
+    0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,  /* '7' */
+    0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,  /* '8' */
+    0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,  /* '9' */
+    0xF0, 0x3C,  /* ':' */
+    0x33, 0x00, 0x06, 0x48, 0x80,  /* ';' */
+    0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80,  /* '<' */
+    0xFF, 0x80, 0x3F, 0xE0,  /* '=' */
+    0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00,  /* '>' */
+    0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30,  /* '?' */
+    0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80,  /* '@' */
+    0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0,  /* 'A' */
+    0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE,  /* 'B' */
+    0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00,  /* 'C' */
+    0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00,  /* 'D' */
+    0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,  /* 'E' */
+    0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,  /* 'F' */
+    0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00,  /* 'G' */
+    0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80,  /* 'H' */
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,  /* 'I' */
+    0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00,  /* 'J' */
+    0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80,  /* 'K' */
+    0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80,  /* 'L' */
+    0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB, 0xE0,  /* 'M' */
+    0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,  /* 'N' */
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,  /* 'O' */
+    0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC,  /* 'P' */
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0,  /* 'Q' */
+    0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,  /* 'R' */
+    0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC,  /* 'S' */
+    0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,  /* 'T' */
+    0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,  /* 'U' */
+    0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00,  /* 'V' */
+    0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x80,  /* 'W' */
+    0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80,  /* 'X' */
+    0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00,  /* 'Y' */
+    0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE,  /* 'Z' */
+    0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF,  /* '[' */
+    0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03,  /* '\\' */
+    0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,  /* ']' */
+    0x10, 0x50, 0xA2, 0x28, 0x30, 0x40,  /* '^' */
+    0xFF, 0xE0,  /* '_' */
+    0x88, 0x80,  /* '`' */
+    0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,  /* 'a' */
+    0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00,  /* 'b' */
+    0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,  /* 'c' */
+    0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,  /* 'd' */
+    0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,  /* 'e' */
+    0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00,  /* 'f' */
+    0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00,  /* 'g' */
+    0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0,  /* 'h' */
+    0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,  /* 'i' */
+    0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8,  /* 'j' */
+    0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0,  /* 'k' */
+    0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,  /* 'l' */
+    0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC,  /* 'm' */
+    0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,  /* 'n' */
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,  /* 'o' */
+    0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00,  /* 'p' */
+    0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0,  /* 'q' */
+    0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,  /* 'r' */
+    0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00,  /* 's' */
+    0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E,  /* 't' */
+    0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,  /* 'u' */
+    0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70,  /* 'v' */
+    0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60,  /* 'w' */
+    0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE,  /* 'x' */
+    0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F, 0x00,  /* 'y' */
+    0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80,  /* 'z' */
+    0x36, 0x66, 0x66, 0xC6, 0x66, 0x63,  /* '{' */
+    0xFF, 0xFF, 0xFF,  /* '|' */
+    0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C,  /* '}' */
+    0x61, 0x24, 0x30,  /* '~' */
+    0x33, 0x00, 0x07, 0xE0, 0x78, 0x12, 0x0C, 0xC3, 0x30, 0xFC, 0x61, 0x98, 0x6F, 0x3C,  /* U+00C4 */
+    0x66, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x80,  /* U+00D6 */
+    0x66, 0x00, 0x3D, 0xEC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x31, 0x8F, 0x80,  /* U+00DC */
+    0xFD, 0x8F, 0x1E, 0x3F, 0xD8, 0xF1, 0xE3, 0xFD, 0x80,  /* U+00DF */
+    0x66, 0x00, 0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,  /* U+00E4 */
+    0x66, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,  /* U+00F6 */
+    0x66, 0x00, 0x39, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xCE, 0x3B, 0x80,  /* U+00FC */
+};
 
-	// @2880 'z' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x21, 0x80, //   #    ##  
-	0x03, 0x00, //       ##   
-	0x0E, 0x00, //     ###    
-	0x18, 0x00, //    ##      
-	0x30, 0x80, //   ##    #  
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const painter_glyph_dsc_t s_glyphs[] = {
+    {    0,  0,  0,  0,  0},  /* ' ' */
+    {    0,  2, 10,  4,  1},  /* '!' */
+    {    3,  7,  5,  3,  2},  /* '"' */
+    {    8,  8, 11,  2,  1},  /* '#' */
+    {   19,  7, 13,  2,  0},  /* '$' */
+    {   31,  8, 10,  2,  1},  /* '%' */
+    {   41,  7,  9,  2,  2},  /* '&' */
+    {   49,  3,  5,  5,  2},  /* '\'' */
+    {   51,  4, 12,  4,  1},  /* '(' */
+    {   57,  4, 12,  3,  1},  /* ')' */
+    {   63,  8,  7,  2,  1},  /* '*' */
+    {   70,  7,  7,  2,  3},  /* '+' */
+    {   77,  3,  5,  4,  9},  /* ',' */
+    {   79,  7,  1,  2,  6},  /* '-' */
+    {   80,  2,  2,  4,  9},  /* '.' */
+    {   81,  8, 13,  2,  0},  /* '/' */
+    {   94,  7, 10,  2,  1},  /* '0' */
+    {  103,  8, 10,  2,  1},  /* '1' */
+    {  113,  7, 10,  2,  1},  /* '2' */
+    {  122,  8, 10,  1,  1},  /* '3' */
+    {  132,  7, 10,  2,  1},  /* '4' */
+    {  141,  7, 10,  2,  1},  /* '5' */
+    {  150,  7, 10,  2,  1},  /* '6' */
+    {  159,  7, 10,  1,  1},  /* '7' */
+    {  168,  7, 10,  2,  1},  /* '8' */
+    {  177,  7, 10,  2,  1},  /* '9' */
+    {  186,  2,  7,  4,  4},  /* ':' */
+    {  188,  4,  9,  4,  4},  /* ';' */
+    {  193,  9,  9,  1,  2},  /* '<' */
+    {  204,  9,  3,  1,  5},  /* '=' */
+    {  208,  9,  9,  1,  2},  /* '>' */
+    {  219,  7,  9,  2,  2},  /* '?' */
+    {  227,  6, 11,  2,  1},  /* '@' */
+    {  236, 10,  9,  1,  2},  /* 'A' */
+    {  248,  8,  9,  1,  2},  /* 'B' */
+    {  257,  9,  9,  1,  2},  /* 'C' */
+    {  268,  9,  9,  1,  2},  /* 'D' */
+    {  279,  8,  9,  1,  2},  /* 'E' */
+    {  288,  9,  9,  1,  2},  /* 'F' */
+    {  299,  9,  9,  1,  2},  /* 'G' */
+    {  310,  9,  9,  1,  2},  /* 'H' */
+    {  321,  8,  9,  2,  2},  /* 'I' */
+    {  330,  9,  9,  1,  2},  /* 'J' */
+    {  341,  9,  9,  1,  2},  /* 'K' */
+    {  352,  9,  9,  1,  2},  /* 'L' */
+    {  363, 11,  9,  0,  2},  /* 'M' */
+    {  376,  9,  9,  1,  2},  /* 'N' */
+    {  387,  9,  9,  1,  2},  /* 'O' */
+    {  398,  8,  9,  1,  2},  /* 'P' */
+    {  407,  9, 11,  1,  2},  /* 'Q' */
+    {  420, 10,  9,  1,  2},  /* 'R' */
+    {  432,  7,  9,  2,  2},  /* 'S' */
+    {  440,  8,  9,  1,  2},  /* 'T' */
+    {  449,  9,  9,  1,  2},  /* 'U' */
+    {  460,  9,  9,  1,  2},  /* 'V' */
+    {  471, 11,  9,  0,  2},  /* 'W' */
+    {  484,  9,  9,  1,  2},  /* 'X' */
+    {  495, 10,  9,  1,  2},  /* 'Y' */
+    {  507,  7,  9,  2,  2},  /* 'Z' */
+    {  515,  4, 12,  5,  1},  /* '[' */
+    {  521,  8, 13,  2,  0},  /* '\\' */
+    {  534,  4, 12,  3,  1},  /* ']' */
+    {  540,  7,  6,  2,  0},  /* '^' */
+    {  546, 11,  1,  0, 15},  /* '_' */
+    {  548,  3,  3,  4,  0},  /* '`' */
+    {  550,  8,  7,  2,  4},  /* 'a' */
+    {  557,  9, 10,  1,  1},  /* 'b' */
+    {  569,  8,  7,  1,  4},  /* 'c' */
+    {  576,  9, 10,  1,  1},  /* 'd' */
+    {  588,  9,  7,  1,  4},  /* 'e' */
+    {  596,  9, 10,  2,  1},  /* 'f' */
+    {  608,  9, 10,  1,  4},  /* 'g' */
+    {  620,  9, 10,  1,  1},  /* 'h' */
+    {  632,  8, 10,  2,  1},  /* 'i' */
+    {  642,  6, 13,  2,  1},  /* 'j' */
+    {  652,  9, 10,  1,  1},  /* 'k' */
+    {  664,  8, 10,  2,  1},  /* 'l' */
+    {  674, 10,  7,  1,  4},  /* 'm' */
+    {  683,  9,  7,  1,  4},  /* 'n' */
+    {  691,  9,  7,  1,  4},  /* 'o' */
+    {  699,  9, 10,  1,  4},  /* 'p' */
+    {  711,  9, 10,  1,  4},  /* 'q' */
+    {  723,  9,  7,  1,  4},  /* 'r' */
+    {  731,  7,  7,  2,  4},  /* 's' */
+    {  738,  8, 10,  1,  1},  /* 't' */
+    {  748,  9,  7,  1,  4},  /* 'u' */
+    {  756,  9,  7,  1,  4},  /* 'v' */
+    {  764, 11,  7,  0,  4},  /* 'w' */
+    {  774,  9,  7,  1,  4},  /* 'x' */
+    {  782, 10, 10,  1,  4},  /* 'y' */
+    {  795,  7,  7,  2,  4},  /* 'z' */
+    {  802,  4, 12,  3,  1},  /* '{' */
+    {  808,  2, 12,  5,  1},  /* '|' */
+    {  811,  4, 12,  4,  1},  /* '}' */
+    {  817,  7,  3,  2,  5},  /* '~' */
+    {  820, 10, 11,  1,  0},  /* U+00C4 */
+    {  834,  9, 11,  1,  0},  /* U+00D6 */
+    {  847,  9, 11,  1,  0},  /* U+00DC */
+    {  860,  7, 10,  2,  2},  /* U+00DF */
+    {  869,  8,  9,  2,  2},  /* U+00E4 */
+    {  878,  9,  9,  1,  2},  /* U+00F6 */
+    {  889,  9,  9,  1,  2},  /* U+00FC */
+};
 
-	// @2912 '{' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const painter_font_range_t s_ranges[] = {
+    {0x0020, 95, 0},
+    {0x00C4, 1, 95},
+    {0x00D6, 1, 96},
+    {0x00DC, 1, 97},
+    {0x00DF, 1, 98},
+    {0x00E4, 1, 99},
+    {0x00F6, 1, 100},
+    {0x00FC, 1, 101},
+};
 
-	// @2944 '|' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const uint8_t s_advance[] = {
+    6, 3, 8, 9, 8, 9, 8, 4, 5, 5, 9, 8, 4, 8, 3, 9,
+    8, 9, 8, 9, 8, 8, 8, 8, 8, 8, 3, 5, 10, 10, 10, 8,
+    7, 11, 9, 10, 10, 9, 10, 10, 10, 9, 10, 10, 10, 12, 10, 10,
+    9, 10, 11, 8, 9, 10, 10, 12, 10, 11, 8, 5, 9, 5, 8, 12,
+    4, 9, 10, 9, 10, 10, 10, 10, 10, 9, 7, 10, 9, 11, 10, 10,
+    10, 10, 10, 8, 9, 10, 10, 12, 10, 11, 8, 5, 3, 5, 8, 11,
+    10, 10, 8, 9, 10, 10,
+};
 
-	// @2976 '}' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const painter_font_kern_t s_kerning[] = {
+    {12, 52, -1},  /* ',' 'T' */
+    {12, 54, -2},  /* ',' 'V' */
+    {12, 55, -2},  /* ',' 'W' */
+    {12, 57, -2},  /* ',' 'Y' */
+    {14, 52, -1},  /* '.' 'T' */
+    {14, 54, -2},  /* '.' 'V' */
+    {14, 55, -2},  /* '.' 'W' */
+    {14, 57, -2},  /* '.' 'Y' */
+    {33, 35, -1},  /* 'A' 'C' */
+    {33, 39, -1},  /* 'A' 'G' */
+    {33, 47, -1},  /* 'A' 'O' */
+    {33, 49, -1},  /* 'A' 'Q' */
+    {33, 52, -1},  /* 'A' 'T' */
+    {33, 53, -1},  /* 'A' 'U' */
+    {33, 54, -2},  /* 'A' 'V' */
+    {33, 55, -2},  /* 'A' 'W' */
+    {33, 57, -2},  /* 'A' 'Y' */
+    {33, 67, -1},  /* 'A' 'c' */
+    {33, 68, -1},  /* 'A' 'd' */
+    {33, 69, -1},  /* 'A' 'e' */
+    {33, 71, -1},  /* 'A' 'g' */
+    {33, 74, -2},  /* 'A' 'j' */
+    {33, 79, -1},  /* 'A' 'o' */
+    {33, 80, -1},  /* 'A' 'p' */
+    {33, 81, -1},  /* 'A' 'q' */
+    {33, 84, -2},  /* 'A' 't' */
+    {33, 85, -1},  /* 'A' 'u' */
+    {33, 86, -2},  /* 'A' 'v' */
+    {33, 87, -2},  /* 'A' 'w' */
+    {33, 89, -2},  /* 'A' 'y' */
+    {33, 96, -1},  /* 'A' U+00D6 */
+    {33, 97, -1},  /* 'A' U+00DC */
+    {33, 100, -1},  /* 'A' U+00F6 */
+    {33, 101, -1},  /* 'A' U+00FC */
+    {35, 33, -1},  /* 'C' 'A' */
+    {35, 95, -1},  /* 'C' U+00C4 */
+    {36, 33, -1},  /* 'D' 'A' */
+    {36, 54, -1},  /* 'D' 'V' */
+    {36, 55, -1},  /* 'D' 'W' */
+    {36, 57, -1},  /* 'D' 'Y' */
+    {36, 95, -1},  /* 'D' U+00C4 */
+    {38, 12, -2},  /* 'F' ',' */
+    {38, 14, -2},  /* 'F' '.' */
+    {38, 33, -1},  /* 'F' 'A' */
+    {38, 42, -2},  /* 'F' 'J' */
+    {38, 65, -1},  /* 'F' 'a' */
+    {38, 67, -1},  /* 'F' 'c' */
+    {38, 68, -1},  /* 'F' 'd' */
+    {38, 69, -1},  /* 'F' 'e' */
+    {38, 71, -1},  /* 'F' 'g' */
+    {38, 73, -1},  /* 'F' 'i' */
+    {38, 76, -1},  /* 'F' 'l' */
+    {38, 79, -1},  /* 'F' 'o' */
+    {38, 81, -1},  /* 'F' 'q' */
+    {38, 95, -1},  /* 'F' U+00C4 */
+    {38, 99, -1},  /* 'F' U+00E4 */
+    {38, 100, -1},  /* 'F' U+00F6 */
+    {39, 33, -1},  /* 'G' 'A' */
+    {39, 52, -1},  /* 'G' 'T' */
+    {39, 54, -1},  /* 'G' 'V' */
+    {39, 55, -1},  /* 'G' 'W' */
+    {39, 57, -1},  /* 'G' 'Y' */
+    {39, 95, -1},  /* 'G' U+00C4 */
+    {42, 33, -1},  /* 'J' 'A' */
+    {42, 95, -1},  /* 'J' U+00C4 */
+    {44, 52, -1},  /* 'L' 'T' */
+    {44, 53, -1},  /* 'L' 'U' */
+    {44, 54, -2},  /* 'L' 'V' */
+    {44, 55, -1},  /* 'L' 'W' */
+    {44, 57, -2},  /* 'L' 'Y' */
+    {44, 74, -2},  /* 'L' 'j' */
+    {44, 80, -1},  /* 'L' 'p' */
+    {44, 84, -2},  /* 'L' 't' */
+    {44, 85, -1},  /* 'L' 'u' */
+    {44, 86, -1},  /* 'L' 'v' */
+    {44, 87, -1},  /* 'L' 'w' */
+    {44, 89, -2},  /* 'L' 'y' */
+    {44, 97, -1},  /* 'L' U+00DC */
+    {44, 101, -1},  /* 'L' U+00FC */
+    {46, 33, -1},  /* 'N' 'A' */
+    {46, 95, -1},  /* 'N' U+00C4 */
+    {47, 33, -1},  /* 'O' 'A' */
+    {47, 54, -1},  /* 'O' 'V' */
+    {47, 55, -1},  /* 'O' 'W' */
+    {47, 57, -1},  /* 'O' 'Y' */
+    {47, 95, -1},  /* 'O' U+00C4 */
+    {48, 12, -2},  /* 'P' ',' */
+    {48, 14, -2},  /* 'P' '.' */
+    {48, 33, -1},  /* 'P' 'A' */
+    {48, 65, -1},  /* 'P' 'a' */
+    {48, 66, -1},  /* 'P' 'b' */
+    {48, 72, -1},  /* 'P' 'h' */
+    {48, 73, -1},  /* 'P' 'i' */
+    {48, 75, -1},  /* 'P' 'k' */
+    {48, 76, -2},  /* 'P' 'l' */
+    {48, 95, -1},  /* 'P' U+00C4 */
+    {48, 99, -1},  /* 'P' U+00E4 */
+    {49, 54, -1},  /* 'Q' 'V' */
+    {49, 55, -1},  /* 'Q' 'W' */
+    {49, 57, -1},  /* 'Q' 'Y' */
+    {50, 52, -1},  /* 'R' 'T' */
+    {50, 54, -2},  /* 'R' 'V' */
+    {50, 55, -2},  /* 'R' 'W' */
+    {50, 57, -2},  /* 'R' 'Y' */
+    {52, 12, -1},  /* 'T' ',' */
+    {52, 14, -1},  /* 'T' '.' */
+    {52, 33, -1},  /* 'T' 'A' */
+    {52, 42, -1},  /* 'T' 'J' */
+    {52, 65, -1},  /* 'T' 'a' */
+    {52, 73, -1},  /* 'T' 'i' */
+    {52, 76, -1},  /* 'T' 'l' */
+    {52, 95, -1},  /* 'T' U+00C4 */
+    {52, 99, -1},  /* 'T' U+00E4 */
+    {53, 33, -1},  /* 'U' 'A' */
+    {53, 95, -1},  /* 'U' U+00C4 */
+    {54, 12, -2},  /* 'V' ',' */
+    {54, 14, -2},  /* 'V' '.' */
+    {54, 33, -1},  /* 'V' 'A' */
+    {54, 35, -1},  /* 'V' 'C' */
+    {54, 39, -1},  /* 'V' 'G' */
+    {54, 42, -2},  /* 'V' 'J' */
+    {54, 47, -1},  /* 'V' 'O' */
+    {54, 49, -1},  /* 'V' 'Q' */
+    {54, 65, -2},  /* 'V' 'a' */
+    {54, 67, -2},  /* 'V' 'c' */
+    {54, 68, -2},  /* 'V' 'd' */
+    {54, 69, -2},  /* 'V' 'e' */
+    {54, 70, -1},  /* 'V' 'f' */
+    {54, 71, -2},  /* 'V' 'g' */
+    {54, 73, -2},  /* 'V' 'i' */
+    {54, 74, -1},  /* 'V' 'j' */
+    {54, 76, -1},  /* 'V' 'l' */
+    {54, 77, -1},  /* 'V' 'm' */
+    {54, 78, -1},  /* 'V' 'n' */
+    {54, 79, -2},  /* 'V' 'o' */
+    {54, 80, -1},  /* 'V' 'p' */
+    {54, 81, -2},  /* 'V' 'q' */
+    {54, 82, -1},  /* 'V' 'r' */
+    {54, 83, -1},  /* 'V' 's' */
+    {54, 84, -1},  /* 'V' 't' */
+    {54, 85, -1},  /* 'V' 'u' */
+    {54, 86, -1},  /* 'V' 'v' */
+    {54, 87, -1},  /* 'V' 'w' */
+    {54, 88, -1},  /* 'V' 'x' */
+    {54, 89, -1},  /* 'V' 'y' */
+    {54, 90, -1},  /* 'V' 'z' */
+    {54, 95, -1},  /* 'V' U+00C4 */
+    {54, 96, -1},  /* 'V' U+00D6 */
+    {54, 99, -1},  /* 'V' U+00E4 */
+    {54, 100, -1},  /* 'V' U+00F6 */
+    {54, 101, -1},  /* 'V' U+00FC */
+    {55, 12, -2},  /* 'W' ',' */
+    {55, 14, -2},  /* 'W' '.' */
+    {55, 33, -1},  /* 'W' 'A' */
+    {55, 35, -1},  /* 'W' 'C' */
+    {55, 39, -1},  /* 'W' 'G' */
+    {55, 42, -1},  /* 'W' 'J' */
+    {55, 47, -1},  /* 'W' 'O' */
+    {55, 49, -1},  /* 'W' 'Q' */
+    {55, 65, -2},  /* 'W' 'a' */
+    {55, 67, -1},  /* 'W' 'c' */
+    {55, 68, -1},  /* 'W' 'd' */
+    {55, 69, -1},  /* 'W' 'e' */
+    {55, 70, -1},  /* 'W' 'f' */
+    {55, 71, -1},  /* 'W' 'g' */
+    {55, 73, -2},  /* 'W' 'i' */
+    {55, 74, -1},  /* 'W' 'j' */
+    {55, 76, -1},  /* 'W' 'l' */
+    {55, 77, -1},  /* 'W' 'm' */
+    {55, 78, -1},  /* 'W' 'n' */
+    {55, 79, -1},  /* 'W' 'o' */
+    {55, 80, -1},  /* 'W' 'p' */
+    {55, 81, -1},  /* 'W' 'q' */
+    {55, 82, -1},  /* 'W' 'r' */
+    {55, 83, -1},  /* 'W' 's' */
+    {55, 84, -1},  /* 'W' 't' */
+    {55, 85, -1},  /* 'W' 'u' */
+    {55, 86, -1},  /* 'W' 'v' */
+    {55, 87, -1},  /* 'W' 'w' */
+    {55, 88, -1},  /* 'W' 'x' */
+    {55, 89, -1},  /* 'W' 'y' */
+    {55, 90, -1},  /* 'W' 'z' */
+    {55, 95, -1},  /* 'W' U+00C4 */
+    {55, 96, -1},  /* 'W' U+00D6 */
+    {55, 99, -1},  /* 'W' U+00E4 */
+    {55, 100, -1},  /* 'W' U+00F6 */
+    {55, 101, -1},  /* 'W' U+00FC */
+    {57, 12, -2},  /* 'Y' ',' */
+    {57, 14, -2},  /* 'Y' '.' */
+    {57, 33, -1},  /* 'Y' 'A' */
+    {57, 35, -1},  /* 'Y' 'C' */
+    {57, 39, -1},  /* 'Y' 'G' */
+    {57, 42, -2},  /* 'Y' 'J' */
+    {57, 47, -1},  /* 'Y' 'O' */
+    {57, 49, -1},  /* 'Y' 'Q' */
+    {57, 65, -2},  /* 'Y' 'a' */
+    {57, 67, -2},  /* 'Y' 'c' */
+    {57, 68, -2},  /* 'Y' 'd' */
+    {57, 69, -2},  /* 'Y' 'e' */
+    {57, 70, -1},  /* 'Y' 'f' */
+    {57, 71, -2},  /* 'Y' 'g' */
+    {57, 73, -2},  /* 'Y' 'i' */
+    {57, 74, -1},  /* 'Y' 'j' */
+    {57, 76, -1},  /* 'Y' 'l' */
+    {57, 77, -1},  /* 'Y' 'm' */
+    {57, 78, -1},  /* 'Y' 'n' */
+    {57, 79, -2},  /* 'Y' 'o' */
+    {57, 80, -1},  /* 'Y' 'p' */
+    {57, 81, -2},  /* 'Y' 'q' */
+    {57, 82, -1},  /* 'Y' 'r' */
+    {57, 83, -2},  /* 'Y' 's' */
+    {57, 84, -1},  /* 'Y' 't' */
+    {57, 85, -1},  /* 'Y' 'u' */
+    {57, 86, -1},  /* 'Y' 'v' */
+    {57, 87, -1},  /* 'Y' 'w' */
+    {57, 88, -1},  /* 'Y' 'x' */
+    {57, 89, -1},  /* 'Y' 'y' */
+    {57, 90, -1},  /* 'Y' 'z' */
+    {57, 95, -1},  /* 'Y' U+00C4 */
+    {57, 96, -1},  /* 'Y' U+00D6 */
+    {57, 99, -1},  /* 'Y' U+00E4 */
+    {57, 100, -1},  /* 'Y' U+00F6 */
+    {57, 101, -1},  /* 'Y' U+00FC */
+    {65, 52, -1},  /* 'a' 'T' */
+    {65, 54, -2},  /* 'a' 'V' */
+    {65, 55, -2},  /* 'a' 'W' */
+    {65, 57, -2},  /* 'a' 'Y' */
+    {66, 33, -1},  /* 'b' 'A' */
+    {66, 54, -2},  /* 'b' 'V' */
+    {66, 55, -1},  /* 'b' 'W' */
+    {66, 57, -2},  /* 'b' 'Y' */
+    {66, 95, -1},  /* 'b' U+00C4 */
+    {67, 54, -1},  /* 'c' 'V' */
+    {67, 55, -1},  /* 'c' 'W' */
+    {67, 57, -1},  /* 'c' 'Y' */
+    {68, 52, -1},  /* 'd' 'T' */
+    {68, 54, -1},  /* 'd' 'V' */
+    {68, 55, -1},  /* 'd' 'W' */
+    {68, 57, -1},  /* 'd' 'Y' */
+    {69, 54, -2},  /* 'e' 'V' */
+    {69, 55, -1},  /* 'e' 'W' */
+    {69, 57, -2},  /* 'e' 'Y' */
+    {70, 33, -1},  /* 'f' 'A' */
+    {70, 95, -1},  /* 'f' U+00C4 */
+    {71, 33, -1},  /* 'g' 'A' */
+    {71, 54, -1},  /* 'g' 'V' */
+    {71, 55, -1},  /* 'g' 'W' */
+    {71, 57, -1},  /* 'g' 'Y' */
+    {71, 95, -1},  /* 'g' U+00C4 */
+    {72, 52, -1},  /* 'h' 'T' */
+    {72, 54, -2},  /* 'h' 'V' */
+    {72, 55, -2},  /* 'h' 'W' */
+    {72, 57, -2},  /* 'h' 'Y' */
+    {73, 52, -1},  /* 'i' 'T' */
+    {73, 54, -2},  /* 'i' 'V' */
+    {73, 55, -2},  /* 'i' 'W' */
+    {73, 57, -2},  /* 'i' 'Y' */
+    {74, 54, -1},  /* 'j' 'V' */
+    {74, 55, -1},  /* 'j' 'W' */
+    {74, 57, -1},  /* 'j' 'Y' */
+    {75, 52, -1},  /* 'k' 'T' */
+    {75, 54, -2},  /* 'k' 'V' */
+    {75, 55, -2},  /* 'k' 'W' */
+    {75, 57, -2},  /* 'k' 'Y' */
+    {76, 52, -1},  /* 'l' 'T' */
+    {76, 54, -2},  /* 'l' 'V' */
+    {76, 55, -2},  /* 'l' 'W' */
+    {76, 57, -2},  /* 'l' 'Y' */
+    {77, 52, -1},  /* 'm' 'T' */
+    {77, 54, -2},  /* 'm' 'V' */
+    {77, 55, -2},  /* 'm' 'W' */
+    {77, 57, -2},  /* 'm' 'Y' */
+    {78, 52, -1},  /* 'n' 'T' */
+    {78, 54, -2},  /* 'n' 'V' */
+    {78, 55, -2},  /* 'n' 'W' */
+    {78, 57, -2},  /* 'n' 'Y' */
+    {79, 33, -1},  /* 'o' 'A' */
+    {79, 54, -2},  /* 'o' 'V' */
+    {79, 55, -1},  /* 'o' 'W' */
+    {79, 57, -2},  /* 'o' 'Y' */
+    {79, 95, -1},  /* 'o' U+00C4 */
+    {80, 33, -1},  /* 'p' 'A' */
+    {80, 54, -2},  /* 'p' 'V' */
+    {80, 55, -1},  /* 'p' 'W' */
+    {80, 57, -2},  /* 'p' 'Y' */
+    {80, 95, -1},  /* 'p' U+00C4 */
+    {81, 33, -1},  /* 'q' 'A' */
+    {81, 54, -1},  /* 'q' 'V' */
+    {81, 55, -1},  /* 'q' 'W' */
+    {81, 57, -1},  /* 'q' 'Y' */
+    {81, 95, -1},  /* 'q' U+00C4 */
+    {82, 33, -2},  /* 'r' 'A' */
+    {82, 54, -1},  /* 'r' 'V' */
+    {82, 55, -1},  /* 'r' 'W' */
+    {82, 57, -2},  /* 'r' 'Y' */
+    {82, 95, -2},  /* 'r' U+00C4 */
+    {83, 54, -1},  /* 's' 'V' */
+    {83, 55, -1},  /* 's' 'W' */
+    {83, 57, -1},  /* 's' 'Y' */
+    {84, 52, -1},  /* 't' 'T' */
+    {84, 54, -2},  /* 't' 'V' */
+    {84, 55, -2},  /* 't' 'W' */
+    {84, 57, -2},  /* 't' 'Y' */
+    {85, 52, -1},  /* 'u' 'T' */
+    {85, 54, -2},  /* 'u' 'V' */
+    {85, 55, -2},  /* 'u' 'W' */
+    {85, 57, -2},  /* 'u' 'Y' */
+    {86, 33, -2},  /* 'v' 'A' */
+    {86, 54, -1},  /* 'v' 'V' */
+    {86, 55, -1},  /* 'v' 'W' */
+    {86, 57, -1},  /* 'v' 'Y' */
+    {86, 95, -2},  /* 'v' U+00C4 */
+    {87, 33, -2},  /* 'w' 'A' */
+    {87, 54, -1},  /* 'w' 'V' */
+    {87, 55, -1},  /* 'w' 'W' */
+    {87, 57, -1},  /* 'w' 'Y' */
+    {87, 95, -2},  /* 'w' U+00C4 */
+    {88, 54, -1},  /* 'x' 'V' */
+    {88, 55, -1},  /* 'x' 'W' */
+    {88, 57, -1},  /* 'x' 'Y' */
+    {89, 33, -2},  /* 'y' 'A' */
+    {89, 54, -1},  /* 'y' 'V' */
+    {89, 55, -1},  /* 'y' 'W' */
+    {89, 57, -1},  /* 'y' 'Y' */
+    {89, 95, -2},  /* 'y' U+00C4 */
+    {90, 54, -1},  /* 'z' 'V' */
+    {90, 55, -1},  /* 'z' 'W' */
+    {90, 57, -1},  /* 'z' 'Y' */
+    {95, 35, -1},  /* U+00C4 'C' */
+    {95, 39, -1},  /* U+00C4 'G' */
+    {95, 47, -1},  /* U+00C4 'O' */
+    {95, 49, -1},  /* U+00C4 'Q' */
+    {95, 52, -1},  /* U+00C4 'T' */
+    {95, 53, -1},  /* U+00C4 'U' */
+    {95, 54, -2},  /* U+00C4 'V' */
+    {95, 55, -2},  /* U+00C4 'W' */
+    {95, 57, -2},  /* U+00C4 'Y' */
+    {95, 67, -1},  /* U+00C4 'c' */
+    {95, 68, -1},  /* U+00C4 'd' */
+    {95, 69, -1},  /* U+00C4 'e' */
+    {95, 71, -1},  /* U+00C4 'g' */
+    {95, 74, -2},  /* U+00C4 'j' */
+    {95, 79, -1},  /* U+00C4 'o' */
+    {95, 80, -1},  /* U+00C4 'p' */
+    {95, 81, -1},  /* U+00C4 'q' */
+    {95, 84, -2},  /* U+00C4 't' */
+    {95, 85, -1},  /* U+00C4 'u' */
+    {95, 86, -2},  /* U+00C4 'v' */
+    {95, 87, -2},  /* U+00C4 'w' */
+    {95, 89, -2},  /* U+00C4 'y' */
+    {95, 96, -1},  /* U+00C4 U+00D6 */
+    {95, 97, -1},  /* U+00C4 U+00DC */
+    {95, 100, -1},  /* U+00C4 U+00F6 */
+    {95, 101, -1},  /* U+00C4 U+00FC */
+    {96, 33, -1},  /* U+00D6 'A' */
+    {96, 54, -1},  /* U+00D6 'V' */
+    {96, 55, -1},  /* U+00D6 'W' */
+    {96, 57, -1},  /* U+00D6 'Y' */
+    {96, 95, -1},  /* U+00D6 U+00C4 */
+    {97, 33, -1},  /* U+00DC 'A' */
+    {97, 95, -1},  /* U+00DC U+00C4 */
+    {99, 52, -1},  /* U+00E4 'T' */
+    {99, 54, -1},  /* U+00E4 'V' */
+    {99, 55, -1},  /* U+00E4 'W' */
+    {99, 57, -1},  /* U+00E4 'Y' */
+    {100, 33, -1},  /* U+00F6 'A' */
+    {100, 54, -2},  /* U+00F6 'V' */
+    {100, 55, -1},  /* U+00F6 'W' */
+    {100, 57, -2},  /* U+00F6 'Y' */
+    {100, 95, -1},  /* U+00F6 U+00C4 */
+    {101, 52, -1},  /* U+00FC 'T' */
+    {101, 54, -2},  /* U+00FC 'V' */
+    {101, 55, -2},  /* U+00FC 'W' */
+    {101, 57, -2},  /* U+00FC 'Y' */
+};
 
-	// @3008 '~' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x24, 0x80, //   #  #  #  
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const painter_font_data_t s_data = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = NULL,
+    .bearing = 0,
+    .kerning = NULL,
+    .kerning_num = 0,
 };
 
 const font_t Font16 = {
-  Font16_Table,
-  11, /* Width */
-  16, /* Height */
+    NULL,
+    11, /* Width */
+    16, /* Height */
+    &s_data,
 };
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+static const painter_font_data_t s_datap = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = s_advance,
+    .bearing = 0,
+    .kerning = s_kerning,
+    .kerning_num = 374,
+};
+
+const font_t Font16P = {
+    NULL,
+    12, /* Width */
+    16, /* Height */
+    &s_datap,
+};
@@ -1,2142 +1,685 @@
-/**
-  ******************************************************************************
-  * @file    font20.cpp
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font20. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
+/* Generated by bdf2font.py from font20.bdf, do not edit
+ *
+ * Courier New bitmap font of the display painter, 14x20 pixels, converted
+ * from font20.c of the STMicroelectronics MCD Application Team. The German
+ * letters were added for the painter.
+ *
+ * COPYRIGHT(c) 2014 STMicroelectronics
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of STMicroelectronics nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
 #include "painter_fonts.h"
 
-// Character bitmaps for Courier New 15pt
-const uint8_t Font20_Table[] = 
-{
-	// @0 ' ' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @40 '!' (14 pixels wide)
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x02, 0x00, //       #       
-	0x02, 0x00, //       #       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @80 '"' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @120 '#' (14 pixels wide)
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @160 '$' (14 pixels wide)
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0xE0, //      ######   
-	0x0F, 0xE0, //     #######   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x00, //    ##         
-	0x1F, 0x00, //    #####      
-	0x0F, 0xC0, //     ######    
-	0x00, 0xE0, //         ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0x80, //    ######     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @200 '%' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x1C, 0x60, //    ###   ##   
-	0x01, 0xE0, //        ####   
-	0x0F, 0x80, //     #####     
-	0x3C, 0x00, //   ####        
-	0x31, 0xC0, //   ##   ###    
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @240 '&' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x0F, 0x30, //     ####  ##  
-	0x1F, 0xF0, //    #########  
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @280 ''' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @320 '(' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @360 ')' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @400 '*' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1B, 0x60, //    ## ## ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @440 '+' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @480 ',' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @520 '-' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @560 '.' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @600 '/' (14 pixels wide)
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @640 '0' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @680 '1' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @720 '2' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @760 '3' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x3F, 0xC0, //   ########    
-	0x30, 0xE0, //   ##    ###   
-	0x00, 0x60, //          ##   
-	0x00, 0xE0, //         ###   
-	0x07, 0xC0, //      #####    
-	0x07, 0xC0, //      #####    
-	0x00, 0xE0, //         ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x60, 0xE0, //  ##     ###   
-	0x7F, 0xC0, //  #########    
-	0x3F, 0x80, //   #######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @800 '4' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0xC0, //   ##    ##    
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0xC0, //         ##    
-	0x03, 0xE0, //       #####   
-	0x03, 0xE0, //       #####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @840 '5' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1F, 0x80, //    ######     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @880 '6' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x1E, 0x00, //    ####       
-	0x18, 0x00, //    ##         
-	0x38, 0x00, //   ###         
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xC0, //   ########    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @920 '7' (14 pixels wide)
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @960 '8' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1000 '9' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x1F, 0xC0, //    #######    
-	0x38, 0xC0, //   ###   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xE0, //    ########   
-	0x0F, 0x60, //     #### ##   
-	0x00, 0xE0, //         ###   
-	0x00, 0xC0, //         ##    
-	0x03, 0xC0, //       ####    
-	0x3F, 0x80, //   #######     
-	0x3E, 0x00, //   #####       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1040 ':' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1080 ';' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1120 '<' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x30, //           ##  
-	0x00, 0xF0, //         ####  
-	0x03, 0xC0, //       ####    
-	0x07, 0x00, //      ###      
-	0x1C, 0x00, //    ###        
-	0x78, 0x00, //  ####         
-	0x1C, 0x00, //    ###        
-	0x07, 0x00, //      ###      
-	0x03, 0xC0, //       ####    
-	0x00, 0xF0, //         ####  
-	0x00, 0x30, //           ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1160 '=' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1200 '>' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x30, 0x00, //   ##          
-	0x3C, 0x00, //   ####        
-	0x0F, 0x00, //     ####      
-	0x03, 0x80, //       ###     
-	0x00, 0xE0, //         ###   
-	0x00, 0x78, //          #### 
-	0x00, 0xE0, //         ###   
-	0x03, 0x80, //       ###     
-	0x0F, 0x00, //     ####      
-	0x3C, 0x00, //   ####        
-	0x30, 0x00, //   ##          
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1240 '?' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x00, 0x60, //          ##   
-	0x01, 0xC0, //        ###    
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1280 '@' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x0C, 0x80, //     ##  #     
-	0x08, 0x40, //     #    #    
-	0x10, 0x40, //    #     #    
-	0x10, 0x40, //    #     #    
-	0x11, 0xC0, //    #   ###    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x11, 0xC0, //    #   ###    
-	0x10, 0x00, //    #          
-	0x08, 0x00, //     #         
-	0x08, 0x40, //     #    #    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1320 'A' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x03, 0x80, //       ###     
-	0x06, 0xC0, //      ## ##    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x30, 0x30, //   ##      ##  
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1360 'B' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x80, //   #######     
-	0x3F, 0xC0, //   ########    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xE0, //    ########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1400 'C' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x1C, 0x70, //    ###   ###  
-	0x38, 0x30, //   ###     ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1C, 0x70, //    ###   ###  
-	0x0F, 0xE0, //     #######   
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1440 'D' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0x80, //  ########     
-	0x7F, 0xC0, //  #########    
-	0x30, 0xE0, //   ##    ###   
-	0x30, 0x70, //   ##     ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x70, //   ##     ###  
-	0x30, 0xE0, //   ##    ###   
-	0x7F, 0xC0, //  #########    
-	0x7F, 0x80, //  ########     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1480 'E' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1520 'F' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1560 'G' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x31, 0xF8, //   ##   ###### 
-	0x31, 0xF8, //   ##   ###### 
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1600 'H' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1640 'I' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1680 'J' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xF8, //       ####### 
-	0x03, 0xF8, //       ####### 
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1720 'K' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3E, 0xF8, //   ##### ##### 
-	0x3E, 0xF8, //   ##### ##### 
-	0x18, 0xE0, //    ##   ###   
-	0x19, 0x80, //    ##  ##     
-	0x1B, 0x00, //    ## ##      
-	0x1F, 0x00, //    #####      
-	0x1D, 0x80, //    ### ##     
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0x60, //    ##    ##   
-	0x3E, 0x78, //   #####  #### 
-	0x3E, 0x38, //   #####   ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1760 'L' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1800 'M' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x38, 0x70, //   ###    ###  
-	0x3C, 0xF0, //   ####  ####  
-	0x34, 0xB0, //   ## #  # ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x30, 0x30, //   ##      ##  
-	0x7C, 0xF8, //  #####  ##### 
-	0x7C, 0xF8, //  #####  ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1840 'N' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x39, 0xF0, //   ###  #####  
-	0x3D, 0xF0, //   #### #####  
-	0x1C, 0x60, //    ###   ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x19, 0xE0, //    ##  ####   
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xE0, //    ##   ###   
-	0x3E, 0xE0, //   ##### ###   
-	0x3E, 0x60, //   #####  ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1880 'O' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1920 'P' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1960 'Q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x0C, 0xE0, //     ##  ###   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2000 'R' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x70, //    ##    ###  
-	0x3E, 0x38, //   #####   ### 
-	0x3E, 0x18, //   #####    ## 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2040 'S' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xB0, //     ##### ##  
-	0x1F, 0xF0, //    #########  
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x00, //   ###         
-	0x1F, 0x80, //    ######     
-	0x07, 0xE0, //      ######   
-	0x00, 0x70, //          ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x3F, 0xE0, //   #########   
-	0x37, 0xC0, //   ## #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2080 'T' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2120 'U' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2160 'V' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2200 'W' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7C, 0x7C, //  #####   #####
-	0x7C, 0x7C, //  #####   #####
-	0x30, 0x18, //   ##       ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x36, 0xD8, //   ## ## ## ## 
-	0x16, 0xD0, //    # ## ## #  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x18, 0x30, //    ##     ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2240 'X' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2280 'Y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2320 'Z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2360 '[' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2400 '\' (14 pixels wide)
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2440 ']' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2480 '^' (14 pixels wide)
-	0x00, 0x00, //               
-	0x02, 0x00, //       #       
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x20, 0x20, //   #       #   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2520 '_' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0xFF, 0xFC, // ##############
-	0xFF, 0xFC, // ##############
-
-	// @2560 '`' (14 pixels wide)
-	0x00, 0x00, //               
-	0x04, 0x00, //      #        
-	0x03, 0x00, //       ##      
-	0x00, 0x80, //         #     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2600 'a' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xC0, //     ######    
-	0x1F, 0xE0, //    ########   
-	0x00, 0x60, //          ##   
-	0x0F, 0xE0, //     #######   
-	0x1F, 0xE0, //    ########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xF0, //   ##########  
-	0x1F, 0x70, //    ##### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2640 'b' (14 pixels wide)
-	0x00, 0x00, //               
-	0x70, 0x00, //  ###          
-	0x70, 0x00, //  ###          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xE0, //   #########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x7F, 0xE0, //  ##########   
-	0x77, 0x80, //  ### ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2680 'c' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x30, //    ##     ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1F, 0xF0, //    #########  
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2720 'd' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x70, //          ###  
-	0x00, 0x70, //          ###  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1F, 0xF8, //    ########## 
-	0x07, 0xB8, //      #### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2760 'e' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x30, 0x00, //   ##          
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2800 'f' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xF0, //       ######  
-	0x07, 0xF0, //      #######  
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2840 'g' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x70, //          ###  
-	0x0F, 0xE0, //     #######   
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2880 'h' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xC0, //    ## ####    
-	0x1F, 0xE0, //    ########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2920 'i' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2960 'j' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0xC0, //        ###    
-	0x3F, 0x80, //   #######     
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3000 'k' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0x00, //    ## ##      
-	0x1E, 0x00, //    ####       
-	0x1E, 0x00, //    ####       
-	0x1B, 0x00, //    ## ##      
-	0x19, 0x80, //    ##  ##     
-	0x39, 0xF0, //   ###  #####  
-	0x39, 0xF0, //   ###  #####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3040 'l' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3080 'm' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7E, 0xE0, //  ###### ###   
-	0x7F, 0xF0, //  ###########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x7B, 0xB8, //  #### ### ### 
-	0x7B, 0xB8, //  #### ### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3120 'n' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3B, 0xC0, //   ### ####    
-	0x3F, 0xE0, //   #########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3160 'o' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3200 'p' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x77, 0x80, //  ### ####     
-	0x7F, 0xE0, //  ##########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x3F, 0xE0, //   #########   
-	0x37, 0x80, //   ## ####     
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x7C, 0x00, //  #####        
-	0x7C, 0x00, //  #####        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3240 'q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x00, 0xF8, //         ##### 
-	0x00, 0xF8, //         ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3280 'r' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xE0, //   ####  ###   
-	0x3D, 0xF0, //   #### #####  
-	0x0F, 0x30, //     ####  ##  
-	0x0E, 0x00, //     ###       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xC0, //   ########    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3320 's' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xE0, //      ######   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x1E, 0x00, //    ####       
-	0x0F, 0xC0, //     ######    
-	0x01, 0xE0, //        ####   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3360 't' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0F, 0xF0, //     ########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3400 'u' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x38, 0xE0, //   ###   ###   
-	0x38, 0xE0, //   ###   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xF0, //    #########  
-	0x0F, 0x70, //     #### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3440 'v' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3480 'w' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x32, 0x60, //   ##  #  ##   
-	0x32, 0x60, //   ##  #  ##   
-	0x37, 0xE0, //   ## ######   
-	0x1D, 0xC0, //    ### ###    
-	0x1D, 0xC0, //    ### ###    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3520 'x' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x07, 0x80, //      ####     
-	0x0C, 0xC0, //     ##  ##    
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3560 'y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0F, 0x80, //     #####     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x7F, 0x00, //  #######      
-	0x7F, 0x00, //  #######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3600 'z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+static const uint8_t s_bitmap[] = {
+    0xFF, 0xFF, 0xFA, 0x40, 0x7E,  /* '!' */
+    0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,  /* '"' */
+    0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,  /* '#' */
+    0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18,  /* '$' */
+    0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42, 0x21, 0x10, 0x70,  /* '%' */
+    0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF, 0x60,  /* '&' */
+    0xFF, 0xA4, 0x80,  /* '\'' */
+    0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,  /* '(' */
+    0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,  /* ')' */
+    0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,  /* '*' */
+    0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00,  /* '+' */
+    0x76, 0x6C, 0xC8,  /* ',' */
+    0xFF, 0xFF, 0xC0,  /* '-' */
+    0xFF, 0x80,  /* '.' */
+    0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0,  /* '/' */
+    0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0,  /* '0' */
+    0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,  /* '1' */
+    0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0xF8,  /* '2' */
+    0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0, 0x3C, 0x1F, 0xFE, 0x7F, 0x00,  /* '3' */
+    0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0, 0xC1, 0xF0, 0xF8,  /* '4' */
+    0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0, 0xFF, 0xE7, 0xE0,  /* '5' */
+    0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE1, 0xE0,  /* '6' */
+    0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0,  /* '7' */
+    0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0,  /* '8' */
+    0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83, 0xDF, 0xCF, 0x80,  /* '9' */
+    0xFF, 0x80, 0x3F, 0xE0,  /* ':' */
+    0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,  /* ';' */
+    0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0x80,  /* '<' */
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,  /* '=' */
+    0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C, 0x1E, 0x03, 0x00, 0x00,  /* '>' */
+    0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,  /* '?' */
+    0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27, 0x80,  /* '@' */
+    0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,  /* 'A' */
+    0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8, 0x3F, 0xFF, 0xFE,  /* 'B' */
+    0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC, 0x73, 0xF8, 0x7C,  /* 'C' */
+    0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x3B, 0xFE, 0x7F, 0x80,  /* 'D' */
+    0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8, 0x3F, 0xFF, 0xFF,  /* 'E' */
+    0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18, 0x0F, 0xC3, 0xF0,  /* 'F' */
+    0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0, 0xCC, 0x19, 0xFF, 0x0F, 0x80,  /* 'G' */
+    0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF,  /* 'H' */
+    0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,  /* 'I' */
+    0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x73, 0xFC, 0x1F, 0x00,  /* 'J' */
+    0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63, 0x0C, 0x33, 0xE7, 0xFC, 0x70,  /* 'K' */
+    0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC, 0x3F, 0xFF, 0xFF,  /* 'L' */
+    0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,  /* 'M' */
+    0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98, 0xEF, 0xBB, 0xE6,  /* 'N' */
+    0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78,  /* 'O' */
+    0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18, 0x0F, 0xC3, 0xF0,  /* 'P' */
+    0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,  /* 'Q' */
+    0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x30,  /* 'R' */
+    0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C,  /* 'S' */
+    0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC,  /* 'T' */
+    0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C, 0xE3, 0xF0, 0x78,  /* 'U' */
+    0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x07, 0x00,  /* 'V' */
+    0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5, 0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,  /* 'W' */
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31, 0x8C, 0x1B, 0xC7, 0xF8, 0xF0,  /* 'X' */
+    0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC,  /* 'Y' */
+    0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF,  /* 'Z' */
+    0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,  /* '[' */
+    0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03,  /* '\\' */
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,  /* ']' */
+    0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,  /* '^' */
+    0xFF, 0xFF, 0xFF, 0xF0,  /* '_' */
+    0x86, 0x10,  /* '`' */
+    0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,  /* 'a' */
+    0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,  /* 'b' */
+    0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,  /* 'c' */
+    0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,  /* 'd' */
+    0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00,  /* 'e' */
+    0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x1F, 0xEF, 0xF0,  /* 'f' */
+    0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,  /* 'g' */
+    0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,  /* 'h' */
+    0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,  /* 'i' */
+    0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC,  /* 'j' */
+    0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xC0,  /* 'k' */
+    0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,  /* 'l' */
+    0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77, 0xF7, 0x70,  /* 'm' */
+    0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,  /* 'n' */
+    0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,  /* 'o' */
+    0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F, 0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,  /* 'p' */
+    0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,  /* 'q' */
+    0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,  /* 'r' */
+    0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC,  /* 's' */
+    0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0xFC, 0x7C,  /* 't' */
+    0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,  /* 'u' */
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E, 0x00,  /* 'v' */
+    0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31, 0x80,  /* 'w' */
+    0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,  /* 'x' */
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C, 0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,  /* 'y' */
+    0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF,  /* 'z' */
+    0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,  /* '{' */
+    0xFF, 0xFF, 0xFF, 0xFF,  /* '|' */
+    0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,  /* '}' */
+    0x38, 0x3F, 0x3C, 0xFC, 0x1E,  /* '~' */
+    0x30, 0xC0, 0x00, 0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,  /* U+00C4 */
+    0x33, 0x00, 0x01, 0xE0, 0xFC, 0x73, 0xB8, 0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xCE, 0x3F, 0x07, 0x80,  /* U+00D6 */
+    0x33, 0x00, 0x0F, 0x3F, 0xCF, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xCE, 0x3F, 0x07, 0x80,  /* U+00DC */
+    0xFC, 0x7F, 0x30, 0xD8, 0x6C, 0x77, 0xF3, 0xFD, 0x87, 0xC1, 0xE0, 0xFF, 0xFF, 0xEC, 0x00,  /* U+00DF */
+    0x33, 0x00, 0x03, 0xF1, 0xFE, 0x01, 0x8F, 0xE7, 0xFB, 0x86, 0xC3, 0xBF, 0xF7, 0xDC,  /* U+00E4 */
+    0x33, 0x00, 0x01, 0xE1, 0xFE, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0,  /* U+00F6 */
+    0x33, 0x00, 0x0E, 0x3B, 0x8E, 0x61, 0x98, 0x66, 0x19, 0x86, 0x63, 0x9F, 0xF3, 0xDC,  /* U+00FC */
+};
 
-	// @3640 '{' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0x00, //      ###      
-	0x0E, 0x00, //     ###       
-	0x07, 0x00, //      ###      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+static const painter_glyph_dsc_t s_glyphs[] = {
+    {    0,  0,  0,  0,  0},  /* ' ' */
+    {    0,  3, 13,  5,  1},  /* '!' */
+    {    5,  8,  6,  3,  2},  /* '"' */
+    {   11, 10, 16,  2,  0},  /* '#' */
+    {   31,  8, 16,  3,  0},  /* '$' */
+    {   47,  9, 13,  2,  1},  /* '%' */
+    {   62,  9, 11,  3,  3},  /* '&' */
+    {   75,  3,  6,  6,  2},  /* '\'' */
+    {   78,  4, 16,  6,  1},  /* '(' */
+    {   86,  4, 16,  4,  1},  /* ')' */
+    {   94,  8,  9,  3,  1},  /* '*' */
+    {  103, 10, 10,  2,  3},  /* '+' */
+    {  116,  4,  6,  5, 11},  /* ',' */
+    {  119,  9,  2,  2,  7},  /* '-' */
+    {  122,  3,  3,  6, 11},  /* '.' */
+    {  124,  8, 16,  3,  0},  /* '/' */
+    {  140,  9, 13,  2,  1},  /* '0' */
+    {  155,  8, 13,  3,  1},  /* '1' */
+    {  168,  9, 13,  2,  1},  /* '2' */
+    {  183, 10, 13,  1,  1},  /* '3' */
+    {  200,  9, 13,  2,  1},  /* '4' */
+    {  215,  9, 13,  2,  1},  /* '5' */
+    {  230,  9, 13,  2,  1},  /* '6' */
+    {  245,  9, 13,  2,  1},  /* '7' */
+    {  260,  9, 13,  2,  1},  /* '8' */
+    {  275,  9, 13,  2,  1},  /* '9' */
+    {  290,  3,  9,  6,  5},  /* ':' */
+    {  294,  5, 11,  5,  5},  /* ';' */
+    {  301, 11, 11,  1,  3},  /* '<' */
+    {  317, 11,  6,  1,  5},  /* '=' */
+    {  326, 11, 11,  2,  3},  /* '>' */
+    {  342,  8, 12,  3,  2},  /* '?' */
+    {  354,  7, 14,  3,  1},  /* '@' */
+    {  367, 12, 12,  1,  2},  /* 'A' */
+    {  385, 10, 12,  2,  2},  /* 'B' */
+    {  400, 10, 12,  2,  2},  /* 'C' */
+    {  415, 11, 12,  1,  2},  /* 'D' */
+    {  432, 10, 12,  2,  2},  /* 'E' */
+    {  447, 10, 12,  2,  2},  /* 'F' */
+    {  462, 11, 12,  2,  2},  /* 'G' */
+    {  479, 10, 12,  2,  2},  /* 'H' */
+    {  494,  8, 12,  3,  2},  /* 'I' */
+    {  506, 11, 12,  2,  2},  /* 'J' */
+    {  523, 11, 12,  2,  2},  /* 'K' */
+    {  540, 10, 12,  2,  2},  /* 'L' */
+    {  555, 12, 12,  1,  2},  /* 'M' */
+    {  573, 10, 12,  2,  2},  /* 'N' */
+    {  588, 10, 12,  2,  2},  /* 'O' */
+    {  603, 10, 12,  2,  2},  /* 'P' */
+    {  618, 10, 15,  2,  2},  /* 'Q' */
+    {  637, 11, 12,  2,  2},  /* 'R' */
+    {  654, 10, 12,  2,  2},  /* 'S' */
+    {  669, 10, 12,  2,  2},  /* 'T' */
+    {  684, 10, 12,  2,  2},  /* 'U' */
+    {  699, 11, 12,  1,  2},  /* 'V' */
+    {  716, 13, 12,  1,  2},  /* 'W' */
+    {  736, 11, 12,  1,  2},  /* 'X' */
+    {  753, 10, 12,  2,  2},  /* 'Y' */
+    {  768,  8, 12,  3,  2},  /* 'Z' */
+    {  780,  4, 16,  6,  1},  /* '[' */
+    {  788,  8, 16,  3,  0},  /* '\\' */
+    {  804,  4, 16,  4,  1},  /* ']' */
+    {  812,  9,  6,  2,  1},  /* '^' */
+    {  819, 14,  2,  0, 18},  /* '_' */
+    {  823,  4,  3,  5,  1},  /* '`' */
+    {  825, 10,  9,  2,  5},  /* 'a' */
+    {  837, 11, 13,  1,  1},  /* 'b' */
+    {  855, 10,  9,  2,  5},  /* 'c' */
+    {  867, 11, 13,  2,  1},  /* 'd' */
+    {  885, 10,  9,  2,  5},  /* 'e' */
+    {  897,  9, 13,  3,  1},  /* 'f' */
+    {  912, 11, 13,  2,  5},  /* 'g' */
+    {  930, 10, 13,  2,  1},  /* 'h' */
+    {  947,  8, 13,  3,  1},  /* 'i' */
+    {  960,  8, 17,  2,  1},  /* 'j' */
+    {  977, 10, 13,  2,  1},  /* 'k' */
+    {  994,  8, 13,  3,  1},  /* 'l' */
+    { 1007, 12,  9,  1,  5},  /* 'm' */
+    { 1021, 10,  9,  2,  5},  /* 'n' */
+    { 1033, 10,  9,  2,  5},  /* 'o' */
+    { 1045, 11, 13,  1,  5},  /* 'p' */
+    { 1063, 11, 13,  2,  5},  /* 'q' */
+    { 1081, 10,  9,  2,  5},  /* 'r' */
+    { 1093,  8,  9,  3,  5},  /* 's' */
+    { 1102, 10, 12,  2,  2},  /* 't' */
+    { 1117, 10,  9,  2,  5},  /* 'u' */
+    { 1129, 11,  9,  1,  5},  /* 'v' */
+    { 1142, 11,  9,  1,  5},  /* 'w' */
+    { 1155, 10,  9,  2,  5},  /* 'x' */
+    { 1167, 11, 13,  1,  5},  /* 'y' */
+    { 1185,  8,  9,  3,  5},  /* 'z' */
+    { 1194,  6, 16,  4,  1},  /* '{' */
+    { 1206,  2, 16,  6,  1},  /* '|' */
+    { 1210,  6, 16,  3,  1},  /* '}' */
+    { 1222, 10,  4,  2,  6},  /* '~' */
+    { 1227, 12, 14,  1,  0},  /* U+00C4 */
+    { 1248, 10, 14,  2,  0},  /* U+00D6 */
+    { 1266, 10, 14,  2,  0},  /* U+00DC */
+    { 1284,  9, 13,  3,  2},  /* U+00DF */
+    { 1299, 10, 11,  2,  3},  /* U+00E4 */
+    { 1313, 10, 11,  2,  3},  /* U+00F6 */
+    { 1327, 10, 11,  2,  3},  /* U+00FC */
+};
 
-	// @3680 '|' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+static const painter_font_range_t s_ranges[] = {
+    {0x0020, 95, 0},
+    {0x00C4, 1, 95},
+    {0x00D6, 1, 96},
+    {0x00DC, 1, 97},
+    {0x00DF, 1, 98},
+    {0x00E4, 1, 99},
+    {0x00F6, 1, 100},
+    {0x00FC, 1, 101},
+};
 
-	// @3720 '}' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x1E, 0x00, //    ####       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x07, 0x00, //      ###      
-	0x03, 0x80, //       ###     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1E, 0x00, //    ####       
-	0x1C, 0x00, //    ###        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+static const uint8_t s_advance[] = {
+    7, 4, 9, 11, 9, 10, 10, 4, 5, 5, 9, 11, 5, 10, 4, 9,
+    10, 9, 10, 11, 10, 10, 10, 10, 10, 10, 4, 6, 12, 12, 12, 9,
+    8, 13, 11, 11, 12, 11, 11, 12, 11, 9, 12, 12, 11, 13, 11, 11,
+    11, 11, 12, 11, 11, 11, 12, 14, 12, 11, 9, 5, 9, 5, 10, 15,
+    5, 11, 12, 11, 12, 11, 10, 12, 11, 9, 9, 11, 9, 13, 11, 11,
+    12, 12, 11, 9, 11, 11, 12, 12, 11, 12, 9, 7, 3, 7, 11, 13,
+    11, 11, 10, 11, 11, 11,
+};
 
-	// @3760 '~' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0E, 0x00, //     ###       
-	0x3F, 0x30, //   ######  ##  
-	0x33, 0xF0, //   ##  ######  
-	0x01, 0xE0, //        ####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+static const painter_font_kern_t s_kerning[] = {
+    {12, 52, -2},  /* ',' 'T' */
+    {12, 54, -3},  /* ',' 'V' */
+    {12, 55, -2},  /* ',' 'W' */
+    {12, 57, -2},  /* ',' 'Y' */
+    {14, 52, -2},  /* '.' 'T' */
+    {14, 54, -3},  /* '.' 'V' */
+    {14, 55, -2},  /* '.' 'W' */
+    {14, 57, -2},  /* '.' 'Y' */
+    {33, 35, -1},  /* 'A' 'C' */
+    {33, 39, -1},  /* 'A' 'G' */
+    {33, 47, -1},  /* 'A' 'O' */
+    {33, 49, -1},  /* 'A' 'Q' */
+    {33, 52, -2},  /* 'A' 'T' */
+    {33, 53, -1},  /* 'A' 'U' */
+    {33, 54, -3},  /* 'A' 'V' */
+    {33, 55, -2},  /* 'A' 'W' */
+    {33, 57, -2},  /* 'A' 'Y' */
+    {33, 69, -1},  /* 'A' 'e' */
+    {33, 71, -1},  /* 'A' 'g' */
+    {33, 74, -3},  /* 'A' 'j' */
+    {33, 79, -1},  /* 'A' 'o' */
+    {33, 80, -1},  /* 'A' 'p' */
+    {33, 81, -1},  /* 'A' 'q' */
+    {33, 84, -2},  /* 'A' 't' */
+    {33, 85, -1},  /* 'A' 'u' */
+    {33, 86, -3},  /* 'A' 'v' */
+    {33, 87, -2},  /* 'A' 'w' */
+    {33, 89, -3},  /* 'A' 'y' */
+    {33, 96, -1},  /* 'A' U+00D6 */
+    {33, 97, -1},  /* 'A' U+00DC */
+    {33, 100, -1},  /* 'A' U+00F6 */
+    {33, 101, -1},  /* 'A' U+00FC */
+    {34, 52, -1},  /* 'B' 'T' */
+    {34, 54, -1},  /* 'B' 'V' */
+    {34, 55, -1},  /* 'B' 'W' */
+    {34, 57, -1},  /* 'B' 'Y' */
+    {36, 33, -1},  /* 'D' 'A' */
+    {36, 54, -1},  /* 'D' 'V' */
+    {36, 55, -1},  /* 'D' 'W' */
+    {36, 57, -1},  /* 'D' 'Y' */
+    {36, 95, -1},  /* 'D' U+00C4 */
+    {38, 12, -3},  /* 'F' ',' */
+    {38, 14, -3},  /* 'F' '.' */
+    {38, 33, -2},  /* 'F' 'A' */
+    {38, 42, -3},  /* 'F' 'J' */
+    {38, 65, -1},  /* 'F' 'a' */
+    {38, 67, -1},  /* 'F' 'c' */
+    {38, 68, -1},  /* 'F' 'd' */
+    {38, 69, -1},  /* 'F' 'e' */
+    {38, 71, -1},  /* 'F' 'g' */
+    {38, 74, -1},  /* 'F' 'j' */
+    {38, 79, -1},  /* 'F' 'o' */
+    {38, 81, -1},  /* 'F' 'q' */
+    {38, 95, -2},  /* 'F' U+00C4 */
+    {38, 99, -1},  /* 'F' U+00E4 */
+    {38, 100, -1},  /* 'F' U+00F6 */
+    {39, 33, -1},  /* 'G' 'A' */
+    {39, 52, -1},  /* 'G' 'T' */
+    {39, 54, -1},  /* 'G' 'V' */
+    {39, 55, -1},  /* 'G' 'W' */
+    {39, 57, -1},  /* 'G' 'Y' */
+    {39, 95, -1},  /* 'G' U+00C4 */
+    {42, 33, -2},  /* 'J' 'A' */
+    {42, 95, -2},  /* 'J' U+00C4 */
+    {44, 52, -2},  /* 'L' 'T' */
+    {44, 53, -1},  /* 'L' 'U' */
+    {44, 54, -3},  /* 'L' 'V' */
+    {44, 55, -1},  /* 'L' 'W' */
+    {44, 57, -2},  /* 'L' 'Y' */
+    {44, 74, -3},  /* 'L' 'j' */
+    {44, 80, -1},  /* 'L' 'p' */
+    {44, 84, -2},  /* 'L' 't' */
+    {44, 85, -1},  /* 'L' 'u' */
+    {44, 86, -2},  /* 'L' 'v' */
+    {44, 87, -1},  /* 'L' 'w' */
+    {44, 89, -2},  /* 'L' 'y' */
+    {44, 97, -1},  /* 'L' U+00DC */
+    {44, 101, -1},  /* 'L' U+00FC */
+    {46, 33, -1},  /* 'N' 'A' */
+    {46, 95, -1},  /* 'N' U+00C4 */
+    {47, 33, -1},  /* 'O' 'A' */
+    {47, 54, -1},  /* 'O' 'V' */
+    {47, 55, -1},  /* 'O' 'W' */
+    {47, 57, -1},  /* 'O' 'Y' */
+    {47, 95, -1},  /* 'O' U+00C4 */
+    {48, 12, -3},  /* 'P' ',' */
+    {48, 14, -3},  /* 'P' '.' */
+    {48, 33, -2},  /* 'P' 'A' */
+    {48, 65, -1},  /* 'P' 'a' */
+    {48, 66, -1},  /* 'P' 'b' */
+    {48, 72, -1},  /* 'P' 'h' */
+    {48, 74, -1},  /* 'P' 'j' */
+    {48, 75, -1},  /* 'P' 'k' */
+    {48, 76, -1},  /* 'P' 'l' */
+    {48, 95, -2},  /* 'P' U+00C4 */
+    {48, 99, -1},  /* 'P' U+00E4 */
+    {49, 54, -1},  /* 'Q' 'V' */
+    {49, 55, -1},  /* 'Q' 'W' */
+    {49, 57, -1},  /* 'Q' 'Y' */
+    {50, 52, -1},  /* 'R' 'T' */
+    {50, 54, -1},  /* 'R' 'V' */
+    {50, 55, -1},  /* 'R' 'W' */
+    {50, 57, -1},  /* 'R' 'Y' */
+    {52, 12, -2},  /* 'T' ',' */
+    {52, 14, -2},  /* 'T' '.' */
+    {52, 33, -2},  /* 'T' 'A' */
+    {52, 42, -2},  /* 'T' 'J' */
+    {52, 65, -1},  /* 'T' 'a' */
+    {52, 67, -1},  /* 'T' 'c' */
+    {52, 68, -1},  /* 'T' 'd' */
+    {52, 69, -1},  /* 'T' 'e' */
+    {52, 71, -1},  /* 'T' 'g' */
+    {52, 74, -1},  /* 'T' 'j' */
+    {52, 79, -1},  /* 'T' 'o' */
+    {52, 81, -1},  /* 'T' 'q' */
+    {52, 95, -2},  /* 'T' U+00C4 */
+    {52, 99, -1},  /* 'T' U+00E4 */
+    {52, 100, -1},  /* 'T' U+00F6 */
+    {53, 33, -1},  /* 'U' 'A' */
+    {53, 95, -1},  /* 'U' U+00C4 */
+    {54, 12, -3},  /* 'V' ',' */
+    {54, 14, -3},  /* 'V' '.' */
+    {54, 33, -2},  /* 'V' 'A' */
+    {54, 35, -1},  /* 'V' 'C' */
+    {54, 39, -1},  /* 'V' 'G' */
+    {54, 42, -2},  /* 'V' 'J' */
+    {54, 47, -1},  /* 'V' 'O' */
+    {54, 49, -1},  /* 'V' 'Q' */
+    {54, 65, -2},  /* 'V' 'a' */
+    {54, 67, -2},  /* 'V' 'c' */
+    {54, 68, -2},  /* 'V' 'd' */
+    {54, 69, -2},  /* 'V' 'e' */
+    {54, 70, -1},  /* 'V' 'f' */
+    {54, 71, -2},  /* 'V' 'g' */
+    {54, 73, -1},  /* 'V' 'i' */
+    {54, 74, -2},  /* 'V' 'j' */
+    {54, 77, -1},  /* 'V' 'm' */
+    {54, 78, -1},  /* 'V' 'n' */
+    {54, 79, -2},  /* 'V' 'o' */
+    {54, 80, -1},  /* 'V' 'p' */
+    {54, 81, -2},  /* 'V' 'q' */
+    {54, 82, -1},  /* 'V' 'r' */
+    {54, 83, -1},  /* 'V' 's' */
+    {54, 84, -1},  /* 'V' 't' */
+    {54, 85, -1},  /* 'V' 'u' */
+    {54, 86, -1},  /* 'V' 'v' */
+    {54, 87, -1},  /* 'V' 'w' */
+    {54, 88, -1},  /* 'V' 'x' */
+    {54, 89, -1},  /* 'V' 'y' */
+    {54, 90, -1},  /* 'V' 'z' */
+    {54, 95, -2},  /* 'V' U+00C4 */
+    {54, 96, -1},  /* 'V' U+00D6 */
+    {54, 99, -2},  /* 'V' U+00E4 */
+    {54, 100, -2},  /* 'V' U+00F6 */
+    {54, 101, -1},  /* 'V' U+00FC */
+    {55, 12, -2},  /* 'W' ',' */
+    {55, 14, -2},  /* 'W' '.' */
+    {55, 33, -2},  /* 'W' 'A' */
+    {55, 35, -1},  /* 'W' 'C' */
+    {55, 39, -1},  /* 'W' 'G' */
+    {55, 42, -1},  /* 'W' 'J' */
+    {55, 47, -1},  /* 'W' 'O' */
+    {55, 49, -1},  /* 'W' 'Q' */
+    {55, 65, -2},  /* 'W' 'a' */
+    {55, 67, -1},  /* 'W' 'c' */
+    {55, 68, -1},  /* 'W' 'd' */
+    {55, 69, -1},  /* 'W' 'e' */
+    {55, 70, -1},  /* 'W' 'f' */
+    {55, 71, -1},  /* 'W' 'g' */
+    {55, 73, -1},  /* 'W' 'i' */
+    {55, 74, -2},  /* 'W' 'j' */
+    {55, 77, -1},  /* 'W' 'm' */
+    {55, 78, -1},  /* 'W' 'n' */
+    {55, 79, -1},  /* 'W' 'o' */
+    {55, 80, -1},  /* 'W' 'p' */
+    {55, 81, -1},  /* 'W' 'q' */
+    {55, 82, -1},  /* 'W' 'r' */
+    {55, 83, -1},  /* 'W' 's' */
+    {55, 84, -1},  /* 'W' 't' */
+    {55, 85, -1},  /* 'W' 'u' */
+    {55, 86, -1},  /* 'W' 'v' */
+    {55, 87, -1},  /* 'W' 'w' */
+    {55, 88, -1},  /* 'W' 'x' */
+    {55, 89, -1},  /* 'W' 'y' */
+    {55, 90, -1},  /* 'W' 'z' */
+    {55, 95, -2},  /* 'W' U+00C4 */
+    {55, 96, -1},  /* 'W' U+00D6 */
+    {55, 99, -2},  /* 'W' U+00E4 */
+    {55, 100, -1},  /* 'W' U+00F6 */
+    {55, 101, -1},  /* 'W' U+00FC */
+    {57, 12, -2},  /* 'Y' ',' */
+    {57, 14, -2},  /* 'Y' '.' */
+    {57, 33, -2},  /* 'Y' 'A' */
+    {57, 35, -1},  /* 'Y' 'C' */
+    {57, 39, -1},  /* 'Y' 'G' */
+    {57, 42, -2},  /* 'Y' 'J' */
+    {57, 47, -1},  /* 'Y' 'O' */
+    {57, 49, -1},  /* 'Y' 'Q' */
+    {57, 65, -2},  /* 'Y' 'a' */
+    {57, 67, -2},  /* 'Y' 'c' */
+    {57, 68, -2},  /* 'Y' 'd' */
+    {57, 69, -3},  /* 'Y' 'e' */
+    {57, 70, -1},  /* 'Y' 'f' */
+    {57, 71, -3},  /* 'Y' 'g' */
+    {57, 73, -1},  /* 'Y' 'i' */
+    {57, 74, -2},  /* 'Y' 'j' */
+    {57, 77, -1},  /* 'Y' 'm' */
+    {57, 78, -1},  /* 'Y' 'n' */
+    {57, 79, -3},  /* 'Y' 'o' */
+    {57, 80, -1},  /* 'Y' 'p' */
+    {57, 81, -3},  /* 'Y' 'q' */
+    {57, 82, -1},  /* 'Y' 'r' */
+    {57, 83, -2},  /* 'Y' 's' */
+    {57, 84, -1},  /* 'Y' 't' */
+    {57, 85, -1},  /* 'Y' 'u' */
+    {57, 86, -1},  /* 'Y' 'v' */
+    {57, 87, -1},  /* 'Y' 'w' */
+    {57, 88, -1},  /* 'Y' 'x' */
+    {57, 89, -1},  /* 'Y' 'y' */
+    {57, 90, -1},  /* 'Y' 'z' */
+    {57, 95, -2},  /* 'Y' U+00C4 */
+    {57, 96, -1},  /* 'Y' U+00D6 */
+    {57, 99, -2},  /* 'Y' U+00E4 */
+    {57, 100, -2},  /* 'Y' U+00F6 */
+    {57, 101, -1},  /* 'Y' U+00FC */
+    {65, 52, -1},  /* 'a' 'T' */
+    {65, 54, -2},  /* 'a' 'V' */
+    {65, 55, -2},  /* 'a' 'W' */
+    {65, 57, -2},  /* 'a' 'Y' */
+    {66, 33, -1},  /* 'b' 'A' */
+    {66, 52, -1},  /* 'b' 'T' */
+    {66, 54, -2},  /* 'b' 'V' */
+    {66, 55, -1},  /* 'b' 'W' */
+    {66, 57, -3},  /* 'b' 'Y' */
+    {66, 95, -1},  /* 'b' U+00C4 */
+    {67, 54, -1},  /* 'c' 'V' */
+    {67, 55, -1},  /* 'c' 'W' */
+    {67, 57, -1},  /* 'c' 'Y' */
+    {68, 52, -1},  /* 'd' 'T' */
+    {68, 54, -1},  /* 'd' 'V' */
+    {68, 55, -1},  /* 'd' 'W' */
+    {68, 57, -1},  /* 'd' 'Y' */
+    {69, 52, -1},  /* 'e' 'T' */
+    {69, 54, -2},  /* 'e' 'V' */
+    {69, 55, -1},  /* 'e' 'W' */
+    {69, 57, -2},  /* 'e' 'Y' */
+    {70, 33, -1},  /* 'f' 'A' */
+    {70, 95, -1},  /* 'f' U+00C4 */
+    {71, 33, -1},  /* 'g' 'A' */
+    {71, 54, -1},  /* 'g' 'V' */
+    {71, 55, -1},  /* 'g' 'W' */
+    {71, 57, -1},  /* 'g' 'Y' */
+    {71, 95, -1},  /* 'g' U+00C4 */
+    {72, 52, -1},  /* 'h' 'T' */
+    {72, 54, -2},  /* 'h' 'V' */
+    {72, 55, -2},  /* 'h' 'W' */
+    {72, 57, -2},  /* 'h' 'Y' */
+    {73, 52, -2},  /* 'i' 'T' */
+    {73, 54, -3},  /* 'i' 'V' */
+    {73, 55, -2},  /* 'i' 'W' */
+    {73, 57, -2},  /* 'i' 'Y' */
+    {74, 54, -1},  /* 'j' 'V' */
+    {74, 55, -1},  /* 'j' 'W' */
+    {74, 57, -1},  /* 'j' 'Y' */
+    {75, 52, -1},  /* 'k' 'T' */
+    {75, 54, -2},  /* 'k' 'V' */
+    {75, 55, -2},  /* 'k' 'W' */
+    {75, 57, -2},  /* 'k' 'Y' */
+    {76, 52, -2},  /* 'l' 'T' */
+    {76, 54, -3},  /* 'l' 'V' */
+    {76, 55, -2},  /* 'l' 'W' */
+    {76, 57, -2},  /* 'l' 'Y' */
+    {77, 52, -1},  /* 'm' 'T' */
+    {77, 54, -2},  /* 'm' 'V' */
+    {77, 55, -2},  /* 'm' 'W' */
+    {77, 57, -2},  /* 'm' 'Y' */
+    {78, 52, -1},  /* 'n' 'T' */
+    {78, 54, -2},  /* 'n' 'V' */
+    {78, 55, -2},  /* 'n' 'W' */
+    {78, 57, -2},  /* 'n' 'Y' */
+    {79, 33, -1},  /* 'o' 'A' */
+    {79, 52, -1},  /* 'o' 'T' */
+    {79, 54, -2},  /* 'o' 'V' */
+    {79, 55, -1},  /* 'o' 'W' */
+    {79, 57, -3},  /* 'o' 'Y' */
+    {79, 95, -1},  /* 'o' U+00C4 */
+    {80, 33, -1},  /* 'p' 'A' */
+    {80, 52, -1},  /* 'p' 'T' */
+    {80, 54, -2},  /* 'p' 'V' */
+    {80, 55, -1},  /* 'p' 'W' */
+    {80, 57, -3},  /* 'p' 'Y' */
+    {80, 95, -1},  /* 'p' U+00C4 */
+    {81, 33, -1},  /* 'q' 'A' */
+    {81, 54, -1},  /* 'q' 'V' */
+    {81, 55, -1},  /* 'q' 'W' */
+    {81, 57, -1},  /* 'q' 'Y' */
+    {81, 95, -1},  /* 'q' U+00C4 */
+    {82, 33, -2},  /* 'r' 'A' */
+    {82, 54, -1},  /* 'r' 'V' */
+    {82, 55, -1},  /* 'r' 'W' */
+    {82, 57, -2},  /* 'r' 'Y' */
+    {82, 95, -2},  /* 'r' U+00C4 */
+    {83, 54, -1},  /* 's' 'V' */
+    {83, 55, -1},  /* 's' 'W' */
+    {83, 57, -1},  /* 's' 'Y' */
+    {84, 52, -1},  /* 't' 'T' */
+    {84, 54, -2},  /* 't' 'V' */
+    {84, 55, -2},  /* 't' 'W' */
+    {84, 57, -2},  /* 't' 'Y' */
+    {85, 52, -1},  /* 'u' 'T' */
+    {85, 54, -2},  /* 'u' 'V' */
+    {85, 55, -2},  /* 'u' 'W' */
+    {85, 57, -2},  /* 'u' 'Y' */
+    {86, 33, -3},  /* 'v' 'A' */
+    {86, 54, -1},  /* 'v' 'V' */
+    {86, 55, -1},  /* 'v' 'W' */
+    {86, 57, -1},  /* 'v' 'Y' */
+    {86, 95, -3},  /* 'v' U+00C4 */
+    {87, 33, -2},  /* 'w' 'A' */
+    {87, 54, -1},  /* 'w' 'V' */
+    {87, 55, -1},  /* 'w' 'W' */
+    {87, 57, -1},  /* 'w' 'Y' */
+    {87, 95, -2},  /* 'w' U+00C4 */
+    {88, 54, -1},  /* 'x' 'V' */
+    {88, 55, -1},  /* 'x' 'W' */
+    {88, 57, -1},  /* 'x' 'Y' */
+    {89, 33, -3},  /* 'y' 'A' */
+    {89, 54, -1},  /* 'y' 'V' */
+    {89, 55, -1},  /* 'y' 'W' */
+    {89, 57, -1},  /* 'y' 'Y' */
+    {89, 95, -3},  /* 'y' U+00C4 */
+    {90, 54, -1},  /* 'z' 'V' */
+    {90, 55, -1},  /* 'z' 'W' */
+    {90, 57, -1},  /* 'z' 'Y' */
+    {95, 35, -1},  /* U+00C4 'C' */
+    {95, 39, -1},  /* U+00C4 'G' */
+    {95, 47, -1},  /* U+00C4 'O' */
+    {95, 49, -1},  /* U+00C4 'Q' */
+    {95, 52, -2},  /* U+00C4 'T' */
+    {95, 53, -1},  /* U+00C4 'U' */
+    {95, 54, -3},  /* U+00C4 'V' */
+    {95, 55, -2},  /* U+00C4 'W' */
+    {95, 57, -2},  /* U+00C4 'Y' */
+    {95, 69, -1},  /* U+00C4 'e' */
+    {95, 71, -1},  /* U+00C4 'g' */
+    {95, 74, -3},  /* U+00C4 'j' */
+    {95, 79, -1},  /* U+00C4 'o' */
+    {95, 80, -1},  /* U+00C4 'p' */
+    {95, 81, -1},  /* U+00C4 'q' */
+    {95, 84, -2},  /* U+00C4 't' */
+    {95, 85, -1},  /* U+00C4 'u' */
+    {95, 86, -3},  /* U+00C4 'v' */
+    {95, 87, -2},  /* U+00C4 'w' */
+    {95, 89, -3},  /* U+00C4 'y' */
+    {95, 96, -1},  /* U+00C4 U+00D6 */
+    {95, 97, -1},  /* U+00C4 U+00DC */
+    {95, 100, -1},  /* U+00C4 U+00F6 */
+    {95, 101, -1},  /* U+00C4 U+00FC */
+    {96, 33, -1},  /* U+00D6 'A' */
+    {96, 54, -1},  /* U+00D6 'V' */
+    {96, 55, -1},  /* U+00D6 'W' */
+    {96, 57, -1},  /* U+00D6 'Y' */
+    {96, 95, -1},  /* U+00D6 U+00C4 */
+    {97, 33, -1},  /* U+00DC 'A' */
+    {97, 95, -1},  /* U+00DC U+00C4 */
+    {98, 52, -1},  /* U+00DF 'T' */
+    {98, 54, -1},  /* U+00DF 'V' */
+    {98, 55, -1},  /* U+00DF 'W' */
+    {98, 57, -1},  /* U+00DF 'Y' */
+    {99, 52, -1},  /* U+00E4 'T' */
+    {99, 54, -2},  /* U+00E4 'V' */
+    {99, 55, -2},  /* U+00E4 'W' */
+    {99, 57, -2},  /* U+00E4 'Y' */
+    {100, 33, -1},  /* U+00F6 'A' */
+    {100, 52, -1},  /* U+00F6 'T' */
+    {100, 54, -2},  /* U+00F6 'V' */
+    {100, 55, -1},  /* U+00F6 'W' */
+    {100, 57, -2},  /* U+00F6 'Y' */
+    {100, 95, -1},  /* U+00F6 U+00C4 */
+    {101, 52, -1},  /* U+00FC 'T' */
+    {101, 54, -2},  /* U+00FC 'V' */
+    {101, 55, -2},  /* U+00FC 'W' */
+    {101, 57, -2},  /* U+00FC 'Y' */
 };
 
+static const painter_font_data_t s_data = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = NULL,
+    .bearing = 0,
+    .kerning = NULL,
+    .kerning_num = 0,
+};
 
 const font_t Font20 = {
-  Font20_Table,
-  14, /* Width */
-  20, /* Height */
+    NULL,
+    14, /* Width */
+    20, /* Height */
+    &s_data,
 };
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+static const painter_font_data_t s_datap = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = s_advance,
+    .bearing = 0,
+    .kerning = s_kerning,
+    .kerning_num = 383,
+};
+
+const font_t Font20P = {
+    NULL,
+    15, /* Width */
+    20, /* Height */
+    &s_datap,
+};
@@ -1,1004 +1,466 @@
-/**
-  ******************************************************************************
-  * @file    Font8.cpp
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text Font8. 
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
+/* Generated by bdf2font.py from font8.bdf, do not edit
+ *
+ * Courier New bitmap font of the display painter, 5x8 pixels, converted
+ * from font8.c of the STMicroelectronics MCD Application Team. The German
+ * letters were added for the painter.
+ *
+ * COPYRIGHT(c) 2014 STMicroelectronics
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of STMicroelectronics nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
 #include "painter_fonts.h"
 
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font8_Table[] = 
-{
-	// @0 ' ' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @8 '!' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @16 '"' (5 pixels wide)
-	0x50, //  # # 
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @24 '#' (5 pixels wide)
-	0x28, //   # #
-	0x50, //  # # 
-	0xF8, // #####
-	0x50, //  # # 
-	0xF8, // #####
-	0x50, //  # # 
-	0xA0, // # #  
-	0x00, //      
-
-	// @32 '$' (5 pixels wide)
-	0x20, //   #  
-	0x30, //   ## 
-	0x60, //  ##  
-	0x30, //   ## 
-	0x10, //    # 
-	0x60, //  ##  
-	0x20, //   #  
-	0x00, //      
-
-	// @40 '%' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x18, //    ##
-	0x60, //  ##  
-	0x10, //    # 
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-
-	// @48 '&' (5 pixels wide)
-	0x00, //      
-	0x38, //   ###
-	0x20, //   #  
-	0x60, //  ##  
-	0x50, //  # # 
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @56 ''' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @64 '(' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-
-	// @72 ')' (5 pixels wide)
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
-
-	// @80 '*' (5 pixels wide)
-	0x20, //   #  
-	0x70, //  ### 
-	0x20, //   #  
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @88 '+' (5 pixels wide)
-	0x00, //      
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @96 ',' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-
-	// @104 '-' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @112 '.' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @120 '/' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x40, //  #   
-	0x80, // #    
-	0x00, //      
-
-	// @128 '0' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @136 '1' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @144 '2' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @152 '3' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @160 '4' (5 pixels wide)
-	0x10, //    # 
-	0x30, //   ## 
-	0x50, //  # # 
-	0x78, //  ####
-	0x10, //    # 
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @168 '5' (5 pixels wide)
-	0x70, //  ### 
-	0x40, //  #   
-	0x60, //  ##  
-	0x10, //    # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @176 '6' (5 pixels wide)
-	0x30, //   ## 
-	0x40, //  #   
-	0x60, //  ##  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @184 '7' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @192 '8' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x20, //   #  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @200 '9' (5 pixels wide)
-	0x30, //   ## 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x30, //   ## 
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @208 ':' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @216 ';' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x10, //    # 
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @224 '<' (5 pixels wide)
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0xC0, // ##   
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-
-	// @232 '=' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @240 '>' (5 pixels wide)
-	0x00, //      
-	0x40, //  #   
-	0x20, //   #  
-	0x18, //    ##
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
-	0x00, //      
-
-	// @248 '?' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @256 '@' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x58, //  # ##
-	0x48, //  #  #
-	0x40, //  #   
-	0x38, //   ###
-	0x00, //      
-
-	// @264 'A' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x50, //  # # 
-	0x70, //  ### 
-	0x88, // #   #
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @272 'B' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @280 'C' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x40, //  #   
-	0x40, //  #   
-	0x40, //  #   
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @288 'D' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @296 'E' (5 pixels wide)
-	0xF8, // #####
-	0x48, //  #  #
-	0x60, //  ##  
-	0x40, //  #   
-	0x48, //  #  #
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @304 'F' (5 pixels wide)
-	0xF8, // #####
-	0x48, //  #  #
-	0x60, //  ##  
-	0x40, //  #   
-	0x40, //  #   
-	0xE0, // ###  
-	0x00, //      
-	0x00, //      
-
-	// @312 'G' (5 pixels wide)
-	0x70, //  ### 
-	0x40, //  #   
-	0x40, //  #   
-	0x58, //  # ##
-	0x50, //  # # 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @320 'H' (5 pixels wide)
-	0xE8, // ### #
-	0x48, //  #  #
-	0x78, //  ####
-	0x48, //  #  #
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @328 'I' (5 pixels wide)
-	0x70, //  ### 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @336 'J' (5 pixels wide)
-	0x38, //   ###
-	0x10, //    # 
-	0x10, //    # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @344 'K' (5 pixels wide)
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x60, //  ##  
-	0x70, //  ### 
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @352 'L' (5 pixels wide)
-	0xE0, // ###  
-	0x40, //  #   
-	0x40, //  #   
-	0x40, //  #   
-	0x48, //  #  #
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @360 'M' (5 pixels wide)
-	0xD8, // ## ##
-	0xD8, // ## ##
-	0xD8, // ## ##
-	0xA8, // # # #
-	0x88, // #   #
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @368 'N' (5 pixels wide)
-	0xD8, // ## ##
-	0x68, //  ## #
-	0x68, //  ## #
-	0x58, //  # ##
-	0x58, //  # ##
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @376 'O' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @384 'P' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x40, //  #   
-	0xE0, // ###  
-	0x00, //      
-	0x00, //      
-
-	// @392 'Q' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x18, //    ##
-	0x00, //      
-
-	// @400 'R' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @408 'S' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x20, //   #  
-	0x10, //    # 
-	0x50, //  # # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @416 'T' (5 pixels wide)
-	0xF8, // #####
-	0xA8, // # # #
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @424 'U' (5 pixels wide)
-	0xD8, // ## ##
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @432 'V' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0x48, //  #  #
-	0x50, //  # # 
-	0x50, //  # # 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @440 'W' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0xA8, // # # #
-	0xA8, // # # #
-	0xA8, // # # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-
-	// @448 'X' (5 pixels wide)
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @456 'Y' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @464 'Z' (5 pixels wide)
-	0x78, //  ####
-	0x48, //  #  #
-	0x10, //    # 
-	0x20, //   #  
-	0x48, //  #  #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @472 '[' (5 pixels wide)
-	0x30, //   ## 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x30, //   ## 
-	0x00, //      
-
-	// @480 '\' (5 pixels wide)
-	0x80, // #    
-	0x40, //  #   
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-
-	// @488 ']' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-	0x00, //      
-
-	// @496 '^' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @504 '_' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF8, // #####
-
-	// @512 '`' (5 pixels wide)
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @520 'a' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x10, //    # 
-	0x70, //  ### 
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @528 'b' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @536 'c' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x40, //  #   
-	0x40, //  #   
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @544 'd' (5 pixels wide)
-	0x18, //    ##
-	0x08, //     #
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @552 'e' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x70, //  ### 
-	0x40, //  #   
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @560 'f' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x70, //  ### 
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @568 'g' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x08, //     #
-	0x30, //   ## 
-
-	// @576 'h' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @584 'i' (5 pixels wide)
-	0x20, //   #  
-	0x00, //      
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @592 'j' (5 pixels wide)
-	0x20, //   #  
-	0x00, //      
-	0x70, //  ### 
-	0x10, //    # 
-	0x10, //    # 
-	0x10, //    # 
-	0x10, //    # 
-	0x70, //  ### 
-
-	// @600 'k' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x58, //  # ##
-	0x70, //  ### 
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @608 'l' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @616 'm' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD0, // ## # 
-	0xA8, // # # #
-	0xA8, // # # #
-	0xA8, // # # #
-	0x00, //      
-	0x00, //      
-
-	// @624 'n' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xC8, // ##  #
-	0x00, //      
-	0x00, //      
-
-	// @632 'o' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @640 'p' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x40, //  #   
-	0xE0, // ###  
-
-	// @648 'q' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x08, //     #
-	0x18, //    ##
-
-	// @656 'r' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @664 's' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x20, //   #  
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @672 't' (5 pixels wide)
-	0x00, //      
-	0x40, //  #   
-	0xF0, // #### 
-	0x40, //  #   
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @680 'u' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @688 'v' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xC8, // ##  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @696 'w' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0xA8, // # # #
-	0xA8, // # # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-
-	// @704 'x' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x48, //  #  #
-	0x30, //   ## 
-	0x30, //   ## 
-	0x48, //  #  #
-	0x00, //      
-	0x00, //      
-
-	// @712 'y' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
+static const uint8_t s_bitmap[] = {
+    0xF4,  /* '!' */
+    0xB4,  /* '"' */
+    0x2A, 0xBE, 0xAF, 0xAA, 0x80,  /* '#' */
+    0x4F, 0x33, 0x90,  /* '$' */
+    0x44, 0x3C, 0x22,  /* '%' */
+    0x74, 0xCA, 0xF0,  /* '&' */
+    0xE0,  /* '\'' */
+    0x6A, 0xA4,  /* '(' */
+    0x95, 0x58,  /* ')' */
+    0x5D, 0x50,  /* '*' */
+    0x21, 0x3E, 0x42, 0x00,  /* '+' */
+    0x68,  /* ',' */
+    0xE0,  /* '-' */
+    0x80,  /* '.' */
+    0x12, 0x22, 0x44, 0x80,  /* '/' */
+    0x56, 0xDA, 0x80,  /* '0' */
+    0x61, 0x08, 0x42, 0x7C,  /* '1' */
+    0x55, 0x29, 0xC0,  /* '2' */
+    0x54, 0xA3, 0x80,  /* '3' */
+    0x26, 0xAF, 0x27,  /* '4' */
+    0xF3, 0x1A, 0x80,  /* '5' */
+    0x73, 0x5B, 0x80,  /* '6' */
+    0xF4, 0xA4, 0x80,  /* '7' */
+    0x55, 0x5A, 0x80,  /* '8' */
+    0x76, 0xB3, 0x80,  /* '9' */
+    0x90,  /* ':' */
+    0x46,  /* ';' */
+    0x12, 0xC2, 0x10,  /* '<' */
+    0xE3, 0x80,  /* '=' */
+    0x84, 0x34, 0x80,  /* '>' */
+    0x54, 0xA0, 0x80,  /* '?' */
+    0x69, 0x9B, 0x98, 0x70,  /* '@' */
+    0x61, 0x14, 0xE8, 0xEC,  /* 'A' */
+    0xF2, 0x5C, 0x94, 0xF8,  /* 'B' */
+    0xF6, 0x48, 0xC0,  /* 'C' */
+    0xF2, 0x52, 0x94, 0xF8,  /* 'D' */
+    0xFA, 0x58, 0x84, 0xFC,  /* 'E' */
+    0xFA, 0x58, 0x84, 0x70,  /* 'F' */
+    0xE8, 0x8B, 0xA6,  /* 'G' */
+    0xEA, 0x5E, 0x94, 0xF4,  /* 'H' */
+    0xE9, 0x25, 0xC0,  /* 'I' */
+    0x72, 0x2A, 0xA4,  /* 'J' */
+    0xDA, 0x98, 0xE5, 0x6C,  /* 'K' */
+    0xE2, 0x10, 0x84, 0xFC,  /* 'L' */
+    0xDE, 0xF7, 0x58, 0xEC,  /* 'M' */
+    0xDB, 0x5A, 0xB5, 0xF4,  /* 'N' */
+    0x69, 0x99, 0x96,  /* 'O' */
+    0xF2, 0x52, 0xE4, 0x70,  /* 'P' */
+    0x69, 0x99, 0x96, 0x30,  /* 'Q' */
+    0xF2, 0x52, 0xE4, 0xF4,  /* 'R' */
+    0xF5, 0x1B, 0xC0,  /* 'S' */
+    0xFD, 0x48, 0x42, 0x38,  /* 'T' */
+    0xDA, 0x52, 0x94, 0x98,  /* 'U' */
+    0xDC, 0x52, 0xA5, 0x18,  /* 'V' */
+    0xDC, 0x6B, 0x5A, 0xA8,  /* 'W' */
+    0xDA, 0x88, 0x45, 0x6C,  /* 'X' */
+    0xDC, 0x54, 0x42, 0x38,  /* 'Y' */
+    0xF9, 0x24, 0x9F,  /* 'Z' */
+    0xEA, 0xAC,  /* '[' */
+    0x84, 0x42, 0x22, 0x10,  /* '\\' */
+    0xD5, 0x5C,  /* ']' */
+    0x4A, 0x80,  /* '^' */
+    0xF8,  /* '_' */
+    0x90,  /* '`' */
+    0x62, 0xEF,  /* 'a' */
+    0xC2, 0x1C, 0x94, 0xF8,  /* 'b' */
+    0xF2, 0x70,  /* 'c' */
+    0x31, 0x79, 0x97,  /* 'd' */
+    0xFE, 0x30,  /* 'e' */
+    0x2B, 0xA5, 0xC0,  /* 'f' */
+    0x79, 0x97, 0x16,  /* 'g' */
+    0xC2, 0x1C, 0x94, 0xF4,  /* 'h' */
+    0x43, 0x25, 0xC0,  /* 'i' */
+    0x43, 0x92, 0x4F,  /* 'j' */
+    0xC2, 0x16, 0xE5, 0x6C,  /* 'k' */
+    0xC9, 0x25, 0xC0,  /* 'l' */
+    0xD5, 0x6B, 0x50,  /* 'm' */
+    0xF2, 0x53, 0x90,  /* 'n' */
+    0x69, 0x96,  /* 'o' */
+    0xF2, 0x52, 0xE4, 0x70,  /* 'p' */
+    0x79, 0x97, 0x13,  /* 'q' */
+    0xF4, 0x4E,  /* 'r' */
+    0x68, 0xE0,  /* 's' */
+    0x47, 0x90, 0x93, 0x00,  /* 't' */
+    0xDA, 0x52, 0x70,  /* 'u' */
+    0xCA, 0x4C, 0x60,  /* 'v' */
+    0xDD, 0x6A, 0xA0,  /* 'w' */
+    0x96, 0x69,  /* 'x' */
+    0xDA, 0x94, 0x42, 0x30,  /* 'y' */
+    0xFA, 0x5F,  /* 'z' */
+    0x29, 0x64, 0x88,  /* '{' */
+    0xFE,  /* '|' */
+    0x89, 0x34, 0xA0,  /* '}' */
+    0x5A,  /* '~' */
+    0x50, 0x18, 0x45, 0x3A, 0x3B,  /* U+00C4 */
+    0x50, 0x69, 0x99, 0x96,  /* U+00D6 */
+    0x50, 0x36, 0x94, 0xA5, 0x26,  /* U+00DC */
+    0xE9, 0xE9, 0x9E, 0x80,  /* U+00DF */
+    0x50, 0x62, 0xEF,  /* U+00E4 */
+    0x50, 0x69, 0x96,  /* U+00F6 */
+    0x50, 0x36, 0x94, 0x9C,  /* U+00FC */
+};
 
-	// @720 'z' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x50, //  # # 
-	0x28, //   # #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
+static const painter_glyph_dsc_t s_glyphs[] = {
+    {    0,  0,  0,  0,  0},  /* ' ' */
+    {    0,  1,  6,  2,  0},  /* '!' */
+    {    1,  3,  2,  1,  0},  /* '"' */
+    {    2,  5,  7,  0,  0},  /* '#' */
+    {    7,  3,  7,  1,  0},  /* '$' */
+    {   10,  4,  6,  1,  0},  /* '%' */
+    {   13,  4,  5,  1,  1},  /* '&' */
+    {   16,  1,  3,  2,  0},  /* '\'' */
+    {   17,  2,  7,  2,  0},  /* '(' */
+    {   19,  2,  7,  1,  0},  /* ')' */
+    {   21,  3,  4,  1,  0},  /* '*' */
+    {   23,  5,  5,  0,  1},  /* '+' */
+    {   27,  2,  3,  2,  4},  /* ',' */
+    {   28,  3,  1,  1,  3},  /* '-' */
+    {   29,  1,  1,  2,  5},  /* '.' */
+    {   30,  4,  7,  0,  0},  /* '/' */
+    {   34,  3,  6,  1,  0},  /* '0' */
+    {   37,  5,  6,  0,  0},  /* '1' */
+    {   41,  3,  6,  1,  0},  /* '2' */
+    {   44,  3,  6,  1,  0},  /* '3' */
+    {   47,  4,  6,  1,  0},  /* '4' */
+    {   50,  3,  6,  1,  0},  /* '5' */
+    {   53,  3,  6,  1,  0},  /* '6' */
+    {   56,  3,  6,  1,  0},  /* '7' */
+    {   59,  3,  6,  1,  0},  /* '8' */
+    {   62,  3,  6,  1,  0},  /* '9' */
+    {   65,  1,  4,  2,  2},  /* ':' */
+    {   66,  2,  4,  2,  2},  /* ';' */
+    {   67,  4,  5,  0,  1},  /* '<' */
+    {   70,  3,  3,  1,  1},  /* '=' */
+    {   72,  4,  5,  1,  1},  /* '>' */
+    {   75,  3,  6,  1,  0},  /* '?' */
+    {   78,  4,  7,  1,  0},  /* '@' */
+    {   82,  5,  6,  0,  0},  /* 'A' */
+    {   86,  5,  6,  0,  0},  /* 'B' */
+    {   90,  3,  6,  1,  0},  /* 'C' */
+    {   93,  5,  6,  0,  0},  /* 'D' */
+    {   97,  5,  6,  0,  0},  /* 'E' */
+    {  101,  5,  6,  0,  0},  /* 'F' */
+    {  105,  4,  6,  1,  0},  /* 'G' */
+    {  108,  5,  6,  0,  0},  /* 'H' */
+    {  112,  3,  6,  1,  0},  /* 'I' */
+    {  115,  4,  6,  1,  0},  /* 'J' */
+    {  118,  5,  6,  0,  0},  /* 'K' */
+    {  122,  5,  6,  0,  0},  /* 'L' */
+    {  126,  5,  6,  0,  0},  /* 'M' */
+    {  130,  5,  6,  0,  0},  /* 'N' */
+    {  134,  4,  6,  1,  0},  /* 'O' */
+    {  137,  5,  6,  0,  0},  /* 'P' */
+    {  141,  4,  7,  1,  0},  /* 'Q' */
+    {  145,  5,  6,  0,  0},  /* 'R' */
+    {  149,  3,  6,  1,  0},  /* 'S' */
+    {  152,  5,  6,  0,  0},  /* 'T' */
+    {  156,  5,  6,  0,  0},  /* 'U' */
+    {  160,  5,  6,  0,  0},  /* 'V' */
+    {  164,  5,  6,  0,  0},  /* 'W' */
+    {  168,  5,  6,  0,  0},  /* 'X' */
+    {  172,  5,  6,  0,  0},  /* 'Y' */
+    {  176,  4,  6,  1,  0},  /* 'Z' */
+    {  179,  2,  7,  2,  0},  /* '[' */
+    {  181,  4,  7,  0,  0},  /* '\\' */
+    {  185,  2,  7,  1,  0},  /* ']' */
+    {  187,  3,  3,  1,  0},  /* '^' */
+    {  189,  5,  1,  0,  7},  /* '_' */
+    {  190,  2,  2,  2,  0},  /* '`' */
+    {  191,  4,  4,  1,  2},  /* 'a' */
+    {  193,  5,  6,  0,  0},  /* 'b' */
+    {  197,  3,  4,  1,  2},  /* 'c' */
+    {  199,  4,  6,  1,  0},  /* 'd' */
+    {  202,  3,  4,  1,  2},  /* 'e' */
+    {  204,  3,  6,  1,  0},  /* 'f' */
+    {  207,  4,  6,  1,  2},  /* 'g' */
+    {  210,  5,  6,  0,  0},  /* 'h' */
+    {  214,  3,  6,  1,  0},  /* 'i' */
+    {  217,  3,  8,  1,  0},  /* 'j' */
+    {  220,  5,  6,  0,  0},  /* 'k' */
+    {  224,  3,  6,  1,  0},  /* 'l' */
+    {  227,  5,  4,  0,  2},  /* 'm' */
+    {  230,  5,  4,  0,  2},  /* 'n' */
+    {  233,  4,  4,  1,  2},  /* 'o' */
+    {  235,  5,  6,  0,  2},  /* 'p' */
+    {  239,  4,  6,  1,  2},  /* 'q' */
+    {  242,  4,  4,  1,  2},  /* 'r' */
+    {  244,  3,  4,  1,  2},  /* 's' */
+    {  246,  5,  5,  0,  1},  /* 't' */
+    {  250,  5,  4,  0,  2},  /* 'u' */
+    {  253,  5,  4,  0,  2},  /* 'v' */
+    {  256,  5,  4,  0,  2},  /* 'w' */
+    {  259,  4,  4,  1,  2},  /* 'x' */
+    {  261,  5,  6,  0,  2},  /* 'y' */
+    {  265,  4,  4,  1,  2},  /* 'z' */
+    {  267,  3,  7,  1,  0},  /* '{' */
+    {  270,  1,  7,  2,  0},  /* '|' */
+    {  271,  3,  7,  1,  0},  /* '}' */
+    {  274,  4,  2,  1,  3},  /* '~' */
+    {  275,  5,  8,  0,  0},  /* U+00C4 */
+    {  280,  4,  8,  1,  0},  /* U+00D6 */
+    {  284,  5,  8,  0,  0},  /* U+00DC */
+    {  289,  4,  7,  1,  0},  /* U+00DF */
+    {  293,  4,  6,  1,  0},  /* U+00E4 */
+    {  296,  4,  6,  1,  0},  /* U+00F6 */
+    {  299,  5,  6,  0,  0},  /* U+00FC */
+};
 
-	// @728 '{' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
+static const painter_font_range_t s_ranges[] = {
+    {0x0020, 95, 0},
+    {0x00C4, 1, 95},
+    {0x00D6, 1, 96},
+    {0x00DC, 1, 97},
+    {0x00DF, 1, 98},
+    {0x00E4, 1, 99},
+    {0x00F6, 1, 100},
+    {0x00FC, 1, 101},
+};
 
-	// @736 '|' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
+static const uint8_t s_advance[] = {
+    3, 2, 4, 6, 4, 5, 5, 2, 3, 3, 4, 6, 3, 4, 2, 5,
+    4, 6, 4, 4, 5, 4, 4, 4, 4, 4, 2, 3, 5, 4, 5, 4,
+    5, 6, 6, 4, 6, 6, 6, 5, 6, 4, 5, 6, 6, 6, 6, 5,
+    6, 5, 6, 4, 6, 6, 6, 6, 6, 6, 5, 3, 5, 3, 4, 6,
+    3, 5, 6, 4, 5, 4, 4, 5, 6, 4, 4, 6, 4, 6, 6, 5,
+    6, 5, 5, 4, 6, 6, 6, 6, 5, 6, 5, 4, 2, 4, 5, 6,
+    5, 6, 5, 5, 5, 6,
+};
 
-	// @744 '}' (5 pixels wide)
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x30, //   ## 
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
+static const painter_font_kern_t s_kerning[] = {
+    {12, 52, -1},  /* ',' 'T' */
+    {12, 54, -1},  /* ',' 'V' */
+    {12, 57, -1},  /* ',' 'Y' */
+    {12, 95, -1},  /* ',' U+00C4 */
+    {14, 52, -1},  /* '.' 'T' */
+    {14, 54, -1},  /* '.' 'V' */
+    {14, 57, -1},  /* '.' 'Y' */
+    {33, 52, -1},  /* 'A' 'T' */
+    {33, 53, -1},  /* 'A' 'U' */
+    {33, 54, -1},  /* 'A' 'V' */
+    {33, 57, -1},  /* 'A' 'Y' */
+    {33, 74, -1},  /* 'A' 'j' */
+    {33, 80, -1},  /* 'A' 'p' */
+    {33, 84, -1},  /* 'A' 't' */
+    {33, 85, -1},  /* 'A' 'u' */
+    {33, 86, -1},  /* 'A' 'v' */
+    {33, 89, -1},  /* 'A' 'y' */
+    {33, 97, -1},  /* 'A' U+00DC */
+    {33, 101, -1},  /* 'A' U+00FC */
+    {34, 95, -1},  /* 'B' U+00C4 */
+    {36, 95, -1},  /* 'D' U+00C4 */
+    {38, 12, -1},  /* 'F' ',' */
+    {38, 14, -1},  /* 'F' '.' */
+    {38, 33, -1},  /* 'F' 'A' */
+    {38, 42, -1},  /* 'F' 'J' */
+    {38, 65, -1},  /* 'F' 'a' */
+    {38, 68, -1},  /* 'F' 'd' */
+    {38, 71, -1},  /* 'F' 'g' */
+    {38, 79, -1},  /* 'F' 'o' */
+    {38, 81, -1},  /* 'F' 'q' */
+    {38, 83, -1},  /* 'F' 's' */
+    {38, 95, -1},  /* 'F' U+00C4 */
+    {38, 96, -1},  /* 'F' U+00D6 */
+    {38, 99, -1},  /* 'F' U+00E4 */
+    {38, 100, -1},  /* 'F' U+00F6 */
+    {39, 52, -1},  /* 'G' 'T' */
+    {39, 54, -1},  /* 'G' 'V' */
+    {39, 57, -1},  /* 'G' 'Y' */
+    {39, 95, -1},  /* 'G' U+00C4 */
+    {42, 33, -1},  /* 'J' 'A' */
+    {42, 95, -1},  /* 'J' U+00C4 */
+    {44, 52, -1},  /* 'L' 'T' */
+    {44, 53, -1},  /* 'L' 'U' */
+    {44, 54, -1},  /* 'L' 'V' */
+    {44, 57, -1},  /* 'L' 'Y' */
+    {44, 74, -1},  /* 'L' 'j' */
+    {44, 80, -1},  /* 'L' 'p' */
+    {44, 84, -1},  /* 'L' 't' */
+    {44, 85, -1},  /* 'L' 'u' */
+    {44, 86, -1},  /* 'L' 'v' */
+    {44, 89, -1},  /* 'L' 'y' */
+    {44, 97, -1},  /* 'L' U+00DC */
+    {44, 101, -1},  /* 'L' U+00FC */
+    {47, 95, -1},  /* 'O' U+00C4 */
+    {48, 12, -1},  /* 'P' ',' */
+    {48, 14, -1},  /* 'P' '.' */
+    {48, 33, -1},  /* 'P' 'A' */
+    {48, 65, -1},  /* 'P' 'a' */
+    {48, 83, -1},  /* 'P' 's' */
+    {48, 95, -1},  /* 'P' U+00C4 */
+    {48, 99, -1},  /* 'P' U+00E4 */
+    {52, 12, -1},  /* 'T' ',' */
+    {52, 14, -1},  /* 'T' '.' */
+    {52, 33, -1},  /* 'T' 'A' */
+    {52, 42, -1},  /* 'T' 'J' */
+    {52, 65, -1},  /* 'T' 'a' */
+    {52, 68, -1},  /* 'T' 'd' */
+    {52, 71, -1},  /* 'T' 'g' */
+    {52, 79, -1},  /* 'T' 'o' */
+    {52, 81, -1},  /* 'T' 'q' */
+    {52, 83, -1},  /* 'T' 's' */
+    {52, 95, -1},  /* 'T' U+00C4 */
+    {52, 96, -1},  /* 'T' U+00D6 */
+    {52, 99, -1},  /* 'T' U+00E4 */
+    {52, 100, -1},  /* 'T' U+00F6 */
+    {53, 95, -1},  /* 'U' U+00C4 */
+    {54, 12, -1},  /* 'V' ',' */
+    {54, 14, -1},  /* 'V' '.' */
+    {54, 33, -1},  /* 'V' 'A' */
+    {54, 65, -1},  /* 'V' 'a' */
+    {54, 83, -1},  /* 'V' 's' */
+    {54, 95, -1},  /* 'V' U+00C4 */
+    {54, 99, -1},  /* 'V' U+00E4 */
+    {55, 95, -1},  /* 'W' U+00C4 */
+    {57, 12, -1},  /* 'Y' ',' */
+    {57, 14, -1},  /* 'Y' '.' */
+    {57, 33, -1},  /* 'Y' 'A' */
+    {57, 42, -1},  /* 'Y' 'J' */
+    {57, 65, -1},  /* 'Y' 'a' */
+    {57, 68, -1},  /* 'Y' 'd' */
+    {57, 71, -1},  /* 'Y' 'g' */
+    {57, 79, -1},  /* 'Y' 'o' */
+    {57, 81, -1},  /* 'Y' 'q' */
+    {57, 83, -1},  /* 'Y' 's' */
+    {57, 95, -1},  /* 'Y' U+00C4 */
+    {57, 96, -1},  /* 'Y' U+00D6 */
+    {57, 99, -1},  /* 'Y' U+00E4 */
+    {57, 100, -1},  /* 'Y' U+00F6 */
+    {65, 52, -1},  /* 'a' 'T' */
+    {65, 54, -1},  /* 'a' 'V' */
+    {65, 57, -1},  /* 'a' 'Y' */
+    {66, 52, -1},  /* 'b' 'T' */
+    {66, 54, -1},  /* 'b' 'V' */
+    {66, 57, -1},  /* 'b' 'Y' */
+    {66, 95, -1},  /* 'b' U+00C4 */
+    {72, 52, -1},  /* 'h' 'T' */
+    {72, 54, -1},  /* 'h' 'V' */
+    {72, 57, -1},  /* 'h' 'Y' */
+    {73, 52, -1},  /* 'i' 'T' */
+    {73, 54, -1},  /* 'i' 'V' */
+    {73, 57, -1},  /* 'i' 'Y' */
+    {76, 52, -1},  /* 'l' 'T' */
+    {76, 54, -1},  /* 'l' 'V' */
+    {76, 57, -1},  /* 'l' 'Y' */
+    {77, 52, -1},  /* 'm' 'T' */
+    {77, 54, -1},  /* 'm' 'V' */
+    {77, 57, -1},  /* 'm' 'Y' */
+    {78, 52, -1},  /* 'n' 'T' */
+    {78, 54, -1},  /* 'n' 'V' */
+    {78, 57, -1},  /* 'n' 'Y' */
+    {79, 52, -1},  /* 'o' 'T' */
+    {79, 54, -1},  /* 'o' 'V' */
+    {79, 57, -1},  /* 'o' 'Y' */
+    {79, 95, -1},  /* 'o' U+00C4 */
+    {80, 52, -1},  /* 'p' 'T' */
+    {80, 54, -1},  /* 'p' 'V' */
+    {80, 57, -1},  /* 'p' 'Y' */
+    {80, 95, -1},  /* 'p' U+00C4 */
+    {82, 33, -1},  /* 'r' 'A' */
+    {82, 95, -1},  /* 'r' U+00C4 */
+    {83, 95, -1},  /* 's' U+00C4 */
+    {84, 52, -1},  /* 't' 'T' */
+    {84, 54, -1},  /* 't' 'V' */
+    {84, 57, -1},  /* 't' 'Y' */
+    {84, 95, -1},  /* 't' U+00C4 */
+    {86, 95, -1},  /* 'v' U+00C4 */
+    {87, 95, -1},  /* 'w' U+00C4 */
+    {89, 33, -1},  /* 'y' 'A' */
+    {89, 95, -1},  /* 'y' U+00C4 */
+    {95, 35, -1},  /* U+00C4 'C' */
+    {95, 39, -1},  /* U+00C4 'G' */
+    {95, 42, -1},  /* U+00C4 'J' */
+    {95, 47, -1},  /* U+00C4 'O' */
+    {95, 49, -1},  /* U+00C4 'Q' */
+    {95, 52, -1},  /* U+00C4 'T' */
+    {95, 53, -1},  /* U+00C4 'U' */
+    {95, 54, -1},  /* U+00C4 'V' */
+    {95, 55, -1},  /* U+00C4 'W' */
+    {95, 57, -1},  /* U+00C4 'Y' */
+    {95, 68, -1},  /* U+00C4 'd' */
+    {95, 69, -1},  /* U+00C4 'e' */
+    {95, 71, -1},  /* U+00C4 'g' */
+    {95, 79, -1},  /* U+00C4 'o' */
+    {95, 81, -1},  /* U+00C4 'q' */
+    {95, 84, -1},  /* U+00C4 't' */
+    {95, 85, -1},  /* U+00C4 'u' */
+    {95, 86, -1},  /* U+00C4 'v' */
+    {95, 87, -1},  /* U+00C4 'w' */
+    {95, 89, -1},  /* U+00C4 'y' */
+    {95, 97, -1},  /* U+00C4 U+00DC */
+    {95, 100, -1},  /* U+00C4 U+00F6 */
+    {95, 101, -1},  /* U+00C4 U+00FC */
+    {98, 95, -1},  /* U+00DF U+00C4 */
+    {100, 95, -1},  /* U+00F6 U+00C4 */
+};
 
-	// @752 '~' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x28, //   # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
+static const painter_font_data_t s_data = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = NULL,
+    .bearing = 0,
+    .kerning = NULL,
+    .kerning_num = 0,
 };
 
 const font_t Font8 = {
-  Font8_Table,
-  5, /* Width */
-  8, /* Height */
+    NULL,
+    5, /* Width */
+    8, /* Height */
+    &s_data,
 };
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+static const painter_font_data_t s_datap = {
+    .bitmap = s_bitmap,
+    .glyphs = s_glyphs,
+    .ranges = s_ranges,
+    .range_num = 8,
+    .glyph_num = 102,
+    .advance = s_advance,
+    .bearing = 0,
+    .kerning = s_kerning,
+    .kerning_num = 164,
+};
+
+const font_t Font8P = {
+    NULL,
+    6, /* Width */
+    8, /* Height */
+    &s_datap,
+};
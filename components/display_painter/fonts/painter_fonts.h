@@ -15,18 +15,71 @@
 #ifndef __PAINTER_FONTS_H
 #define __PAINTER_FONTS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+/**
+ * Packed fonts are generated from the BDF files in fonts/bdf with
+ * fonts/bdf2font.py. Every glyph stores only its ink box, one bit per pixel,
+ * MSB first and row after row without padding. The bitmap of a glyph starts
+ * on a byte boundary. Cells are at most 31x31 pixels and the bitmap at most
+ * 4 KiB, which keeps a glyph descriptor in one word.
+ */
+typedef struct {
+  uint32_t offset : 12;     ///< First byte of the glyph in the bitmap
+  uint32_t box_w : 5;       ///< Ink box, 0x0 for blank glyphs
+  uint32_t box_h : 5;
+  uint32_t x_ofs : 5;       ///< Ink box position in the monospaced cell
+  uint32_t y_ofs : 5;
+} painter_glyph_dsc_t;
+
+typedef struct {
+  uint16_t first;           ///< First code point
+  uint16_t count;
+  uint16_t glyph;           ///< Glyph index of the first code point
+} painter_font_range_t;
+
+typedef struct {
+  uint8_t left;             ///< Glyph indices, sorted by left and then right
+  uint8_t right;
+  int8_t adjust;            ///< Added to the advance of the left glyph
+} painter_font_kern_t;
+
+typedef struct {
+  const uint8_t *bitmap;
+  const painter_glyph_dsc_t *glyphs;
+  const painter_font_range_t *ranges;   ///< Code points with a glyph, ascending
+  uint16_t range_num;
+  uint16_t glyph_num;
+  const uint8_t *advance;               ///< Advance of each glyph, NULL for a monospaced font
+  uint8_t bearing;                      ///< Space left of the ink box in proportional fonts
+  const painter_font_kern_t *kerning;   ///< NULL without kerning
+  uint16_t kerning_num;
+} painter_font_data_t;
+
+/**
+ * A font without data is a table of fixed size glyphs from ' ' to '~', each
+ * row starting on a byte, like the fonts of earlier versions.
+ */
 typedef struct {
   const uint8_t *table;
-  uint16_t Width;
+  uint16_t Width;                       ///< Cell width, the advance of monospaced fonts
   uint16_t Height;
+  const painter_font_data_t *data;      ///< Packed glyphs, NULL for a table font
 }font_t;
 
+/* Monospaced, pixel for pixel the fonts of earlier versions plus Ä Ö Ü ä ö ü ß */
 extern const font_t Font24;
 extern const font_t Font20;
 extern const font_t Font16;
 extern const font_t Font12;
 extern const font_t Font8;
 
+/* The same glyphs set proportionally with kerning, Width is the widest advance */
+extern const font_t Font24P;
+extern const font_t Font20P;
+extern const font_t Font16P;
+extern const font_t Font12P;
+extern const font_t Font8P;
+
 #endif /* __PAINTER_FONTS_H */
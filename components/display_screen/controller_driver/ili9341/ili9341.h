@@ -126,6 +126,113 @@ esp_err_t lcd_ili9341_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
  */
 esp_err_t lcd_ili9341_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
 
+/**
+ * @brief Fill a rectangle on LCD screen with one color
+ * 
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param w width of the rectangle
+ * @param h height of the rectangle
+ * @param color Color to fill
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Start filling the pixels on LCD screen with bitmap, the transfer continues after return
+ * 
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param w width of image in bitmap array
+ * @param h height of image in bitmap array
+ * @param bitmap pointer to bitmap array, must stay untouched until lcd_ili9341_draw_wait returns
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_draw_bitmap_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+/**
+ * @brief Wait for the bitmap started by lcd_ili9341_draw_bitmap_async
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_draw_wait(void);
+
+/**
+ * @brief Fill the pixels on LCD screen with a bitmap already in bus byte order
+ * 
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param w width of image in bitmap array
+ * @param h height of image in bitmap array
+ * @param bitmap pointer to bitmap array, pixels byte swapped if lcd_ili9341_get_wire_swap says so
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_draw_bitmap_wire(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+/**
+ * @brief Same as lcd_ili9341_draw_bitmap_wire, the transfer continues after return
+ * 
+ * @param x Starting point in X direction
+ * @param y Starting point in Y direction
+ * @param w width of image in bitmap array
+ * @param h height of image in bitmap array
+ * @param bitmap pointer to bitmap array, must stay untouched until lcd_ili9341_draw_wait returns
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_draw_bitmap_wire_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+/**
+ * @brief Get whether RGB565 pixels have to be byte swapped for lcd_ili9341_draw_bitmap_wire
+ * 
+ * @param swap true if the bus swaps the bytes of each pixel in lcd_ili9341_draw_bitmap
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG swap is NULL
+ */
+esp_err_t lcd_ili9341_get_wire_swap(bool *swap);
+
+/**
+ * @brief Make rows y to y + h - 1 scroll vertically with VSCRDEF
+ * 
+ * @param y first row of the area
+ * @param h rows of the area
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG area outside of the screen
+ *      - ESP_ERR_NOT_SUPPORTED rotation with MY or MV, the controller does not scroll down the screen
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_set_scroll_area(uint16_t y, uint16_t h);
+
+/**
+ * @brief Scroll the area of lcd_ili9341_set_scroll_area up by start rows with VSCRSADD
+ * 
+ * @param start less than the height of the area
+ * 
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE no scroll area set
+ *      - ESP_ERR_INVALID_ARG start too large
+ *      - ESP_FAIL Failed
+ */
+esp_err_t lcd_ili9341_set_scroll_start(uint16_t start);
+
 
 #ifdef __cplusplus
 }
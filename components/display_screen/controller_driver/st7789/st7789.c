@@ -69,6 +69,14 @@ scr_driver_t lcd_st7789_default_driver = {
     .write_ram_data = lcd_st7789_write_ram_data,
     .draw_pixel = lcd_st7789_draw_pixel,
     .draw_bitmap = lcd_st7789_draw_bitmap,
+    .fill_rect = lcd_st7789_fill_rect,
+    .draw_bitmap_async = lcd_st7789_draw_bitmap_async,
+    .draw_wait = lcd_st7789_draw_wait,
+    .draw_bitmap_wire = lcd_st7789_draw_bitmap_wire,
+    .draw_bitmap_wire_async = lcd_st7789_draw_bitmap_wire_async,
+    .get_wire_swap = lcd_st7789_get_wire_swap,
+    .set_scroll_area = lcd_st7789_set_scroll_area,
+    .set_scroll_start = lcd_st7789_set_scroll_start,
     .get_info = lcd_st7789_get_info,
 };
 
@@ -313,7 +321,12 @@ esp_err_t lcd_st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color)
     return lcd_st7789_write_ram_data(color);
 }
 
-esp_err_t lcd_st7789_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+/**
+ * Set the window and send the bitmap with one of the interface write functions,
+ * which decide whether the bytes are swapped and whether the call waits
+ */
+static esp_err_t lcd_st7789_write_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap,
+                                      esp_err_t (*write)(void *handle, const uint8_t *data, uint32_t length))
 {
     esp_err_t ret;
     LCD_CHECK(NULL != bitmap, "bitmap pointer invalid", ESP_ERR_INVALID_ARG);
@@ -325,8 +338,67 @@ esp_err_t lcd_st7789_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     }
 
     uint32_t len = w * h;
-    ret = LCD_WRITE((uint8_t *)bitmap, 2 * len);
+    ret = write(g_lcd_handle.interface_drv, (uint8_t *)bitmap, 2 * len);
     LCD_IFACE_RELEASE();
     LCD_CHECK(ESP_OK == ret, "lcd write ram data failed", ESP_FAIL);
     return ESP_OK;
 }
+
+esp_err_t lcd_st7789_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_st7789_write_bitmap(x, y, w, h, bitmap, g_lcd_handle.interface_drv->write);
+}
+
+esp_err_t lcd_st7789_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    esp_err_t ret;
+    LCD_CHECK(0 != w && 0 != h, "rectangle is empty", ESP_ERR_INVALID_ARG);
+
+    LCD_IFACE_ACQUIRE();
+    ret = lcd_st7789_set_window(x, y, x + w - 1, y + h - 1);
+    if (ESP_OK != ret) {
+        return ESP_FAIL;
+    }
+
+    ret = scr_utility_fill_color(&g_lcd_handle, (uint32_t)w * h, color);
+    LCD_IFACE_RELEASE();
+    LCD_CHECK(ESP_OK == ret, "lcd fill ram data failed", ESP_FAIL);
+    return ESP_OK;
+}
+
+esp_err_t lcd_st7789_draw_bitmap_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_st7789_write_bitmap(x, y, w, h, bitmap, g_lcd_handle.interface_drv->write_async);
+}
+
+esp_err_t lcd_st7789_draw_bitmap_wire(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_st7789_write_bitmap(x, y, w, h, bitmap, g_lcd_handle.interface_drv->write_wire);
+}
+
+esp_err_t lcd_st7789_draw_bitmap_wire_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_st7789_write_bitmap(x, y, w, h, bitmap, g_lcd_handle.interface_drv->write_wire_async);
+}
+
+esp_err_t lcd_st7789_get_wire_swap(bool *swap)
+{
+    LCD_CHECK(NULL != swap, "swap pointer invalid", ESP_ERR_INVALID_ARG);
+    *swap = g_lcd_handle.interface_drv->get_swap(g_lcd_handle.interface_drv);
+    return ESP_OK;
+}
+
+esp_err_t lcd_st7789_set_scroll_area(uint16_t y, uint16_t h)
+{
+    return scr_utility_set_scroll_area(&g_lcd_handle, ST7789_RESOLUTION_VER, y, h);
+}
+
+esp_err_t lcd_st7789_set_scroll_start(uint16_t start)
+{
+    return scr_utility_set_scroll_start(&g_lcd_handle, start);
+}
+
+esp_err_t lcd_st7789_draw_wait(void)
+{
+    return LCD_WAIT();
+}
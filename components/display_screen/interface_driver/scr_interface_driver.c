@@ -69,6 +69,17 @@ static esp_err_t _i2s_lcd_read(void *handle, uint8_t *data, uint32_t length)
     return ESP_ERR_NOT_SUPPORTED;
 }
 
+static esp_err_t _i2s_lcd_wait(void *handle)
+{
+    /* writes are synchronous */
+    return ESP_OK;
+}
+
+static bool _i2s_lcd_get_swap(void *handle)
+{
+    return false;
+}
+
 static esp_err_t _i2s_lcd_acquire(void *handle)
 {
 #ifndef CONFIG_IDF_TARGET_ESP32S3
@@ -159,6 +170,17 @@ static esp_err_t i2c_lcd_read(void *handle, uint8_t *data, uint32_t length)
     return ESP_ERR_NOT_SUPPORTED;
 }
 
+static esp_err_t i2c_lcd_wait(void *handle)
+{
+    /* writes are synchronous */
+    return ESP_OK;
+}
+
+static bool i2c_lcd_get_swap(void *handle)
+{
+    return false;
+}
+
 static esp_err_t i2c_lcd_acquire(void *handle)
 {
     return ESP_ERR_NOT_SUPPORTED;
@@ -177,6 +199,9 @@ typedef struct {
     spi_bus_device_handle_t spi_wr_dev;
     int8_t pin_num_dc;
     uint8_t swap_data;
+    uint8_t *async_data;        /* buffer of the transfer in flight, NULL if none */
+    uint32_t async_length;
+    bool async_swapped;         /* async_data has to be swapped back when done */
     scr_interface_driver_t interface_drv;
 } interface_spi_handle_t;
 
@@ -190,6 +215,9 @@ static esp_err_t spi_lcd_driver_init(const scr_interface_spi_config_t *cfg, inte
     gpio_set_direction(cfg->pin_num_dc, GPIO_MODE_OUTPUT);
     out_interface_spi->pin_num_dc = cfg->pin_num_dc;
     out_interface_spi->swap_data = cfg->swap_data;
+    out_interface_spi->async_data = NULL;
+    out_interface_spi->async_length = 0;
+    out_interface_spi->async_swapped = false;
 
     spi_device_config_t devcfg = {
         .clock_speed_hz = cfg->clk_freq,     //Clock out frequency
@@ -202,8 +230,11 @@ static esp_err_t spi_lcd_driver_init(const scr_interface_spi_config_t *cfg, inte
     return ESP_OK;
 }
 
+static esp_err_t spi_lcd_driver_wait(void *handle);
+
 static esp_err_t spi_lcd_driver_deinit(interface_spi_handle_t *interface_spi)
 {
+    spi_lcd_driver_wait(&interface_spi->interface_drv);
     spi_bus_device_delete(&interface_spi->spi_wr_dev);
     return ESP_OK;
 }
@@ -224,10 +255,83 @@ static esp_err_t _lcd_spi_rw(spi_bus_device_handle_t spi, const uint8_t *output,
     return spi_bus_transfer_bytes(spi, output, input, length);
 }
 
+/**< Swap the high and low byte of the data */
+static void spi_lcd_swap_bytes(const uint8_t *data, uint32_t length)
+{
+    uint16_t *p = (uint16_t *)data;
+    uint16_t t;
+    for (size_t i = 0; i < length / 2; i++) {
+        t = *p;
+        *p = t >> 8 | t << 8;
+        p++;
+    }
+}
+
+/**
+ * Only one asynchronous transfer is kept in flight. It has to finish before
+ * anything else is sent, the DC line must not change during a data transfer.
+ */
+static esp_err_t spi_lcd_driver_wait(void *handle)
+{
+    interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
+    if (NULL == interface_spi->async_data) {
+        return ESP_OK;
+    }
+    esp_err_t ret = spi_bus_transfer_wait(interface_spi->spi_wr_dev, portMAX_DELAY);
+    if (interface_spi->async_swapped) {
+        spi_lcd_swap_bytes(interface_spi->async_data, interface_spi->async_length);
+    }
+    interface_spi->async_data = NULL;
+    LCD_IFACE_CHECK(ESP_OK == ret, "Wait data failed", ESP_FAIL);
+    return ESP_OK;
+}
+
+static esp_err_t spi_lcd_driver_start(void *handle, const uint8_t *data, uint32_t length, bool swap)
+{
+    interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
+    LCD_IFACE_CHECK(0 != length, "Length should not be 0", ESP_ERR_INVALID_ARG);
+    esp_err_t ret = spi_lcd_driver_wait(handle);
+    LCD_IFACE_CHECK(ESP_OK == ret, "Previous data failed", ESP_FAIL);
+
+    /* the data is swapped back when the transfer is collected */
+    if (swap) {
+        spi_lcd_swap_bytes(data, length);
+    }
+    ret = spi_bus_transfer_bytes_async(interface_spi->spi_wr_dev, data, length);
+    if (ESP_OK != ret) {
+        if (swap) {
+            spi_lcd_swap_bytes(data, length);
+        }
+        LCD_IFACE_CHECK(false, "Write data failed", ESP_FAIL);
+    }
+    interface_spi->async_data = (uint8_t *)data;
+    interface_spi->async_length = length;
+    interface_spi->async_swapped = swap;
+    return ESP_OK;
+}
+
+static esp_err_t spi_lcd_driver_write_async(void *handle, const uint8_t *data, uint32_t length)
+{
+    interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
+    return spi_lcd_driver_start(handle, data, length, interface_spi->swap_data);
+}
+
+static esp_err_t spi_lcd_driver_write_wire_async(void *handle, const uint8_t *data, uint32_t length)
+{
+    return spi_lcd_driver_start(handle, data, length, false);
+}
+
+static bool spi_lcd_driver_get_swap(void *handle)
+{
+    interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
+    return interface_spi->swap_data;
+}
+
 static esp_err_t spi_lcd_driver_write_cmd(void *handle, uint16_t value)
 {
     interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
     esp_err_t ret;
+    spi_lcd_driver_wait(handle);
     gpio_set_level(interface_spi->pin_num_dc, LCD_CMD_LEV);
     uint8_t data = value;
     ret = _lcd_spi_rw(interface_spi->spi_wr_dev, &data, NULL, 1);
@@ -240,6 +344,7 @@ static esp_err_t spi_lcd_driver_write_data(void *handle, uint16_t value)
 {
     interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
     esp_err_t ret;
+    spi_lcd_driver_wait(handle);
     uint8_t data = value;
     ret = _lcd_spi_rw(interface_spi->spi_wr_dev, &data, NULL, 1);
     LCD_IFACE_CHECK(ESP_OK == ret, "Send cmd failed", ESP_FAIL);
@@ -250,6 +355,7 @@ static esp_err_t spi_lcd_driver_read(void *handle, uint8_t *data, uint32_t lengt
 {
     interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
     esp_err_t ret;
+    spi_lcd_driver_wait(handle);
     ret = _lcd_spi_rw(interface_spi->spi_wr_dev, NULL, data, length);
     LCD_IFACE_CHECK(ESP_OK == ret, "Read data failed", ESP_FAIL);
     return ESP_OK;
@@ -259,38 +365,36 @@ static esp_err_t spi_lcd_driver_write(void *handle, const uint8_t *data, uint32_
 {
     interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
     esp_err_t ret;
+    spi_lcd_driver_wait(handle);
 
-    /**< Swap the high and low byte of the data */
-    uint32_t l = length / 2;
-    uint16_t t;
     if (interface_spi->swap_data) {
-        uint16_t *p = (uint16_t *)data;
-        for (size_t i = 0; i < l; i++) {
-            t = *p;
-            *p = t >> 8 | t << 8;
-            p++;
-        }
+        spi_lcd_swap_bytes(data, length);
     }
     ret = _lcd_spi_rw(interface_spi->spi_wr_dev, data, NULL, length);
 
     /**
      * @brief swap data to restore the order of data
      *
-     * TODO: how to avoid swap data here
+     * Producers that can store their pixels swapped use write_wire instead
      *
      */
     if (interface_spi->swap_data) {
-        uint16_t *_p = (uint16_t *)data;
-        for (size_t i = 0; i < l; i++) {
-            t = *_p;
-            *_p = t >> 8 | t << 8;
-            _p++;
-        }
+        spi_lcd_swap_bytes(data, length);
     }
     LCD_IFACE_CHECK(ESP_OK == ret, "Write data failed", ESP_FAIL);
     return ESP_OK;
 }
 
+static esp_err_t spi_lcd_driver_write_wire(void *handle, const uint8_t *data, uint32_t length)
+{
+    interface_spi_handle_t *interface_spi = __containerof(handle, interface_spi_handle_t, interface_drv);
+    esp_err_t ret;
+    spi_lcd_driver_wait(handle);
+    ret = _lcd_spi_rw(interface_spi->spi_wr_dev, data, NULL, length);
+    LCD_IFACE_CHECK(ESP_OK == ret, "Write data failed", ESP_FAIL);
+    return ESP_OK;
+}
+
 /*********************************************************/
 esp_err_t scr_interface_create(scr_interface_type_t type, void *config, scr_interface_driver_t **out_driver)
 {
@@ -316,6 +420,11 @@ esp_err_t scr_interface_create(scr_interface_type_t type, void *config, scr_inte
         interface_i2s->interface_drv.read        = _i2s_lcd_read;
         interface_i2s->interface_drv.bus_acquire = _i2s_lcd_acquire;
         interface_i2s->interface_drv.bus_release = _i2s_lcd_release;
+        interface_i2s->interface_drv.write_async = _i2s_lcd_write;
+        interface_i2s->interface_drv.wait        = _i2s_lcd_wait;
+        interface_i2s->interface_drv.write_wire  = _i2s_lcd_write;
+        interface_i2s->interface_drv.write_wire_async = _i2s_lcd_write;
+        interface_i2s->interface_drv.get_swap    = _i2s_lcd_get_swap;
 
         *out_driver = &interface_i2s->interface_drv;
 #else
@@ -339,6 +448,11 @@ esp_err_t scr_interface_create(scr_interface_type_t type, void *config, scr_inte
         interface_spi->interface_drv.read        = spi_lcd_driver_read;
         interface_spi->interface_drv.bus_acquire = spi_lcd_driver_acquire;
         interface_spi->interface_drv.bus_release = spi_lcd_driver_release;
+        interface_spi->interface_drv.write_async = spi_lcd_driver_write_async;
+        interface_spi->interface_drv.wait        = spi_lcd_driver_wait;
+        interface_spi->interface_drv.write_wire  = spi_lcd_driver_write_wire;
+        interface_spi->interface_drv.write_wire_async = spi_lcd_driver_write_wire_async;
+        interface_spi->interface_drv.get_swap    = spi_lcd_driver_get_swap;
 
         *out_driver = &interface_spi->interface_drv;
 
@@ -360,6 +474,11 @@ esp_err_t scr_interface_create(scr_interface_type_t type, void *config, scr_inte
         interface_i2c->interface_drv.read        = i2c_lcd_read;
         interface_i2c->interface_drv.bus_acquire = i2c_lcd_acquire;
         interface_i2c->interface_drv.bus_release = i2c_lcd_release;
+        interface_i2c->interface_drv.write_async = i2c_lcd_write;
+        interface_i2c->interface_drv.wait        = i2c_lcd_wait;
+        interface_i2c->interface_drv.write_wire  = i2c_lcd_write;
+        interface_i2c->interface_drv.write_wire_async = i2c_lcd_write;
+        interface_i2c->interface_drv.get_swap    = i2c_lcd_get_swap;
 
         *out_driver = &interface_i2c->interface_drv;
     }
@@ -68,6 +68,11 @@ typedef struct {
     esp_err_t (*read)(void *handle, uint8_t *data, uint32_t length);            /*!< Function to read a block data */
     esp_err_t (*bus_acquire)(void *handle);                                     /*!< Function to acquire interface bus */
     esp_err_t (*bus_release)(void *handle);                                     /*!< Function to release interface bus */
+    esp_err_t (*write_async)(void *handle, const uint8_t *data, uint32_t length); /*!< Function to start writing a block data, the data must stay untouched until wait returns */
+    esp_err_t (*wait)(void *handle);                                            /*!< Function to wait for the block data started by write_async */
+    esp_err_t (*write_wire)(void *handle, const uint8_t *data, uint32_t length);  /*!< Function to write a block data already in bus byte order, it is never swapped */
+    esp_err_t (*write_wire_async)(void *handle, const uint8_t *data, uint32_t length); /*!< Asynchronous write_wire, finished by wait */
+    bool (*get_swap)(void *handle);                                             /*!< Function to get whether write swaps the bytes of each 16 bit pixel */
 } scr_interface_driver_t;
 
 /**
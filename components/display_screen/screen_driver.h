@@ -266,6 +266,138 @@ typedef struct {
     */
     esp_err_t (*draw_bitmap)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
 
+    /**
+    * @brief Fill a rectangle on LCD screen with one color
+    *
+    * The window is set once and a small buffer of the color is sent repeatedly.
+    *
+    * @param x Starting point in X direction
+    * @param y Starting point in Y direction
+    * @param w width of the rectangle
+    * @param h height of the rectangle
+    * @param color Color to fill
+    *
+    * @note Optional, NULL when the controller driver does not implement it
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*fill_rect)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+    /**
+    * @brief Start filling the pixels on LCD screen with bitmap and return before the transfer is done
+    *
+    * The bitmap must stay untouched until draw_wait returns, other calls
+    * to the driver wait for the transfer first.
+    *
+    * @param x Starting point in X direction
+    * @param y Starting point in Y direction
+    * @param w width of image in bitmap array
+    * @param h height of image in bitmap array
+    * @param bitmap pointer to bitmap array, must be DMA capable
+    *
+    * @note Optional, NULL when the controller driver does not implement it
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*draw_bitmap_async)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+    /**
+    * @brief Wait for the bitmap started by draw_bitmap_async
+    *
+    * @note Optional, set together with draw_bitmap_async
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*draw_wait)(void);
+
+    /**
+    * @brief Fill the pixels on LCD screen with a bitmap already in bus byte order
+    *
+    * draw_bitmap may byte swap the pixels for the bus and swap them back
+    * afterwards. Producers that write their pixels in bus order, see
+    * get_wire_swap, send them with this function and both passes are skipped.
+    *
+    * @param x Starting point in X direction
+    * @param y Starting point in Y direction
+    * @param w width of image in bitmap array
+    * @param h height of image in bitmap array
+    * @param bitmap pointer to bitmap array
+    *
+    * @note Optional, NULL when the controller driver does not implement it
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*draw_bitmap_wire)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+    /**
+    * @brief Asynchronous draw_bitmap_wire, finished by draw_wait
+    *
+    * @note Optional, set together with draw_bitmap_wire and draw_bitmap_async
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*draw_bitmap_wire_async)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap);
+
+    /**
+    * @brief Get the byte order draw_bitmap_wire expects
+    *
+    * @param swap true if each RGB565 pixel has to be stored high byte first
+    *
+    * @note Optional, set together with draw_bitmap_wire
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_ERR_INVALID_ARG swap is NULL
+    */
+    esp_err_t (*get_wire_swap)(bool *swap);
+
+    /**
+    * @brief Make rows of the screen scroll vertically
+    *
+    * Rows y to y + h - 1 become a ring that set_scroll_start turns, the rows
+    * around them stay in place. Scrolling moves what the controller shows,
+    * not its memory: after set_scroll_start(s) screen row y + i shows the
+    * memory row y + (i + s) % h, which is where drawing at that row goes.
+    * A new line at the bottom costs one line of pixels instead of the area.
+    *
+    * @param y first row of the area
+    * @param h rows of the area, h = screen height and start 0 scroll nothing
+    *
+    * @note Optional, NULL when the controller driver does not implement it
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_ERR_INVALID_ARG area outside of the screen
+    *      - ESP_ERR_NOT_SUPPORTED the screen direction scrolls horizontally
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*set_scroll_area)(uint16_t y, uint16_t h);
+
+    /**
+    * @brief Scroll the area of set_scroll_area up by start rows from its origin
+    *
+    * @param start less than the height of the area
+    *
+    * @note Optional, set together with set_scroll_area
+    *
+    * @return
+    *      - ESP_OK on success
+    *      - ESP_ERR_INVALID_STATE no scroll area set
+    *      - ESP_ERR_INVALID_ARG start too large
+    *      - ESP_FAIL Failed
+    */
+    esp_err_t (*set_scroll_start)(uint16_t start);
+
     /**
     * @brief Get screen information
     *
@@ -14,10 +14,19 @@
 
 #include "stdint.h"
 #include "esp_log.h"
+#include "esp_attr.h"
 #include "screen_utility.h"
 
 static const char *TAG = "screen utility";
 
+/** 1 KB per transaction keeps the per-transaction overhead below 5% at 40 MHz */
+#define SCR_FILL_BUF_PIXELS 512
+
+static DMA_ATTR uint16_t s_fill_buf[SCR_FILL_BUF_PIXELS];
+
+#define SCR_CMD_VSCRDEF  0x33  // Vertical Scrolling Definition
+#define SCR_CMD_VSCRSADD 0x37  // Vertical Scroll Start Address of RAM
+
 void scr_utility_apply_offset(const scr_handle_t *lcd_handle, uint16_t res_hor, uint16_t res_ver, uint16_t *x0, uint16_t *y0, uint16_t *x1, uint16_t *y1)
 {
     scr_dir_t dir = lcd_handle->dir;
@@ -68,3 +77,76 @@ void scr_utility_apply_offset(const scr_handle_t *lcd_handle, uint16_t res_hor,
     *y1 += yoffset;
 }
 
+esp_err_t scr_utility_fill_color(const scr_handle_t *lcd_handle, uint32_t pixels, uint16_t color)
+{
+    scr_interface_driver_t *iface = lcd_handle->interface_drv;
+    /* store the color in bus order once instead of swapping on every write */
+    if (iface->get_swap(iface)) {
+        color = color >> 8 | color << 8;
+    }
+    uint32_t n = pixels < SCR_FILL_BUF_PIXELS ? pixels : SCR_FILL_BUF_PIXELS;
+    for (uint32_t i = 0; i < n; i++) {
+        s_fill_buf[i] = color;
+    }
+
+    esp_err_t ret = ESP_OK;
+    while (pixels > 0 && ESP_OK == ret) {
+        n = pixels < SCR_FILL_BUF_PIXELS ? pixels : SCR_FILL_BUF_PIXELS;
+        ret = iface->write_wire(iface, (uint8_t *)s_fill_buf, n * sizeof(uint16_t));
+        pixels -= n;
+    }
+    return ret;
+}
+
+static esp_err_t scr_utility_write_words(const scr_handle_t *lcd_handle, uint16_t cmd, const uint16_t *words, int num)
+{
+    scr_interface_driver_t *iface = lcd_handle->interface_drv;
+    iface->bus_acquire(iface);
+    esp_err_t ret = iface->write_cmd(iface, cmd);
+    for (int i = 0; i < num; i++) {
+        ret |= iface->write_data(iface, words[i] >> 8);
+        ret |= iface->write_data(iface, words[i] & 0xff);
+    }
+    iface->bus_release(iface);
+    return ESP_OK == ret ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t scr_utility_set_scroll_area(scr_handle_t *lcd_handle, uint16_t res_ver, uint16_t y, uint16_t h)
+{
+    scr_dir_t dir = lcd_handle->dir;
+    if (SCR_DIR_MAX < dir) {
+        dir >>= 5;
+    }
+    if (SCR_DIR_LRTB != dir && SCR_DIR_RLTB != dir) {
+        ESP_LOGE(TAG, "no vertical scrolling in direction %d", dir);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (0 == h || y + h > lcd_handle->height) {
+        ESP_LOGE(TAG, "scroll area %d+%d outside of the screen", y, h);
+        return ESP_ERR_INVALID_ARG;
+    }
+    /* top fixed area, scroll area and bottom fixed area cover the whole memory */
+    uint16_t top = lcd_handle->offset_ver + y;
+    uint16_t words[3] = { top, h, res_ver - top - h };
+    esp_err_t ret = scr_utility_write_words(lcd_handle, SCR_CMD_VSCRDEF, words, 3);
+    if (ESP_OK != ret) {
+        return ret;
+    }
+    lcd_handle->scroll_top = top;
+    lcd_handle->scroll_height = h;
+    return scr_utility_set_scroll_start(lcd_handle, 0);
+}
+
+esp_err_t scr_utility_set_scroll_start(const scr_handle_t *lcd_handle, uint16_t start)
+{
+    if (0 == lcd_handle->scroll_height) {
+        ESP_LOGE(TAG, "no scroll area");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (start >= lcd_handle->scroll_height) {
+        ESP_LOGE(TAG, "scroll start %d outside of the area", start);
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint16_t addr = lcd_handle->scroll_top + start;
+    return scr_utility_write_words(lcd_handle, SCR_CMD_VSCRSADD, &addr, 1);
+}
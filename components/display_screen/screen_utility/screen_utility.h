@@ -34,10 +34,62 @@ typedef struct {
     uint16_t offset_hor;
     uint16_t offset_ver;
     scr_dir_t dir;
+    uint16_t scroll_top;        ///< Controller row of the first row of the scroll area
+    uint16_t scroll_height;     ///< Rows of the scroll area, 0 without one
 } scr_handle_t;
 
 void scr_utility_apply_offset(const scr_handle_t *lcd_handle, uint16_t res_hor, uint16_t res_ver, uint16_t *x0, uint16_t *y0, uint16_t *x1, uint16_t *y1);
 
+/**
+ * @brief Write the same RGB565 color to the screen RAM repeatedly
+ *
+ * The window must already be set. A small DMA capable buffer of the color is
+ * sent as often as needed, so only one window setup is needed for any area.
+ *
+ * @param lcd_handle screen parameters
+ * @param pixels number of pixels to write
+ * @param color color of the pixels
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL Failed
+ */
+esp_err_t scr_utility_fill_color(const scr_handle_t *lcd_handle, uint32_t pixels, uint16_t color);
+
+/**
+ * @brief Define the vertical scroll area with the MIPI DCS command VSCRDEF (0x33)
+ *
+ * The scroll start is reset to the top of the area. Only directions without
+ * MADCTL MY and MV are supported, with those the controller scrolls the
+ * screen backwards or horizontally.
+ *
+ * @param lcd_handle screen parameters, the area is stored in it
+ * @param res_ver rows of the controller memory
+ * @param y first screen row of the area
+ * @param h rows of the area
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG area outside of the screen
+ *      - ESP_ERR_NOT_SUPPORTED screen direction can not scroll vertically
+ *      - ESP_FAIL Failed
+ */
+esp_err_t scr_utility_set_scroll_area(scr_handle_t *lcd_handle, uint16_t res_ver, uint16_t y, uint16_t h);
+
+/**
+ * @brief Set the row shown at the top of the scroll area with VSCRSADD (0x37)
+ *
+ * @param lcd_handle screen parameters
+ * @param start rows the area is scrolled up, less than its height
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE no scroll area set
+ *      - ESP_ERR_INVALID_ARG start too large
+ *      - ESP_FAIL Failed
+ */
+esp_err_t scr_utility_set_scroll_start(const scr_handle_t *lcd_handle, uint16_t start);
+
 #ifdef __cplusplus
 }
 #endif
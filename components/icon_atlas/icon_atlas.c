@@ -0,0 +1,98 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "screen_driver.h"
+#include "display_painter.h"
+#include "display_server.h"
+#include "icon_atlas.h"
+
+static const char *TAG = "icon atlas";
+
+#define ICON_ATLAS_CHECK(a, str, ret)  if(!(a)) {                               \
+        ESP_LOGE(TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str);   \
+        return (ret);                                                           \
+    }
+
+static const uint8_t *s_atlas = NULL;       ///< Mapped partition, NULL until icon_atlas_init()
+static spi_flash_mmap_handle_t s_mmap;
+
+typedef struct {
+    const icon_atlas_entry_t *icon;
+    int16_t x;
+    int16_t y;
+} icon_atlas_draw_t;
+
+esp_err_t icon_atlas_init(const char *label)
+{
+    if (s_atlas) {
+        return ESP_OK;
+    }
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    ICON_ATLAS_CHECK(NULL != part, "partition not found", ESP_ERR_NOT_FOUND);
+
+    icon_atlas_header_t header;
+    esp_err_t ret = esp_partition_read(part, 0, &header, sizeof(header));
+    ICON_ATLAS_CHECK(ESP_OK == ret, "partition read failed", ret);
+    if (ICON_ATLAS_MAGIC != header.magic || ICON_ATLAS_VERSION != header.version || header.size > part->size) {
+        ESP_LOGW(TAG, "partition %s holds no icon atlas, flash it with idf.py flash", label);
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    /* only the pages the atlas occupies take MMU entries */
+    const void *ptr;
+    ret = esp_partition_mmap(part, 0, header.size, SPI_FLASH_MMAP_DATA, &ptr, &s_mmap);
+    ICON_ATLAS_CHECK(ESP_OK == ret, "partition mmap failed", ret);
+    s_atlas = ptr;
+    ESP_LOGI(TAG, "%u icons, %u bytes", header.count, header.size);
+    return ESP_OK;
+}
+
+static int entry_compare(const void *name, const void *entry)
+{
+    return strncmp(name, ((const icon_atlas_entry_t *)entry)->name, ICON_ATLAS_NAME_LEN);
+}
+
+const icon_atlas_entry_t *icon_atlas_find(const char *name)
+{
+    if (NULL == s_atlas || NULL == name) {
+        return NULL;
+    }
+    const icon_atlas_header_t *header = (const icon_atlas_header_t *)s_atlas;
+    return bsearch(name, header + 1, header->count, sizeof(icon_atlas_entry_t), entry_compare);
+}
+
+/* Runs in the display task */
+static void icon_atlas_draw_cb(void *arg)
+{
+    const icon_atlas_draw_t *draw = arg;
+    const icon_atlas_entry_t *icon = draw->icon;
+    painter_draw_image_rle(draw->x, draw->y, icon->width, icon->height, (const uint16_t *)(s_atlas + icon->offset));
+    painter_flush();
+}
+
+esp_err_t icon_atlas_draw(const char *name, int x, int y)
+{
+    icon_atlas_draw_t draw = {
+        .icon = icon_atlas_find(name),
+        .x = x,
+        .y = y,
+    };
+    if (NULL == draw.icon) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return display_server_call(0, icon_atlas_draw_cb, &draw, sizeof(draw));
+}
@@ -0,0 +1,78 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _ICON_ATLAS_H_
+#define _ICON_ATLAS_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "icon_atlas_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Icons decoded at build time and stored in a flash partition.
+ *
+ * icon_atlas_create_partition_image() in the project CMakeLists.txt decodes
+ * the JPEG files of a directory with the firmware's decoder settings and
+ * writes them run-length encoded to a data partition. At runtime the
+ * partition is memory mapped once and an icon is drawn straight from flash
+ * with painter_draw_image_rle(), without reading a file or decoding.
+ *
+ * The layout of the partition is in icon_atlas_format.h.
+ */
+
+/**
+ * @brief Map the atlas partition, once
+ *
+ * @param label Label of the partition, see partitions_example.csv
+ *
+ * @return
+ *      - ESP_OK Success, or already mapped
+ *      - ESP_ERR_NOT_FOUND No such partition
+ *      - ESP_ERR_INVALID_VERSION The partition holds no atlas, or one of another version
+ *      - Others Mapping failed
+ */
+esp_err_t icon_atlas_init(const char *label);
+
+/**
+ * @brief Find an icon by the name of its JPEG file
+ *
+ * @return The icon, NULL if the atlas is not mapped or has no such icon
+ */
+const icon_atlas_entry_t *icon_atlas_find(const char *name);
+
+/**
+ * @brief Draw an icon, in the display task when the display server runs
+ *
+ * The pixels are read from flash while they are sent, nothing is allocated.
+ *
+ * @param name File name of the JPEG the icon was decoded from
+ * @param x Left edge on screen
+ * @param y Top edge on screen
+ *
+ * @return
+ *      - ESP_OK Queued or drawn
+ *      - ESP_ERR_NOT_FOUND No such icon, or the atlas is not mapped
+ *      - ESP_ERR_NO_MEM Display queue full
+ */
+esp_err_t icon_atlas_draw(const char *name, int x, int y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
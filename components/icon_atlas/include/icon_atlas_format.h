@@ -0,0 +1,47 @@
+// Copyright 2021 Espressif Systems (Shanghai) Co. Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _ICON_ATLAS_FORMAT_H_
+#define _ICON_ATLAS_FORMAT_H_
+
+#include <stdint.h>
+
+/**
+ * Layout of the icon atlas partition, shared with the generator that runs
+ * on the build machine. All numbers are little endian:
+ * - icon_atlas_header_t
+ * - icon_atlas_entry_t for each icon, sorted by name
+ * - the pixels of each icon in painter_draw_image_rle() format, 4 byte aligned
+ */
+
+#define ICON_ATLAS_MAGIC    0x4C544149  ///< "IATL"
+#define ICON_ATLAS_VERSION  1
+#define ICON_ATLAS_NAME_LEN 32          ///< Bytes of a file name, '\0' included
+
+typedef struct {
+    uint32_t magic;             ///< ICON_ATLAS_MAGIC
+    uint16_t version;           ///< ICON_ATLAS_VERSION
+    uint16_t count;             ///< Icons in the atlas
+    uint32_t size;              ///< Bytes of the atlas, header included
+} icon_atlas_header_t;
+
+typedef struct {
+    char name[ICON_ATLAS_NAME_LEN]; ///< File name of the JPEG the icon was decoded from
+    uint16_t width;
+    uint16_t height;
+    uint32_t offset;            ///< Start of the pixels, from the start of the atlas
+    uint32_t length;            ///< Bytes of the pixels
+} icon_atlas_entry_t;
+
+#endif
@@ -0,0 +1,55 @@
+# icon_atlas_create_partition_image
+#
+# Decode the JPEG files of icon_dir into an icon atlas image for the data
+# partition named partition, see include/icon_atlas.h. The generator in
+# tool/ is built for the build machine first. With FLASH_IN_PROJECT the
+# image is written by idf.py flash, it can always be written alone with
+# idf.py <partition>-flash.
+function(icon_atlas_create_partition_image partition icon_dir)
+    set(options FLASH_IN_PROJECT)
+    cmake_parse_arguments(arg "${options}" "" "" "${ARGN}")
+
+    idf_build_get_property(build_dir BUILD_DIR)
+    idf_component_get_property(component_dir icon_atlas COMPONENT_DIR)
+    get_filename_component(icon_dir ${icon_dir} ABSOLUTE)
+
+    partition_table_get_partition_info(size "--partition-name ${partition}" "size")
+    partition_table_get_partition_info(offset "--partition-name ${partition}" "offset")
+    if(NOT ("${size}" AND "${offset}"))
+        message(FATAL_ERROR "${partition} failed to create icon atlas: "
+                "partition table does not contain a '${partition}' partition")
+    endif()
+
+    # built with the compiler of the build machine, not the target toolchain
+    set(gen_dir ${build_dir}/icon_atlas_gen)
+    set(gen ${gen_dir}/icon_atlas_gen)
+    include(ExternalProject)
+    externalproject_add(icon_atlas_gen
+        SOURCE_DIR ${component_dir}/tool
+        BINARY_DIR ${gen_dir}
+        CMAKE_ARGS -DCMAKE_BUILD_TYPE=Release
+        INSTALL_COMMAND ""
+        BUILD_BYPRODUCTS ${gen})
+
+    file(GLOB icons ${icon_dir}/*.jpg)
+    set(image_file ${build_dir}/${partition}.bin)
+    add_custom_command(OUTPUT ${image_file}
+        COMMAND ${gen} -s ${size} -o ${image_file} ${icons}
+        DEPENDS ${icons} icon_atlas_gen
+        COMMENT "Generating icon atlas ${partition}.bin")
+    add_custom_target(${partition}_bin ALL DEPENDS ${image_file})
+
+    set_property(DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" APPEND PROPERTY
+        ADDITIONAL_MAKE_CLEAN_FILES ${image_file})
+
+    idf_component_get_property(main_args esptool_py FLASH_ARGS)
+    idf_component_get_property(sub_args esptool_py FLASH_SUB_ARGS)
+    esptool_py_flash_target(${partition}-flash "${main_args}" "${sub_args}")
+    esptool_py_flash_target_image(${partition}-flash "${partition}" "${offset}" "${image_file}")
+    add_dependencies(${partition}-flash ${partition}_bin)
+
+    if(arg_FLASH_IN_PROJECT)
+        esptool_py_flash_target_image(flash "${partition}" "${offset}" "${image_file}")
+        add_dependencies(flash ${partition}_bin)
+    endif()
+endfunction()
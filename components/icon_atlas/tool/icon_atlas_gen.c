@@ -0,0 +1,178 @@
+/* Build the icon atlas partition image from JPEG files
+
+   Runs on the build machine, see project_include.cmake. The icons are
+   decoded with the IJG sources of the firmware, with the settings of
+   mjpegdraw(), so they look the same as when they were decoded on the
+   board.
+
+   usage: icon_atlas_gen -o atlas.bin [-s max_bytes] icon.jpg...
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <libgen.h>
+#include "jpeglib.h"
+#include "icon_atlas_format.h"
+#include "icon_atlas_rle.h"
+
+#define ALIGN4(n) (((n) + 3) & ~3u)
+
+typedef struct {
+    icon_atlas_entry_t entry;
+    uint16_t *rle;
+    size_t words;
+} icon_t;
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    rewind(f);
+    uint8_t *data = malloc(*size);
+    if (data && fread(data, 1, *size, f) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+/* RGB565 pixels of a JPEG file, decoded like mjpegdraw() does */
+static uint16_t *decode(const char *path, uint16_t *width, uint16_t *height)
+{
+    size_t size;
+    uint8_t *jpeg = read_file(path, &size);
+    if (!jpeg) {
+        return NULL;
+    }
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpeg, size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.dct_method = JDCT_IFAST;
+    cinfo.do_fancy_upsampling = 0;
+    cinfo.out_color_space = JCS_RGB565;
+    jpeg_start_decompress(&cinfo);
+
+    *width = cinfo.output_width;
+    *height = cinfo.output_height;
+    uint16_t *pixels = malloc((size_t)*width * *height * sizeof(uint16_t));
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW p = (JSAMPROW) &pixels[cinfo.output_scanline * *width];
+        jpeg_read_scanlines(&cinfo, &p, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    free(jpeg);
+    return pixels;
+}
+
+static int icon_compare(const void *a, const void *b)
+{
+    return strcmp(((const icon_t *)a)->entry.name, ((const icon_t *)b)->entry.name);
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_path = NULL;
+    long max_size = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "o:s:")) != -1) {
+        switch (opt) {
+        case 'o':
+            out_path = optarg;
+            break;
+        case 's':
+            max_size = strtol(optarg, NULL, 0);
+            break;
+        default:
+            out_path = NULL;
+            optind = argc;
+            break;
+        }
+    }
+    int count = argc - optind;
+    if (!out_path || count <= 0 || count > UINT16_MAX) {
+        fprintf(stderr, "usage: %s -o atlas.bin [-s max_bytes] icon.jpg...\n", argv[0]);
+        return 2;
+    }
+
+    icon_t *icons = calloc(count, sizeof(icon_t));
+    size_t raw_bytes = 0;
+    for (int i = 0; i < count; i++) {
+        const char *path = argv[optind + i];
+        char *copy = strdup(path);
+        const char *name = basename(copy);
+        if (strlen(name) >= ICON_ATLAS_NAME_LEN) {
+            fprintf(stderr, "%s: name longer than %d bytes\n", path, ICON_ATLAS_NAME_LEN - 1);
+            return 1;
+        }
+        strcpy(icons[i].entry.name, name);
+        free(copy);
+
+        uint16_t w, h;
+        uint16_t *pixels = decode(path, &w, &h);
+        if (!pixels) {
+            return 1;
+        }
+        size_t n = (size_t)w * h;
+        icons[i].entry.width = w;
+        icons[i].entry.height = h;
+        icons[i].rle = malloc(ICON_ATLAS_RLE_MAX_WORDS(n) * sizeof(uint16_t));
+        icons[i].words = icon_atlas_rle_encode(pixels, n, icons[i].rle);
+        raw_bytes += n * sizeof(uint16_t);
+        free(pixels);
+    }
+    qsort(icons, count, sizeof(icon_t), icon_compare);
+
+    uint32_t offset = ALIGN4(sizeof(icon_atlas_header_t) + count * sizeof(icon_atlas_entry_t));
+    for (int i = 0; i < count; i++) {
+        icons[i].entry.offset = offset;
+        icons[i].entry.length = icons[i].words * sizeof(uint16_t);
+        offset = ALIGN4(offset + icons[i].entry.length);
+    }
+    icon_atlas_header_t header = {
+        .magic = ICON_ATLAS_MAGIC,
+        .version = ICON_ATLAS_VERSION,
+        .count = count,
+        .size = offset,
+    };
+    if (max_size && header.size > max_size) {
+        fprintf(stderr, "atlas of %u bytes does not fit the partition of %ld bytes\n", header.size, max_size);
+        return 1;
+    }
+
+    FILE *out = fopen(out_path, "wb");
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+    const uint8_t pad[4] = {0};
+    fwrite(&header, sizeof(header), 1, out);
+    for (int i = 0; i < count; i++) {
+        fwrite(&icons[i].entry, sizeof(icon_atlas_entry_t), 1, out);
+    }
+    long pos = sizeof(header) + count * sizeof(icon_atlas_entry_t);
+    fwrite(pad, 1, ALIGN4(pos) - pos, out);
+    for (int i = 0; i < count; i++) {
+        fwrite(icons[i].rle, sizeof(uint16_t), icons[i].words, out);
+        fwrite(pad, 1, ALIGN4(icons[i].entry.length) - icons[i].entry.length, out);
+        free(icons[i].rle);
+    }
+    if (fclose(out)) {
+        perror(out_path);
+        return 1;
+    }
+    printf("%s: %d icons, %u bytes, %zu bytes as RGB565\n", out_path, count, header.size, raw_bytes);
+    free(icons);
+    return 0;
+}
@@ -0,0 +1,41 @@
+/* Run-length encoding of RGB565 images, see icon_atlas_rle.h */
+
+#include <string.h>
+#include "icon_atlas_rle.h"
+
+#define RLE_COUNT_MAX 0x7FFF
+#define RLE_REPEAT 0x8000
+#define RLE_RUN_MIN 3           /* shorter runs cost more as a repeat than as literals */
+
+static size_t run_length(const uint16_t *pixels, size_t n)
+{
+    size_t run = 1;
+    while (run < n && run < RLE_COUNT_MAX && pixels[run] == pixels[0]) {
+        run++;
+    }
+    return run;
+}
+
+size_t icon_atlas_rle_encode(const uint16_t *pixels, size_t n, uint16_t *out)
+{
+    size_t words = 0;
+    size_t i = 0;
+    while (i < n) {
+        size_t run = run_length(&pixels[i], n - i);
+        if (run >= RLE_RUN_MIN) {
+            out[words++] = RLE_REPEAT | run;
+            out[words++] = pixels[i];
+            i += run;
+            continue;
+        }
+        /* literals up to the next run worth repeating */
+        size_t start = i;
+        while (i < n && i - start < RLE_COUNT_MAX && run_length(&pixels[i], n - i < RLE_RUN_MIN ? n - i : RLE_RUN_MIN) < RLE_RUN_MIN) {
+            i++;
+        }
+        out[words++] = i - start;
+        memcpy(&out[words], &pixels[start], (i - start) * sizeof(uint16_t));
+        words += i - start;
+    }
+    return words;
+}
@@ -0,0 +1,14 @@
+/* Run-length encoding of RGB565 images for painter_draw_image_rle()
+
+   Shared by the atlas generator and the host test of the painter.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Words icon_atlas_rle_encode() writes at most for n pixels */
+#define ICON_ATLAS_RLE_MAX_WORDS(n) ((n) + (n) / 0x7FFF + 1)
+
+/* Encode n pixels into out, returns the words written */
+size_t icon_atlas_rle_encode(const uint16_t *pixels, size_t n, uint16_t *out);
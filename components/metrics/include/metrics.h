@@ -0,0 +1,167 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _METRICS_H_
+#define _METRICS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Lightweight counters and histograms exported in Prometheus text format.
+ *
+ * Metrics are static objects defined with METRICS_COUNTER_DEFINE or
+ * METRICS_HISTOGRAM_DEFINE next to the code they measure. They link
+ * themselves into the registry on first update, updates are plain 32-bit
+ * atomic adds, so they can be used from any task without taking a lock.
+ * Series sharing a name (with different labels) are exported as one family.
+ */
+
+typedef enum {
+    METRICS_COUNTER = 0,
+    METRICS_HISTOGRAM,
+} metrics_type_t;
+
+/**
+ * 64-bit total kept as two 32-bit words, the carry is propagated after the
+ * low word wrapped, so updates stay lock-free on 32-bit cores.
+ */
+typedef struct {
+    volatile uint32_t lo;
+    volatile uint32_t hi;
+} metrics_u64_t;
+
+typedef struct metrics {
+    metrics_type_t type;
+    const char *name;          /*!< metric name, e.g. "http_request_duration_seconds" */
+    const char *help;          /*!< HELP text, taken from the first series of a family */
+    const char *labels;        /*!< label set without braces, e.g. "handler=\"download\"", or NULL */
+    const uint32_t *bounds;    /*!< histogram upper bounds in microseconds, ascending */
+    uint32_t n_bounds;         /*!< number of bounds, there is one extra +Inf bucket */
+    volatile uint32_t *buckets;/*!< n_bounds + 1 non-cumulative bucket counts */
+    metrics_u64_t value;       /*!< counter value, or histogram sum in microseconds */
+    volatile uint32_t linked;  /*!< set once the metric is in the registry */
+    struct metrics *next;
+} metrics_t;
+
+/* Default latency buckets, 100us .. 1s */
+#define METRICS_LATENCY_BOUNDS_US 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+
+#define METRICS_COUNTER_DEFINE(var, _name, _help, _labels) \
+    static metrics_t var = { \
+        .type = METRICS_COUNTER, .name = _name, .help = _help, .labels = _labels, \
+    }
+
+#define METRICS_HISTOGRAM_DEFINE(var, _name, _help, _labels, ...) \
+    static const uint32_t var##_bounds[] = { __VA_ARGS__ }; \
+    static volatile uint32_t var##_buckets[sizeof(var##_bounds) / sizeof(uint32_t) + 1]; \
+    static metrics_t var = { \
+        .type = METRICS_HISTOGRAM, .name = _name, .help = _help, .labels = _labels, \
+        .bounds = var##_bounds, .n_bounds = sizeof(var##_bounds) / sizeof(uint32_t), \
+        .buckets = var##_buckets, \
+    }
+
+/**
+ * @brief Link a metric into the registry, normally done implicitly by the first update.
+ *        Safe to call concurrently and more than once.
+ *
+ * @param m metric defined with one of the DEFINE macros
+ */
+void metrics_register(metrics_t *m);
+
+static inline void metrics_u64_add(metrics_u64_t *v, uint32_t n)
+{
+    uint32_t old = __atomic_fetch_add(&v->lo, n, __ATOMIC_RELAXED);
+    if (old + n < old) {
+        __atomic_fetch_add(&v->hi, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Read a 64-bit total consistently with concurrent updates
+ */
+uint64_t metrics_u64_get(const metrics_u64_t *v);
+
+/**
+ * @brief Add n to a counter
+ */
+static inline void metrics_counter_add(metrics_t *m, uint32_t n)
+{
+    if (!m->linked) {
+        metrics_register(m);
+    }
+    metrics_u64_add(&m->value, n);
+}
+
+static inline void metrics_counter_inc(metrics_t *m)
+{
+    metrics_counter_add(m, 1);
+}
+
+/**
+ * @brief Record one histogram sample
+ *
+ * @param m histogram
+ * @param us observed value in microseconds
+ */
+static inline void metrics_histogram_observe(metrics_t *m, uint32_t us)
+{
+    if (!m->linked) {
+        metrics_register(m);
+    }
+    uint32_t i = 0;
+    while (i < m->n_bounds && us > m->bounds[i]) {
+        i++;
+    }
+    __atomic_fetch_add(&m->buckets[i], 1, __ATOMIC_RELAXED);
+    metrics_u64_add(&m->value, us);
+}
+
+/**
+ * @brief Record the time elapsed since start, start is taken from esp_timer_get_time()
+ */
+static inline void metrics_histogram_observe_since(metrics_t *m, int64_t start)
+{
+    metrics_histogram_observe(m, (uint32_t)(esp_timer_get_time() - start));
+}
+
+/**
+ * @brief Output callback of metrics_render, called with pieces of the exposition text
+ */
+typedef esp_err_t (*metrics_write_t)(void *ctx, const char *data, size_t len);
+
+/**
+ * @brief Render all registered metrics, heap usage per capability and FreeRTOS
+ *        task statistics in Prometheus text exposition format (version 0.0.4).
+ *
+ * @param write output callback, rendering stops at its first error
+ * @param ctx user context passed to write
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG write is NULL
+ *     - Others error returned by write
+ */
+esp_err_t metrics_render(metrics_write_t write, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
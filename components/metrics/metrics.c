@@ -0,0 +1,342 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "metrics.h"
+
+static const char *TAG = "metrics";
+
+#define METRICS_CHECK(a, str, ret) if(!(a)) { \
+        ESP_LOGE(TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str); \
+        return (ret); \
+    }
+
+/* Longest line is a histogram bucket with its labels */
+#define METRICS_LINE_MAX 192
+
+static metrics_t *s_head = NULL;
+
+typedef struct {
+    char buf[METRICS_LINE_MAX];
+    size_t len;
+    metrics_write_t write;
+    void *ctx;
+} metrics_out_t;
+
+void metrics_register(metrics_t *m)
+{
+    if (__atomic_exchange_n(&m->linked, 1, __ATOMIC_ACQ_REL)) {
+        return;
+    }
+    metrics_t *head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+    do {
+        m->next = head;
+    } while (!__atomic_compare_exchange_n(&s_head, &head, m, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+uint64_t metrics_u64_get(const metrics_u64_t *v)
+{
+    uint32_t hi, lo;
+    do {
+        hi = v->hi;
+        lo = v->lo;
+    } while (hi != v->hi);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/* Formatting is done by hand, snprintf costs several microseconds per call
+ * and a full scrape produces a few hundred numbers */
+static void out_str(metrics_out_t *out, const char *s)
+{
+    while (*s && out->len < METRICS_LINE_MAX) {
+        out->buf[out->len++] = *s++;
+    }
+}
+
+static void out_u64(metrics_out_t *out, uint64_t v)
+{
+    char tmp[20];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + (v % 10);
+        v /= 10;
+    } while (v);
+    while (n && out->len < METRICS_LINE_MAX) {
+        out->buf[out->len++] = tmp[--n];
+    }
+}
+
+/* microseconds as decimal seconds */
+static void out_seconds(metrics_out_t *out, uint64_t us)
+{
+    out_u64(out, us / 1000000);
+    out_str(out, ".");
+    uint32_t frac = us % 1000000;
+    for (uint32_t div = 100000; div && out->len < METRICS_LINE_MAX; div /= 10) {
+        out->buf[out->len++] = '0' + (frac / div) % 10;
+    }
+}
+
+static esp_err_t out_flush(metrics_out_t *out)
+{
+    esp_err_t ret = ESP_OK;
+    if (out->len) {
+        ret = out->write(out->ctx, out->buf, out->len);
+    }
+    out->len = 0;
+    return ret;
+}
+
+static esp_err_t out_header(metrics_out_t *out, const char *name, const char *help, const char *type)
+{
+    out_str(out, "# HELP ");
+    out_str(out, name);
+    out_str(out, " ");
+    out_str(out, help ? help : name);
+    out_str(out, "\n");
+    esp_err_t ret = out_flush(out);
+    out_str(out, "# TYPE ");
+    out_str(out, name);
+    out_str(out, " ");
+    out_str(out, type);
+    out_str(out, "\n");
+    return ret == ESP_OK ? out_flush(out) : ret;
+}
+
+/* name{labels} followed by the separator before the value */
+static void out_series(metrics_out_t *out, const char *name, const char *suffix, const char *labels)
+{
+    out_str(out, name);
+    if (suffix) {
+        out_str(out, suffix);
+    }
+    if (labels) {
+        out_str(out, "{");
+        out_str(out, labels);
+        out_str(out, "}");
+    }
+    out_str(out, " ");
+}
+
+static esp_err_t render_histogram(metrics_out_t *out, const metrics_t *m)
+{
+    esp_err_t ret = ESP_OK;
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i <= m->n_bounds && ret == ESP_OK; i++) {
+        cumulative += m->buckets[i];
+        out_str(out, m->name);
+        out_str(out, "_bucket{");
+        if (m->labels) {
+            out_str(out, m->labels);
+            out_str(out, ",");
+        }
+        out_str(out, "le=\"");
+        if (i < m->n_bounds) {
+            out_seconds(out, m->bounds[i]);
+        } else {
+            out_str(out, "+Inf");
+        }
+        out_str(out, "\"} ");
+        out_u64(out, cumulative);
+        out_str(out, "\n");
+        ret = out_flush(out);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    out_series(out, m->name, "_sum", m->labels);
+    out_seconds(out, metrics_u64_get(&m->value));
+    out_str(out, "\n");
+    ret = out_flush(out);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    out_series(out, m->name, "_count", m->labels);
+    out_u64(out, cumulative);
+    out_str(out, "\n");
+    return out_flush(out);
+}
+
+static esp_err_t render_registry(metrics_out_t *out)
+{
+    metrics_t *head = __atomic_load_n(&s_head, __ATOMIC_ACQUIRE);
+    for (metrics_t *m = head; m; m = m->next) {
+        /* a family is printed when its first series is reached */
+        bool done = false;
+        for (metrics_t *p = head; p != m; p = p->next) {
+            if (!strcmp(p->name, m->name)) {
+                done = true;
+                break;
+            }
+        }
+        if (done) {
+            continue;
+        }
+
+        esp_err_t ret = out_header(out, m->name, m->help, m->type == METRICS_HISTOGRAM ? "histogram" : "counter");
+        for (metrics_t *s = m; s && ret == ESP_OK; s = s->next) {
+            if (strcmp(s->name, m->name)) {
+                continue;
+            }
+            if (s->type == METRICS_HISTOGRAM) {
+                ret = render_histogram(out, s);
+            } else {
+                out_series(out, s->name, NULL, s->labels);
+                out_u64(out, metrics_u64_get(&s->value));
+                out_str(out, "\n");
+                ret = out_flush(out);
+            }
+        }
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t render_gauge(metrics_out_t *out, const char *name, const char *labels, uint64_t value)
+{
+    out_series(out, name, NULL, labels);
+    out_u64(out, value);
+    out_str(out, "\n");
+    return out_flush(out);
+}
+
+static esp_err_t render_heap(metrics_out_t *out)
+{
+    static const struct {
+        uint32_t caps;
+        const char *label;
+    } heaps[] = {
+        { MALLOC_CAP_INTERNAL, "caps=\"internal\"" },
+        { MALLOC_CAP_DMA, "caps=\"dma\"" },
+        { MALLOC_CAP_SPIRAM, "caps=\"psram\"" },
+    };
+    static const char *names[] = {
+        "heap_free_bytes", "heap_min_free_bytes", "heap_largest_free_block_bytes",
+    };
+    static const char *helps[] = {
+        "Free heap per capability",
+        "Lowest free heap per capability since boot",
+        "Largest allocatable block per capability",
+    };
+
+    for (int n = 0; n < sizeof(names) / sizeof(names[0]); n++) {
+        esp_err_t ret = out_header(out, names[n], helps[n], "gauge");
+        for (int i = 0; i < sizeof(heaps) / sizeof(heaps[0]) && ret == ESP_OK; i++) {
+            if (heap_caps_get_total_size(heaps[i].caps) == 0) {
+                continue;
+            }
+            size_t value = n == 0 ? heap_caps_get_free_size(heaps[i].caps) :
+                           n == 1 ? heap_caps_get_minimum_free_size(heaps[i].caps) :
+                           heap_caps_get_largest_free_block(heaps[i].caps);
+            ret = render_gauge(out, names[n], heaps[i].label, value);
+        }
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+static void out_label_value(metrics_out_t *out, const char *s)
+{
+    for (; *s && out->len + 2 < METRICS_LINE_MAX; s++) {
+        if (*s == '"' || *s == '\\') {
+            out->buf[out->len++] = '\\';
+        }
+        out->buf[out->len++] = *s;
+    }
+}
+
+#endif
+
+static esp_err_t render_tasks(metrics_out_t *out)
+{
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    UBaseType_t count = uxTaskGetNumberOfTasks() + 2;
+    TaskStatus_t *tasks = malloc(count * sizeof(TaskStatus_t));
+    METRICS_CHECK(NULL != tasks, "no memory for task list", ESP_ERR_NO_MEM);
+    count = uxTaskGetSystemState(tasks, count, NULL);
+
+    esp_err_t ret = out_header(out, "freertos_tasks", "Number of FreeRTOS tasks", "gauge");
+    if (ret == ESP_OK) {
+        ret = render_gauge(out, "freertos_tasks", NULL, count);
+    }
+    if (ret == ESP_OK) {
+        ret = out_header(out, "freertos_task_stack_free_min_bytes", "Stack high water mark per task", "gauge");
+    }
+    for (UBaseType_t i = 0; i < count && ret == ESP_OK; i++) {
+        out_str(out, "freertos_task_stack_free_min_bytes{task=\"");
+        out_label_value(out, tasks[i].pcTaskName);
+        out_str(out, "\"} ");
+        out_u64(out, tasks[i].usStackHighWaterMark);
+        out_str(out, "\n");
+        ret = out_flush(out);
+    }
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    /* the run time counter is 32 bit and wraps, scrapers treat it as a counter reset */
+    if (ret == ESP_OK) {
+        ret = out_header(out, "freertos_task_runtime_seconds_total", "CPU time used per task", "counter");
+    }
+    for (UBaseType_t i = 0; i < count && ret == ESP_OK; i++) {
+        out_str(out, "freertos_task_runtime_seconds_total{task=\"");
+        out_label_value(out, tasks[i].pcTaskName);
+        out_str(out, "\"} ");
+        out_seconds(out, tasks[i].ulRunTimeCounter);
+        out_str(out, "\n");
+        ret = out_flush(out);
+    }
+#endif
+    free(tasks);
+    return ret;
+#else
+    return ESP_OK;
+#endif
+}
+
+esp_err_t metrics_render(metrics_write_t write, void *ctx)
+{
+    METRICS_CHECK(NULL != write, "write callback is NULL", ESP_ERR_INVALID_ARG);
+    metrics_out_t out = {
+        .len = 0,
+        .write = write,
+        .ctx = ctx,
+    };
+
+    esp_err_t ret = out_header(&out, "uptime_seconds", "Time since boot", "gauge");
+    if (ret == ESP_OK) {
+        out_series(&out, "uptime_seconds", NULL, NULL);
+        out_seconds(&out, esp_timer_get_time());
+        out_str(&out, "\n");
+        ret = out_flush(&out);
+    }
+    if (ret == ESP_OK) {
+        ret = render_registry(&out);
+    }
+    if (ret == ESP_OK) {
+        ret = render_heap(&out);
+    }
+    if (ret == ESP_OK) {
+        ret = render_tasks(&out);
+    }
+    return ret;
+}
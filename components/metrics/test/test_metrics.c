@@ -0,0 +1,85 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "test_utils.h"
+#include "esp_timer.h"
+#include "metrics.h"
+
+METRICS_COUNTER_DEFINE(s_test_bytes_a, "test_bytes_total", "Bytes moved by the test", "dir=\"a\"");
+METRICS_COUNTER_DEFINE(s_test_bytes_b, "test_bytes_total", "Bytes moved by the test", "dir=\"b\"");
+METRICS_HISTOGRAM_DEFINE(s_test_latency, "test_duration_seconds", "Test latency", NULL, 1000, 10000);
+
+static char s_text[8192];
+static size_t s_text_len;
+
+static esp_err_t test_write(void *ctx, const char *data, size_t len)
+{
+    TEST_ASSERT(s_text_len + len < sizeof(s_text));
+    memcpy(s_text + s_text_len, data, len);
+    s_text_len += len;
+    s_text[s_text_len] = '\0';
+    return ESP_OK;
+}
+
+static void render(void)
+{
+    s_text_len = 0;
+    TEST_ASSERT(ESP_OK == metrics_render(test_write, NULL));
+}
+
+TEST_CASE("metrics counter and histogram exposition", "[metrics]")
+{
+    metrics_counter_add(&s_test_bytes_a, 100);
+    metrics_counter_add(&s_test_bytes_b, 7);
+    metrics_histogram_observe(&s_test_latency, 500);
+    metrics_histogram_observe(&s_test_latency, 5000);
+    metrics_histogram_observe(&s_test_latency, 2000000);
+    render();
+
+    /* one family header for both counter series */
+    char *first = strstr(s_text, "# TYPE test_bytes_total counter\n");
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NULL(strstr(first + 1, "# TYPE test_bytes_total counter\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_bytes_total{dir=\"a\"} 100\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_bytes_total{dir=\"b\"} 7\n"));
+
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "# TYPE test_duration_seconds histogram\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_duration_seconds_bucket{le=\"0.001000\"} 1\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_duration_seconds_bucket{le=\"0.010000\"} 2\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_duration_seconds_bucket{le=\"+Inf\"} 3\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_duration_seconds_sum 2.005500\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "test_duration_seconds_count 3\n"));
+    TEST_ASSERT_NOT_NULL(strstr(s_text, "heap_free_bytes{caps=\"internal\"} "));
+}
+
+TEST_CASE("metrics 64-bit totals carry over 32-bit wrap", "[metrics]")
+{
+    metrics_u64_t v = { .lo = 0xFFFFFFF0, .hi = 0 };
+    metrics_u64_add(&v, 0x20);
+    TEST_ASSERT_EQUAL_UINT32(0x10, v.lo);
+    TEST_ASSERT_EQUAL_UINT32(1, v.hi);
+    TEST_ASSERT(metrics_u64_get(&v) == 0x100000010ULL);
+}
+
+TEST_CASE("metrics render cost", "[metrics]")
+{
+    render();
+    int64_t start = esp_timer_get_time();
+    render();
+    int64_t cost = esp_timer_get_time() - start;
+    printf("render %u bytes in %d us\n", (unsigned)s_text_len, (int)cost);
+    TEST_ASSERT_LESS_THAN(1000, cost);
+}
@@ -41,6 +41,16 @@ typedef struct {
  */
 esp_err_t tusb_msc_init(const tinyusb_config_msc_t *cfg);
 
+/**
+ * @brief Bytes transferred over USB MSC since boot
+ *
+ * The host reads and writes of all disks, for throughput displays.
+ *
+ * @param read_bytes Bytes read by the host, may be NULL
+ * @param write_bytes Bytes written by the host, may be NULL
+ */
+void tusb_msc_get_transferred(uint64_t *read_bytes, uint64_t *write_bytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,8 @@
 #include "diskio.h"
 #include "tusb_msc.h"
 #include "esp_attr.h"
+#include "esp_timer.h"
+#include "metrics.h"
 
 #define LOGICAL_DISK_NUM 1
 
@@ -28,6 +30,14 @@ static tusb_msc_callback_t cb_unmount[LOGICAL_DISK_NUM] = {NULL};
 static int s_disk_block_size[LOGICAL_DISK_NUM] = {0};
 static bool s_ejected[LOGICAL_DISK_NUM] = {true};
 
+METRICS_COUNTER_DEFINE(s_msc_read_cmds, "msc_commands_total", "SCSI commands received over USB MSC", "cmd=\"read10\"");
+METRICS_COUNTER_DEFINE(s_msc_write_cmds, "msc_commands_total", NULL, "cmd=\"write10\"");
+METRICS_COUNTER_DEFINE(s_msc_other_cmds, "msc_commands_total", NULL, "cmd=\"other\"");
+METRICS_COUNTER_DEFINE(s_msc_read_bytes, "msc_bytes_total", "Bytes transferred over USB MSC", "dir=\"read\"");
+METRICS_COUNTER_DEFINE(s_msc_write_bytes, "msc_bytes_total", NULL, "dir=\"write\"");
+METRICS_HISTOGRAM_DEFINE(s_sd_read_time, "sd_io_duration_seconds", "Storage access latency", "op=\"read\",source=\"msc\"", METRICS_LATENCY_BOUNDS_US);
+METRICS_HISTOGRAM_DEFINE(s_sd_write_time, "sd_io_duration_seconds", NULL, "op=\"write\",source=\"msc\"", METRICS_LATENCY_BOUNDS_US);
+
 esp_err_t tusb_msc_init(const tinyusb_config_msc_t *cfg)
 {
     if (cfg == NULL) {
@@ -41,6 +51,16 @@ esp_err_t tusb_msc_init(const tinyusb_config_msc_t *cfg)
     return ESP_OK;
 }
 
+void tusb_msc_get_transferred(uint64_t *read_bytes, uint64_t *write_bytes)
+{
+    if (read_bytes) {
+        *read_bytes = metrics_u64_get(&s_msc_read_bytes.value);
+    }
+    if (write_bytes) {
+        *write_bytes = metrics_u64_get(&s_msc_write_bytes.value);
+    }
+}
+
 //--------------------------------------------------------------------+
 // tinyusb callbacks
 //--------------------------------------------------------------------+
@@ -241,7 +261,11 @@ IRAM_ATTR int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset,
     }
 
     const uint32_t block_count = bufsize / s_disk_block_size[lun];
+    int64_t start = esp_timer_get_time();
     disk_read(s_pdrv[lun], buffer, lba, block_count);
+    metrics_histogram_observe_since(&s_sd_read_time, start);
+    metrics_counter_inc(&s_msc_read_cmds);
+    metrics_counter_add(&s_msc_read_bytes, block_count * s_disk_block_size[lun]);
     return block_count * s_disk_block_size[lun];
 }
 
@@ -258,7 +282,11 @@ IRAM_ATTR int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset,
     }
 
     const uint32_t block_count = bufsize / s_disk_block_size[lun];
+    int64_t start = esp_timer_get_time();
     disk_write(s_pdrv[lun], buffer, lba, block_count);
+    metrics_histogram_observe_since(&s_sd_write_time, start);
+    metrics_counter_inc(&s_msc_write_cmds);
+    metrics_counter_add(&s_msc_write_bytes, block_count * s_disk_block_size[lun]);
     return block_count * s_disk_block_size[lun];
 }
 
@@ -277,6 +305,7 @@ int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer, u
 
     void const *response = NULL;
     uint16_t resplen = 0;
+    metrics_counter_inc(&s_msc_other_cmds);
 
     // most scsi handled is input
     bool in_xfer = true;
@@ -0,0 +1,115 @@
+/* Host benchmark of the colour conversion kernels
+
+   color_convert_bench            time reference and optimised kernels
+   color_convert_bench --check    compare both, exit status 1 on a mismatch
+
+   Every flag combination converts a 240x240 frame, the size of the LCD,
+   row by row like the JPEG decoder does.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "color_convert.h"
+
+#define FRAME_W 240
+#define FRAME_H 240
+#define BENCH_FRAMES 200
+
+typedef void (*convert_fn_t)(const uint8_t *src, uint16_t *dst, size_t pixels, uint32_t row, uint32_t flags);
+
+typedef struct {
+    const char *name;
+    convert_fn_t fast;
+    convert_fn_t ref;
+} bench_kernel_t;
+
+static const bench_kernel_t s_kernels[] = {
+    {"rgb888", color_convert_rgb888_to_rgb565, color_convert_rgb888_to_rgb565_ref},
+    {"ycbcr",  color_convert_ycbcr_to_rgb565,  color_convert_ycbcr_to_rgb565_ref},
+};
+
+/* word aligned like the decoder's sample rows, +4 for the offset runs */
+static uint32_t s_src[(FRAME_W * FRAME_H * 3 + 4) / 4 + 1];
+static uint16_t s_ref[FRAME_W * FRAME_H + 2];
+static uint16_t s_out[FRAME_W * FRAME_H + 2];
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void convert_frame(convert_fn_t fn, const uint8_t *src, uint16_t *dst, uint32_t flags)
+{
+    for (uint32_t row = 0; row < FRAME_H; row++) {
+        fn(src + row * FRAME_W * 3, dst + row * FRAME_W, FRAME_W, row, flags);
+    }
+}
+
+static double time_frame(convert_fn_t fn, uint32_t flags)
+{
+    double start = now_us();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        convert_frame(fn, (const uint8_t *)s_src, s_out, flags);
+    }
+    return (now_us() - start) / BENCH_FRAMES;
+}
+
+/* Every length up to 64 at every source and destination alignment,
+ * then a full frame. Guard pixels behind the row must stay untouched. */
+static int check_kernel(const bench_kernel_t *k, uint32_t flags)
+{
+    const uint8_t *src = (const uint8_t *)s_src;
+    for (int offset = 0; offset < 4; offset++) {
+        for (size_t n = 0; n <= 64; n++) {
+            for (uint32_t row = 0; row < 4; row++) {
+                memset(s_ref, 0x55, (n + 2) * 2);
+                memset(s_out, 0x55, (n + 2) * 2);
+                k->ref(src + offset, s_ref + (offset & 1), n, row, flags);
+                k->fast(src + offset, s_out + (offset & 1), n, row, flags);
+                if (memcmp(s_ref, s_out, (n + 2) * 2)) {
+                    printf("%s flags=%u: mismatch, offset %d length %zu row %u\n", k->name, flags, offset, n, row);
+                    return 1;
+                }
+            }
+        }
+    }
+    convert_frame(k->ref, src, s_ref, flags);
+    convert_frame(k->fast, src, s_out, flags);
+    if (memcmp(s_ref, s_out, FRAME_W * FRAME_H * 2)) {
+        printf("%s flags=%u: frame mismatch\n", k->name, flags);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int check = argc > 1 && !strcmp(argv[1], "--check");
+    uint8_t *src = (uint8_t *)s_src;
+    srand(1);
+    for (size_t i = 0; i < sizeof(s_src); i++) {
+        src[i] = rand();
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(s_kernels) / sizeof(s_kernels[0]); i++) {
+        for (uint32_t flags = 0; flags <= (COLOR_CONVERT_SWAP | COLOR_CONVERT_DITHER); flags++) {
+            if (check) {
+                failed |= check_kernel(&s_kernels[i], flags);
+                continue;
+            }
+            double ref = time_frame(s_kernels[i].ref, flags);
+            double fast = time_frame(s_kernels[i].fast, flags);
+            printf("%-7s swap=%d dither=%d  ref %8.1f us  fast %8.1f us  %5.2fx\n", s_kernels[i].name,
+                   !!(flags & COLOR_CONVERT_SWAP), !!(flags & COLOR_CONVERT_DITHER), ref, fast, ref / fast);
+        }
+    }
+    if (check) {
+        printf("%s\n", failed ? "FAILED" : "OK");
+    }
+    return failed;
+}
@@ -0,0 +1,12 @@
+/* Files the firmware embeds with EMBED_FILES, under the same symbol names */
+
+#define EMBED_FILE(sym, path) \
+    __asm__(".section .rodata\n" \
+            ".global " #sym "_start\n" #sym "_start:\n" \
+            ".incbin \"" path "\"\n" \
+            ".global " #sym "_end\n" #sym "_end:\n" \
+            ".byte 0\n" \
+            ".previous\n")
+
+EMBED_FILE(_binary_upload_script_html, EMBED_DIR "/upload_script.html");
+EMBED_FILE(_binary_favicon_ico, EMBED_DIR "/favicon.ico");
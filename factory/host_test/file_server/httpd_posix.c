@@ -0,0 +1,822 @@
+/* esp_http_server on POSIX sockets
+
+   Implements the part of the esp_http_server API used by the file server
+   with the same execution model as ESP-IDF: one server thread multiplexes
+   all sessions with select() and runs URI handlers to completion, so
+   handler latency and head-of-line blocking behave like on the target.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/param.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_http_server.h"
+
+#define HTTPD_RX_BUFSIZE (HTTPD_MAX_URI_LEN + HTTPD_MAX_REQ_HDR_LEN)
+#define HTTPD_MAX_RESP_HEADERS 16
+
+static const char *TAG = "httpd_posix";
+
+uint16_t httpd_host_port = 8080;
+
+typedef struct {
+    int fd;
+    void *ctx;
+    httpd_free_ctx_fn_t free_ctx;
+    bool close_pending;
+    uint64_t lru;
+    /* request header, then any body bytes received along with it */
+    char rx[HTTPD_RX_BUFSIZE];
+    size_t rx_len;
+} httpd_sess_t;
+
+typedef struct httpd_work {
+    httpd_work_fn_t fn;
+    void *arg;
+    struct httpd_work *next;
+} httpd_work_t;
+
+typedef struct {
+    httpd_config_t config;
+    int listen_fd;
+    int ctrl_fd[2];
+    pthread_t thread;
+    volatile bool stop;
+    httpd_uri_t *uris;
+    size_t uri_count;
+    httpd_err_handler_func_t err_handlers[HTTPD_ERR_CODE_MAX];
+    httpd_sess_t **sessions;
+    uint64_t lru_counter;
+    pthread_mutex_t work_lock;
+    httpd_work_t *work_head;
+    httpd_work_t *work_tail;
+} httpd_data_t;
+
+typedef struct {
+    httpd_sess_t *sess;
+    char hdr[HTTPD_MAX_REQ_HDR_LEN + 1];
+    size_t remaining;
+    bool keep_alive;
+    bool resp_started;
+    const char *status;
+    const char *type;
+    struct {
+        const char *field;
+        const char *value;
+    } resp_hdrs[HTTPD_MAX_RESP_HEADERS];
+    size_t resp_hdr_count;
+} httpd_req_aux_t;
+
+static const char *const s_err_status[HTTPD_ERR_CODE_MAX] = {
+    [HTTPD_500_INTERNAL_SERVER_ERROR]    = "500 Internal Server Error",
+    [HTTPD_501_METHOD_NOT_IMPLEMENTED]   = "501 Method Not Implemented",
+    [HTTPD_505_VERSION_NOT_SUPPORTED]    = "505 Version Not Supported",
+    [HTTPD_400_BAD_REQUEST]              = "400 Bad Request",
+    [HTTPD_401_UNAUTHORIZED]             = "401 Unauthorized",
+    [HTTPD_403_FORBIDDEN]                = "403 Forbidden",
+    [HTTPD_404_NOT_FOUND]                = "404 Not Found",
+    [HTTPD_405_METHOD_NOT_ALLOWED]       = "405 Method Not Allowed",
+    [HTTPD_408_REQ_TIMEOUT]              = "408 Request Timeout",
+    [HTTPD_411_LENGTH_REQUIRED]          = "411 Length Required",
+    [HTTPD_414_URI_TOO_LONG]             = "414 URI Too Long",
+    [HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE] = "431 Request Header Fields Too Large",
+};
+
+/*---------------------------------- sockets ----------------------------------*/
+
+static int sock_send_all(int fd, const char *buf, size_t len)
+{
+    size_t sent = 0;
+    while (sent < len) {
+        ssize_t n = send(fd, buf + sent, len - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return HTTPD_SOCK_ERR_FAIL;
+        }
+        sent += n;
+    }
+    return (int)sent;
+}
+
+static void sess_close(httpd_data_t *hd, int slot)
+{
+    httpd_sess_t *sess = hd->sessions[slot];
+    if (sess->ctx) {
+        if (sess->free_ctx) {
+            sess->free_ctx(sess->ctx);
+        } else {
+            free(sess->ctx);
+        }
+    }
+    close(sess->fd);
+    free(sess);
+    hd->sessions[slot] = NULL;
+}
+
+static httpd_sess_t *sess_find(httpd_data_t *hd, int fd)
+{
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sessions[i] && hd->sessions[i]->fd == fd) {
+            return hd->sessions[i];
+        }
+    }
+    return NULL;
+}
+
+static void sess_accept(httpd_data_t *hd)
+{
+    int fd = accept(hd->listen_fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+
+    int slot = -1;
+    int lru = -1;
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (!hd->sessions[i]) {
+            slot = i;
+            break;
+        }
+        if (lru < 0 || hd->sessions[i]->lru < hd->sessions[lru]->lru) {
+            lru = i;
+        }
+    }
+    if (slot < 0 && hd->config.lru_purge_enable) {
+        ESP_LOGD(TAG, "purging LRU session %d", hd->sessions[lru]->fd);
+        sess_close(hd, lru);
+        slot = lru;
+    }
+    if (slot < 0) {
+        ESP_LOGW(TAG, "no free session, closing %d", fd);
+        close(fd);
+        return;
+    }
+
+    httpd_sess_t *sess = calloc(1, sizeof(httpd_sess_t));
+    if (!sess) {
+        close(fd);
+        return;
+    }
+    struct timeval rcv = { .tv_sec = hd->config.recv_wait_timeout };
+    struct timeval snd = { .tv_sec = hd->config.send_wait_timeout };
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &rcv, sizeof(rcv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    sess->fd = fd;
+    sess->lru = ++hd->lru_counter;
+    hd->sessions[slot] = sess;
+}
+
+/*--------------------------------- requests ----------------------------------*/
+
+static int method_from_str(const char *m, size_t len)
+{
+    static const char *const names[] = {
+        [HTTP_DELETE] = "DELETE", [HTTP_GET] = "GET", [HTTP_HEAD] = "HEAD",
+        [HTTP_POST] = "POST", [HTTP_PUT] = "PUT",
+    };
+    for (int i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (strlen(names[i]) == len && !strncmp(names[i], m, len)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Value of a request header, NULL if absent */
+static const char *hdr_find(const char *hdr, const char *field, size_t *value_len)
+{
+    size_t field_len = strlen(field);
+    for (const char *line = hdr; *line; ) {
+        const char *eol = strstr(line, "\r\n");
+        if (!eol) {
+            break;
+        }
+        if (!strncasecmp(line, field, field_len) && line[field_len] == ':') {
+            const char *v = line + field_len + 1;
+            while (*v == ' ' || *v == '\t') {
+                v++;
+            }
+            *value_len = eol - v;
+            return v;
+        }
+        line = eol + 2;
+    }
+    return NULL;
+}
+
+static esp_err_t req_dispatch(httpd_data_t *hd, httpd_req_t *req)
+{
+    size_t path_len = strcspn(req->uri, "?#");
+    bool uri_known = false;
+    for (size_t i = 0; i < hd->uri_count; i++) {
+        const httpd_uri_t *u = &hd->uris[i];
+        bool match = hd->config.uri_match_fn ?
+                     hd->config.uri_match_fn(u->uri, req->uri, path_len) :
+                     (strlen(u->uri) == path_len && !strncmp(u->uri, req->uri, path_len));
+        if (!match) {
+            continue;
+        }
+        uri_known = true;
+        if (u->method == req->method) {
+            req->user_ctx = u->user_ctx;
+            return u->handler(req);
+        }
+    }
+
+    httpd_err_code_t err = uri_known ? HTTPD_405_METHOD_NOT_ALLOWED : HTTPD_404_NOT_FOUND;
+    if (hd->err_handlers[err]) {
+        return hd->err_handlers[err](req, err);
+    }
+    httpd_resp_send_err(req, err, NULL);
+    return ESP_FAIL;
+}
+
+/* Receive and handle one request, false if the session has to be closed */
+static bool sess_process(httpd_data_t *hd, httpd_sess_t *sess)
+{
+    char *end;
+    while (!(end = memmem(sess->rx, sess->rx_len, "\r\n\r\n", 4))) {
+        if (sess->rx_len == sizeof(sess->rx)) {
+            ESP_LOGW(TAG, "request header too large");
+            return false;
+        }
+        ssize_t n = recv(sess->fd, sess->rx + sess->rx_len, sizeof(sess->rx) - sess->rx_len, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            /* closed by peer, or timed out in the middle of a header */
+            return false;
+        }
+        sess->rx_len += n;
+    }
+
+    httpd_req_aux_t *aux = calloc(1, sizeof(httpd_req_aux_t));
+    if (!aux) {
+        return false;
+    }
+    httpd_req_t req = {
+        .handle = hd,
+        .aux = aux,
+        .sess_ctx = sess->ctx,
+        .free_ctx = sess->free_ctx,
+    };
+    aux->sess = sess;
+    aux->keep_alive = true;
+    aux->status = "200 OK";
+    aux->type = "text/html";
+
+    /* request line: METHOD SP URI SP HTTP/1.x CRLF */
+    size_t hdr_len = end + 4 - sess->rx;
+    char *line_end = strstr(sess->rx, "\r\n");
+    char *sp1 = memchr(sess->rx, ' ', line_end - sess->rx);
+    char *sp2 = sp1 ? memchr(sp1 + 1, ' ', line_end - sp1 - 1) : NULL;
+    bool ok = sp1 && sp2;
+    if (ok) {
+        req.method = method_from_str(sess->rx, sp1 - sess->rx);
+        size_t uri_len = sp2 - sp1 - 1;
+        ok = req.method >= 0 && uri_len <= HTTPD_MAX_URI_LEN;
+        if (ok) {
+            memcpy((char *)req.uri, sp1 + 1, uri_len);
+            aux->keep_alive = !strncmp(sp2 + 1, "HTTP/1.1", 8);
+        }
+    }
+    /* header lines including the CRLF of the last one */
+    size_t lines_len = end + 2 - (line_end + 2);
+    if (ok && lines_len < sizeof(aux->hdr)) {
+        memcpy(aux->hdr, line_end + 2, lines_len);
+    } else {
+        ok = false;
+    }
+    sess->rx_len -= hdr_len;
+    memmove(sess->rx, sess->rx + hdr_len, sess->rx_len);
+    if (!ok) {
+        httpd_resp_send_err(&req, HTTPD_400_BAD_REQUEST, NULL);
+        free(aux);
+        return false;
+    }
+
+    size_t len;
+    const char *v = hdr_find(aux->hdr, "Content-Length", &len);
+    req.content_len = v ? strtoul(v, NULL, 10) : 0;
+    aux->remaining = req.content_len;
+    v = hdr_find(aux->hdr, "Connection", &len);
+    if (v && len == 5 && !strncasecmp(v, "close", 5)) {
+        aux->keep_alive = false;
+    }
+
+    sess->lru = ++hd->lru_counter;
+    esp_err_t ret = req_dispatch(hd, &req);
+
+    /* the handler may have replaced the session context */
+    if (sess->ctx && sess->ctx != req.sess_ctx) {
+        if (sess->free_ctx) {
+            sess->free_ctx(sess->ctx);
+        } else {
+            free(sess->ctx);
+        }
+    }
+    sess->ctx = req.sess_ctx;
+    sess->free_ctx = req.free_ctx;
+
+    /* discard what the handler did not read, like httpd_req_delete() */
+    char discard[512];
+    while (ret == ESP_OK && aux->remaining > 0) {
+        if (httpd_req_recv(&req, discard, sizeof(discard)) <= 0) {
+            ret = ESP_FAIL;
+        }
+    }
+    bool keep = ret == ESP_OK && aux->keep_alive;
+    free(aux);
+    return keep;
+}
+
+/*-------------------------------- server loop --------------------------------*/
+
+static void run_work_queue(httpd_data_t *hd)
+{
+    char drain[64];
+    /* the pipe is non-blocking, this stops at EAGAIN once it is empty */
+    while (read(hd->ctrl_fd[0], drain, sizeof(drain)) > 0);
+
+    pthread_mutex_lock(&hd->work_lock);
+    httpd_work_t *work = hd->work_head;
+    hd->work_head = hd->work_tail = NULL;
+    pthread_mutex_unlock(&hd->work_lock);
+
+    while (work) {
+        httpd_work_t *next = work->next;
+        work->fn(work->arg);
+        free(work);
+        work = next;
+    }
+}
+
+static void close_pending(httpd_data_t *hd)
+{
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sessions[i] && hd->sessions[i]->close_pending) {
+            sess_close(hd, i);
+        }
+    }
+}
+
+static void *httpd_thread(void *arg)
+{
+    httpd_data_t *hd = (httpd_data_t *)arg;
+    while (!hd->stop) {
+        /* pipelined requests already sitting in a session buffer */
+        for (int i = 0; i < hd->config.max_open_sockets; i++) {
+            httpd_sess_t *sess = hd->sessions[i];
+            if (sess && !sess->close_pending && sess->rx_len > 0 && !sess_process(hd, sess)) {
+                sess->close_pending = true;
+            }
+        }
+        close_pending(hd);
+
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(hd->listen_fd, &fds);
+        FD_SET(hd->ctrl_fd[0], &fds);
+        int maxfd = MAX(hd->listen_fd, hd->ctrl_fd[0]);
+        for (int i = 0; i < hd->config.max_open_sockets; i++) {
+            if (hd->sessions[i]) {
+                FD_SET(hd->sessions[i]->fd, &fds);
+                maxfd = MAX(maxfd, hd->sessions[i]->fd);
+            }
+        }
+        if (select(maxfd + 1, &fds, NULL, NULL, NULL) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ESP_LOGE(TAG, "select failed: %s", strerror(errno));
+            break;
+        }
+
+        if (FD_ISSET(hd->ctrl_fd[0], &fds)) {
+            run_work_queue(hd);
+        }
+        for (int i = 0; i < hd->config.max_open_sockets; i++) {
+            httpd_sess_t *sess = hd->sessions[i];
+            if (sess && !sess->close_pending && FD_ISSET(sess->fd, &fds) && !sess_process(hd, sess)) {
+                sess->close_pending = true;
+            }
+        }
+        close_pending(hd);
+        if (FD_ISSET(hd->listen_fd, &fds)) {
+            sess_accept(hd);
+        }
+    }
+    return NULL;
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+    if (!handle || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_data_t *hd = calloc(1, sizeof(httpd_data_t));
+    if (!hd) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    hd->config = *config;
+    hd->uris = calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+    hd->sessions = calloc(config->max_open_sockets, sizeof(httpd_sess_t *));
+    pthread_mutex_init(&hd->work_lock, NULL);
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(config->server_port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int one = 1;
+    hd->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (!hd->uris || !hd->sessions || hd->listen_fd < 0 || pipe(hd->ctrl_fd) != 0 ||
+            fcntl(hd->ctrl_fd[0], F_SETFL, O_NONBLOCK) != 0 ||
+            fcntl(hd->ctrl_fd[1], F_SETFL, O_NONBLOCK) != 0 ||
+            setsockopt(hd->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0 ||
+            bind(hd->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+            listen(hd->listen_fd, config->backlog_conn) != 0) {
+        ESP_LOGE(TAG, "cannot listen on port %u: %s", config->server_port, strerror(errno));
+        return ESP_ERR_HTTPD_TASK;
+    }
+    if (pthread_create(&hd->thread, NULL, httpd_thread, hd) != 0) {
+        return ESP_ERR_HTTPD_TASK;
+    }
+    *handle = hd;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle)
+{
+    httpd_data_t *hd = (httpd_data_t *)handle;
+    if (!hd) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    hd->stop = true;
+    if (write(hd->ctrl_fd[1], "", 1) < 0 && errno != EAGAIN) {
+        return ESP_FAIL;
+    }
+    pthread_join(hd->thread, NULL);
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sessions[i]) {
+            sess_close(hd, i);
+        }
+    }
+    for (size_t i = 0; i < hd->uri_count; i++) {
+        free((char *)hd->uris[i].uri);
+    }
+    close(hd->listen_fd);
+    close(hd->ctrl_fd[0]);
+    close(hd->ctrl_fd[1]);
+    free(hd->uris);
+    free(hd->sessions);
+    free(hd);
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+    httpd_data_t *hd = (httpd_data_t *)handle;
+    if (!hd || !uri_handler || !uri_handler->uri || !uri_handler->handler) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < hd->uri_count; i++) {
+        if (hd->uris[i].method == uri_handler->method && !strcmp(hd->uris[i].uri, uri_handler->uri)) {
+            return ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if (hd->uri_count == hd->config.max_uri_handlers) {
+        ESP_LOGW(TAG, "no slots left for registering handler %s", uri_handler->uri);
+        return ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+    hd->uris[hd->uri_count] = *uri_handler;
+    hd->uris[hd->uri_count].uri = strdup(uri_handler->uri);
+    hd->uri_count++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_err_handler(httpd_handle_t handle, httpd_err_code_t error, httpd_err_handler_func_t handler_fn)
+{
+    httpd_data_t *hd = (httpd_data_t *)handle;
+    if (!hd || error >= HTTPD_ERR_CODE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    hd->err_handlers[error] = handler_fn;
+    return ESP_OK;
+}
+
+/* Same rules as ESP-IDF: a trailing '*' matches anything, a '?' makes the
+ * character before it optional */
+bool httpd_uri_match_wildcard(const char *uri_template, const char *uri_to_match, size_t match_upto)
+{
+    const size_t tpl_len = strlen(uri_template);
+    size_t exact_match_chars = tpl_len;
+    const char last = tpl_len > 0 ? uri_template[tpl_len - 1] : 0;
+    const char prevlast = tpl_len > 1 ? uri_template[tpl_len - 2] : 0;
+    const bool asterisk = last == '*' || (prevlast == '*' && last == '?');
+    const bool quest = last == '?' || (prevlast == '?' && last == '*');
+
+    if (exact_match_chars < asterisk + quest * 2) {
+        return false;
+    }
+    exact_match_chars -= asterisk + quest * 2;
+    if (match_upto < exact_match_chars) {
+        return false;
+    }
+    if (!quest) {
+        if (!asterisk && match_upto != exact_match_chars) {
+            return false;
+        }
+        return strncmp(uri_template, uri_to_match, exact_match_chars) == 0;
+    }
+    if (match_upto > exact_match_chars && uri_template[exact_match_chars] != uri_to_match[exact_match_chars]) {
+        return false;
+    }
+    if (strncmp(uri_template, uri_to_match, exact_match_chars) != 0) {
+        return false;
+    }
+    return asterisk || match_upto <= exact_match_chars + 1;
+}
+
+int httpd_req_recv(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    httpd_req_aux_t *aux = (httpd_req_aux_t *)r->aux;
+    httpd_sess_t *sess = aux->sess;
+    size_t want = MIN(buf_len, aux->remaining);
+    if (want == 0) {
+        return 0;
+    }
+    if (sess->rx_len > 0) {
+        size_t n = MIN(want, sess->rx_len);
+        memcpy(buf, sess->rx, n);
+        sess->rx_len -= n;
+        memmove(sess->rx, sess->rx + n, sess->rx_len);
+        aux->remaining -= n;
+        return (int)n;
+    }
+    ssize_t n = recv(sess->fd, buf, want, 0);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ?
+               HTTPD_SOCK_ERR_TIMEOUT : HTTPD_SOCK_ERR_FAIL;
+    }
+    aux->remaining -= n;
+    return (int)n;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field)
+{
+    size_t len = 0;
+    if (!r || !field || !hdr_find(((httpd_req_aux_t *)r->aux)->hdr, field, &len)) {
+        return 0;
+    }
+    return len;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+    size_t len = 0;
+    const char *v = (r && field) ? hdr_find(((httpd_req_aux_t *)r->aux)->hdr, field, &len) : NULL;
+    if (!v) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!val || val_size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t n = MIN(len, val_size - 1);
+    memcpy(val, v, n);
+    val[n] = '\0';
+    return n < len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    const char *q = r ? strchr(r->uri, '?') : NULL;
+    if (!q) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!buf || buf_len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    q++;
+    size_t len = strcspn(q, "#");
+    size_t n = MIN(len, buf_len - 1);
+    memcpy(buf, q, n);
+    buf[n] = '\0';
+    return n < len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size)
+{
+    if (!qry || !key || !val || val_size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t key_len = strlen(key);
+    for (const char *p = qry; *p; ) {
+        size_t pair_len = strcspn(p, "&");
+        if (pair_len > key_len && !strncmp(p, key, key_len) && p[key_len] == '=') {
+            size_t len = pair_len - key_len - 1;
+            size_t n = MIN(len, val_size - 1);
+            memcpy(val, p + key_len + 1, n);
+            val[n] = '\0';
+            return n < len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+        }
+        p += pair_len;
+        if (*p == '&') {
+            p++;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r)
+{
+    return r ? ((httpd_req_aux_t *)r->aux)->sess->fd : -1;
+}
+
+/*--------------------------------- responses ---------------------------------*/
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+    ((httpd_req_aux_t *)r->aux)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+    ((httpd_req_aux_t *)r->aux)->type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+    httpd_req_aux_t *aux = (httpd_req_aux_t *)r->aux;
+    if (aux->resp_hdr_count == HTTPD_MAX_RESP_HEADERS) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    aux->resp_hdrs[aux->resp_hdr_count].field = field;
+    aux->resp_hdrs[aux->resp_hdr_count].value = value;
+    aux->resp_hdr_count++;
+    return ESP_OK;
+}
+
+/* Status line and headers, content_len < 0 selects chunked encoding */
+static esp_err_t resp_send_head(httpd_req_t *r, ssize_t content_len)
+{
+    httpd_req_aux_t *aux = (httpd_req_aux_t *)r->aux;
+    char head[HTTPD_MAX_REQ_HDR_LEN];
+    int len = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Type: %s\r\n", aux->status, aux->type);
+    if (content_len < 0) {
+        len += snprintf(head + len, sizeof(head) - len, "Transfer-Encoding: chunked\r\n");
+    } else {
+        len += snprintf(head + len, sizeof(head) - len, "Content-Length: %zd\r\n", content_len);
+    }
+    for (size_t i = 0; i < aux->resp_hdr_count && len < sizeof(head); i++) {
+        len += snprintf(head + len, sizeof(head) - len, "%s: %s\r\n", aux->resp_hdrs[i].field, aux->resp_hdrs[i].value);
+    }
+    if (!aux->keep_alive && len < sizeof(head)) {
+        len += snprintf(head + len, sizeof(head) - len, "Connection: close\r\n");
+    }
+    if (len + 2 >= sizeof(head)) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    memcpy(head + len, "\r\n", 2);
+    len += 2;
+    aux->resp_started = true;
+    return sock_send_all(aux->sess->fd, head, len) < 0 ? ESP_ERR_HTTPD_RESP_SEND : ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    if (!r) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    esp_err_t ret = resp_send_head(r, buf_len);
+    if (ret == ESP_OK && buf_len > 0 &&
+            sock_send_all(((httpd_req_aux_t *)r->aux)->sess->fd, buf, buf_len) < 0) {
+        ret = ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ret;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    if (!r) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_req_aux_t *aux = (httpd_req_aux_t *)r->aux;
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    if (!aux->resp_started && resp_send_head(r, -1) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    char size[16];
+    int len = snprintf(size, sizeof(size), "%zx\r\n", buf_len);
+    int fd = aux->sess->fd;
+    if (sock_send_all(fd, size, len) < 0 ||
+            (buf_len > 0 && sock_send_all(fd, buf, buf_len) < 0) ||
+            sock_send_all(fd, "\r\n", 2) < 0) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg)
+{
+    if (!req || error >= HTTPD_ERR_CODE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_req_aux_t *aux = (httpd_req_aux_t *)req->aux;
+    const char *status = s_err_status[error];
+    aux->status = status;
+    aux->type = "text/html";
+    aux->keep_alive = false;
+    return httpd_resp_send(req, msg ? msg : status + 4, HTTPD_RESP_USE_STRLEN);
+}
+
+/*------------------------------ session helpers ------------------------------*/
+
+int httpd_socket_send(httpd_handle_t hd, int sockfd, const char *buf, size_t buf_len, int flags)
+{
+    if (!hd || !buf) {
+        return HTTPD_SOCK_ERR_INVALID;
+    }
+    if (flags & MSG_DONTWAIT) {
+        /* like the default send_fn: one attempt, possibly short */
+        ssize_t n = send(sockfd, buf, buf_len, flags | MSG_NOSIGNAL);
+        if (n < 0) {
+            return (errno == EAGAIN || errno == EWOULDBLOCK) ? HTTPD_SOCK_ERR_TIMEOUT : HTTPD_SOCK_ERR_FAIL;
+        }
+        return (int)n;
+    }
+    return sock_send_all(sockfd, buf, buf_len);
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void *arg)
+{
+    httpd_data_t *hd = (httpd_data_t *)handle;
+    if (!hd || !work) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_work_t *item = calloc(1, sizeof(httpd_work_t));
+    if (!item) {
+        return ESP_ERR_NO_MEM;
+    }
+    item->fn = work;
+    item->arg = arg;
+    pthread_mutex_lock(&hd->work_lock);
+    if (hd->work_tail) {
+        hd->work_tail->next = item;
+    } else {
+        hd->work_head = item;
+    }
+    hd->work_tail = item;
+    pthread_mutex_unlock(&hd->work_lock);
+    /* a full pipe already has wake-ups pending for the loop */
+    if (write(hd->ctrl_fd[1], "", 1) != 1 && errno != EAGAIN) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd)
+{
+    httpd_sess_t *sess = handle ? sess_find((httpd_data_t *)handle, sockfd) : NULL;
+    if (!sess) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    sess->close_pending = true;
+    return ESP_OK;
+}
+
+esp_err_t httpd_sess_update_lru_counter(httpd_handle_t handle, int sockfd)
+{
+    httpd_data_t *hd = (httpd_data_t *)handle;
+    httpd_sess_t *sess = hd ? sess_find(hd, sockfd) : NULL;
+    if (!sess) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    sess->lru = ++hd->lru_counter;
+    return ESP_OK;
+}
@@ -0,0 +1,151 @@
+/* Host build of the USB wireless disk file server
+
+   Serves a local directory with the unmodified file_server.c on top of
+   httpd_posix.c, for load testing without a board:
+
+       file_server_host [-p port] [-v] <directory>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "thumb_cache.h"
+
+esp_log_level_t esp_log_host_level = ESP_LOG_WARN;
+
+extern esp_err_t start_file_server(const char *base_path);
+
+void esp_log_host_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    static const char letters[] = "NEWIDV";
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "%c (%s) ", letters[level], tag);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    return code == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+#ifndef HAVE_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    uint64_t period;
+    pthread_t thread;
+};
+
+static void *esp_timer_thread(void *arg)
+{
+    esp_timer_handle_t timer = arg;
+    while (1) {
+        struct timespec ts = { timer->period / 1000000, timer->period % 1000000 * 1000 };
+        nanosleep(&ts, NULL);
+        timer->args.callback(timer->args.arg);
+    }
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle)
+{
+    *out_handle = calloc(1, sizeof(struct esp_timer));
+    if (!*out_handle) {
+        return ESP_ERR_NO_MEM;
+    }
+    (*out_handle)->args = *args;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    timer->period = period;
+    return pthread_create(&timer->thread, NULL, esp_timer_thread, timer) ? ESP_FAIL : ESP_OK;
+}
+
+/* Thumbnails need the JPEG codec and a worker task, they are not part of
+ * the host build; /thumb answers 404 like for a missing file */
+esp_err_t thumb_cache_init(const char *base_path)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t thumb_cache_get(const char *src_path, uint16_t width, char *out_path, size_t out_len)
+{
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t thumb_cache_remove(const char *src_path)
+{
+    return ESP_ERR_INVALID_STATE;
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "p:v")) != -1) {
+        switch (opt) {
+        case 'p':
+            httpd_host_port = atoi(optarg);
+            break;
+        case 'v':
+            esp_log_host_level++;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-p port] [-v] <directory>\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-p port] [-v] <directory>\n", argv[0]);
+        return 1;
+    }
+
+    /* the firmware serves the card root without a trailing slash */
+    char *base_path = argv[optind];
+    size_t len = strlen(base_path);
+    while (len > 1 && base_path[len - 1] == '/') {
+        base_path[--len] = '\0';
+    }
+
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    /* block before the server thread starts, so it inherits the mask */
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    if (start_file_server(base_path) != ESP_OK) {
+        return 1;
+    }
+    printf("serving %s on port %u\n", base_path, httpd_host_port);
+    fflush(stdout);
+
+    int sig;
+    sigwait(&signals, &sig);
+    return 0;
+}
@@ -0,0 +1,66 @@
+#!/bin/sh
+# Start the host file server on a scratch directory and exercise each handler once.
+# usage: smoke_test.sh <path to file_server_host>
+set -e
+
+SERVER="$1"
+PORT=${PORT:-18080}
+ROOT=$(mktemp -d)
+URL="http://127.0.0.1:$PORT"
+
+"$SERVER" -p "$PORT" "$ROOT" &
+PID=$!
+trap 'kill $PID 2>/dev/null; rm -rf "$ROOT"' EXIT
+
+for i in 1 2 3 4 5 6 7 8 9 10; do
+    curl -s -o /dev/null "$URL/" && break
+    sleep 0.2
+done
+
+fail() {
+    echo "FAIL: $*"
+    exit 1
+}
+
+curl -sN --max-time 2 "$URL/events" > "$ROOT/.events" &
+EVENTS=$!
+sleep 0.3
+
+echo "hello sdstick" > "$ROOT/src.txt"
+curl -sf -H "X-No-Redirect: 1" --data-binary @"$ROOT/src.txt" "$URL/upload/a.txt" > /dev/null || fail upload
+curl -sf "$URL/a.txt" | cmp -s - "$ROOT/src.txt" || fail download
+curl -sf "$URL/" | grep -q "a.txt" || fail listing
+wait $EVENTS || true
+grep -q '^event: created' "$ROOT/.events" || fail events
+
+[ "$(curl -sf "$URL/bench/source?bytes=100000" | wc -c)" -eq 100000 ] || fail bench source
+curl -sf "$URL/bench/source" | grep -q '"test":"source"' || fail bench source report
+curl -sf -X POST --data-binary @"$ROOT/src.txt" "$URL/bench/sink" | grep -q '"test":"sink"' || fail bench sink
+curl -sf "$URL/bench/sd?op=write&size=65536&bs=4096" | grep -q '"test":"sd_write"' || fail bench sd
+curl -sf "$URL/bench/sd?op=read&size=65536&bs=4096" | grep -q '"test":"sd_read"' || fail bench sd read
+[ ! -e "$ROOT/.bench.bin" ] || fail bench file left behind
+
+# Idle connections fill the sessions, the purge must pick them and not the
+# event stream, which was used more recently
+hold() {
+    python3 -c 'import socket, sys, time
+s = [socket.create_connection(("127.0.0.1", int(sys.argv[1]))) for i in range(int(sys.argv[2]))]
+time.sleep(3)' "$PORT" "$1" &
+    sleep 0.3
+}
+curl -sN --max-time 4 "$URL/events" > "$ROOT/.events" &
+EVENTS=$!
+sleep 0.3
+hold 9
+curl -sf -H "X-No-Redirect: 1" --data-binary @"$ROOT/src.txt" "$URL/upload/b.txt" > /dev/null || fail upload b
+hold 2
+curl -sf -H "X-No-Redirect: 1" --data-binary @"$ROOT/src.txt" "$URL/upload/c.txt" > /dev/null || fail upload c
+wait $EVENTS || true
+grep -q '"path":"/c.txt"' "$ROOT/.events" || fail event stream purged before idle sessions
+
+curl -sf "$URL/metrics" | grep -q 'http_request_duration_seconds_count{handler="download"} ' || fail metrics
+
+curl -s -o /dev/null -X POST "$URL/delete/a.txt" || fail delete
+[ ! -e "$ROOT/a.txt" ] || fail delete left the file
+
+echo "PASS"
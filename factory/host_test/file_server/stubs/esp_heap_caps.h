@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+/* No capability heaps on the host, /metrics skips heaps with zero size */
+static inline size_t heap_caps_get_total_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_free_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_minimum_free_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 0; }
@@ -0,0 +1,4 @@
+#pragma once
+
+/* Host paths are longer than VFS mount points on the target */
+#define ESP_VFS_PATH_MAX 128
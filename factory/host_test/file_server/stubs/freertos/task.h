@@ -0,0 +1,26 @@
+#pragma once
+
+#include <pthread.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+static inline TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/* Tasks are threads, the handle is only compared for identity */
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return (TaskHandle_t)pthread_self();
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = { ticks / 1000, (ticks % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
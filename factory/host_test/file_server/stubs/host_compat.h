@@ -0,0 +1,9 @@
+/* Force-included into the firmware sources of the host build */
+#pragma once
+
+#include <stddef.h>
+#include "sdkconfig.h"
+
+#ifndef HAVE_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
@@ -0,0 +1,12 @@
+/* Configuration of the host build, mirrors the defaults of the firmware */
+#pragma once
+
+#define CONFIG_SPIFFS_OBJ_NAME_LEN 256
+#define CONFIG_WIFI_HTTP_ACCESS 1
+#define CONFIG_THUMB_DEFAULT_WIDTH 160
+#define CONFIG_THUMB_MAX_WIDTH 320
+#define CONFIG_THUMB_JPEG_QUALITY 75
+#define CONFIG_THUMB_QUEUE_LEN 4
+#define CONFIG_HTTP_BENCH_ENABLE 1
+#define CONFIG_HTTP_BENCH_MAX_BYTES 67108864
+#define CONFIG_HTTP_BENCH_MAX_BLOCK 32768
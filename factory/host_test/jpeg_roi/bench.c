@@ -0,0 +1,342 @@
+/* Host benchmark of region decoding in jpegd2
+
+   jpeg_roi_bench [file.jpg...]            time a window of each size against a full decode
+   jpeg_roi_bench --check [file.jpg...]    compare windows with the full image, exit status 1 on a mismatch
+
+   Without files the corpus is generated: large photos with smooth
+   gradients, edges and noise, baseline 4:2:0, 4:4:4 and progressive,
+   and smaller odd sized 4:2:2 and grayscale ones for the checks.
+   Every window is centred in the image, like a viewer zoomed in on it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "jpegd2.h"
+#include "jpeglib.h"
+#include "color_convert.h"
+
+#define STRIP_ROWS 16
+#define BENCH_RUNS 5
+
+typedef struct {
+    char name[64];
+    uint8_t *data;
+    size_t size;
+    int width;
+    int height;
+} image_t;
+
+/* where capture_cb() writes: a frame of frame_w pixels per row */
+static uint16_t *s_frame;
+static size_t s_frame_w;
+
+static bool capture_cb(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data)
+{
+    for (int r = 0; r < h; r++) {
+        memcpy(&s_frame[(y + r) * s_frame_w + x], &data[r * w], w * 2);
+    }
+    return true;
+}
+
+static bool discard_cb(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data)
+{
+    return true;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    rewind(f);
+    uint8_t *data = malloc(*size);
+    if (data && fread(data, 1, *size, f) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+/* A photo-like test image: gradients, a disc, stripes and noise, gray keeps the first channel */
+static void generate(image_t *img, int w, int h, int h_samp, int v_samp, bool progressive, bool gray)
+{
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned long size = 0;
+    uint8_t *row = malloc(w * 3);
+    static const char *const sampling[] = {"4:4:4", "4:2:2", "4:2:0"};
+    uint32_t seed = w * 31 + h;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    img->data = NULL;
+    jpeg_mem_dest(&cinfo, &img->data, &size);
+    cinfo.image_width = w;
+    cinfo.image_height = h;
+    cinfo.input_components = gray ? 1 : 3;
+    cinfo.in_color_space = gray ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, 85, TRUE);
+    cinfo.comp_info[0].h_samp_factor = h_samp;
+    cinfo.comp_info[0].v_samp_factor = v_samp;
+    if (progressive) {
+        jpeg_simple_progression(&cinfo);
+    }
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        int y = cinfo.next_scanline;
+        for (int x = 0; x < w; x++) {
+            int dx = x - w / 2, dy = y - h / 2;
+            bool disc = dx * dx + dy * dy < (h / 3) * (h / 3);
+            seed = seed * 1103515245 + 12345;
+            int noise = (seed >> 16) & 15;
+            uint8_t *p = gray ? &row[x] : &row[3 * x];
+            p[0] = (disc ? 255 - x * 255 / w : x * 255 / w) ^ noise;
+            if (!gray) {
+                p[1] = (y * 255 / h) ^ noise;
+                p[2] = ((x / 40 + y / 60) & 1) ? 200 + noise : 40 + noise;
+            }
+        }
+        JSAMPROW p = row;
+        jpeg_write_scanlines(&cinfo, &p, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    free(row);
+    img->size = size;
+    img->width = w;
+    img->height = h;
+    snprintf(img->name, sizeof(img->name), "%dx%d %s%s", w, h,
+             gray ? "gray" : sampling[h_samp + v_samp - 2], progressive ? " prog" : "");
+}
+
+static bool load(image_t *img, const char *path)
+{
+    img->data = read_file(path, &img->size);
+    if (!img->data) {
+        return false;
+    }
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, img->data, img->size);
+    jpeg_read_header(&cinfo, TRUE);
+    img->width = cinfo.image_width;
+    img->height = cinfo.image_height;
+    jpeg_destroy_decompress(&cinfo);
+    snprintf(img->name, sizeof(img->name), "%.63s", path);
+    return true;
+}
+
+/* Decode a window of w x h at x, y of the image zoomed to scale / 8 */
+static esp_err_t draw(jpegd2_ctx_t *ctx, const image_t *img, uint8_t scale, bool dither, size_t x, size_t y,
+                      size_t w, size_t h, lcd_write_cb cb)
+{
+    static uint8_t *strip;
+    static size_t strip_w;
+    if (strip_w < w) {
+        free(strip);
+        strip = malloc(w * STRIP_ROWS * 2);
+        strip_w = w;
+    }
+    const jpegd2_output_t out = {
+        .outbuffer = strip,
+        .outbuffer_width = w,
+        .outbuffer_height = STRIP_ROWS,
+        .lcd_cb = cb,
+        .dither_output = dither,
+        .lcd_width = w,
+        .lcd_height = h,
+        .scale = scale,
+        .crop_x = x,
+        .crop_y = y,
+    };
+    jpegd2_set_source_mem(ctx, img->data, img->size);
+    return jpegd2_draw(ctx, &out);
+}
+
+/* The same window without region decoding, like jpegd2 did before: every row down to the
+ * bottom of the window decoded in full, the window converted */
+static void draw_full(const image_t *img, size_t x, size_t y, size_t w, size_t h)
+{
+    static uint16_t line[4096];
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, img->data, img->size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.dct_method = JDCT_IFAST;
+    cinfo.do_fancy_upsampling = 0;
+    cinfo.out_color_space = JCS_RGB;
+    jpeg_start_decompress(&cinfo);
+    JSAMPARRAY row = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, cinfo.output_width * 3, 1);
+    while (cinfo.output_scanline < y + h) {
+        jpeg_read_scanlines(&cinfo, row, 1);
+        if (cinfo.output_scanline > y) {
+            color_convert_rgb888_to_rgb565(row[0] + 3 * x, line, w, cinfo.output_scanline - 1 - y, 0);
+        }
+    }
+    jpeg_abort_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+}
+
+/* The image decoded to RGB888 and converted by color_convert, what jpegd2 did before it
+ * decoded to RGB565 itself */
+static void draw_reference(const image_t *img, uint8_t scale, uint32_t flags, uint16_t *frame)
+{
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, img->data, img->size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.dct_method = JDCT_IFAST;
+    cinfo.do_fancy_upsampling = 0;
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = scale;
+    cinfo.scale_denom = 8;
+    jpeg_start_decompress(&cinfo);
+    JSAMPARRAY row = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, cinfo.output_width * 3, 1);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        jpeg_read_scanlines(&cinfo, row, 1);
+        uint32_t y = cinfo.output_scanline - 1;
+        color_convert_rgb888_to_rgb565(row[0], &frame[y * cinfo.output_width], cinfo.output_width, y, flags);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+}
+
+/* The full image must match the reference, windows at the corners, the centre and odd
+ * offsets must match the full image */
+static int check(jpegd2_ctx_t *ctx, const image_t *img, uint8_t scale, bool dither)
+{
+    int w = (img->width * scale + 7) / 8, h = (img->height * scale + 7) / 8;
+    uint16_t *full = malloc((size_t)w * h * 2);
+    uint16_t *ref = malloc((size_t)w * h * 2);
+    uint16_t *win = malloc(240 * 240 * 2);
+    const char *mode = dither ? " dither" : "";
+    s_frame = full;
+    s_frame_w = w;
+    if (ESP_OK != draw(ctx, img, scale, dither, 0, 0, w, h, capture_cb)) {
+        printf("%s 1/%d%s: full decode failed\n", img->name, 8 / scale, mode);
+        return 1;
+    }
+    draw_reference(img, scale, dither ? COLOR_CONVERT_DITHER : 0, ref);
+    for (int r = 0; r < h; r++) {
+        if (memcmp(&full[r * w], &ref[r * w], w * 2)) {
+            printf("%s 1/%d%s: row %d differs from RGB888 and color_convert\n", img->name, 8 / scale, mode, r);
+            return 1;
+        }
+    }
+    const int pos[][2] = { {0, 0}, {w - 240, h - 240}, {w / 2 - 120, h / 2 - 120}, {37, 101}, {w - 61, 3}, {5, h - 17} };
+    for (size_t i = 0; i < sizeof(pos) / sizeof(pos[0]); i++) {
+        size_t x = pos[i][0] < 0 ? 0 : pos[i][0];
+        size_t y = pos[i][1] < 0 ? 0 : pos[i][1];
+        size_t ww = w - x < 240 ? w - x : 240;
+        size_t wh = h - y < 240 ? h - y : 240;
+        s_frame = win;
+        s_frame_w = ww;
+        if (ESP_OK != draw(ctx, img, scale, dither, x, y, ww, wh, capture_cb)) {
+            printf("%s 1/%d%s: window at %zu,%zu failed\n", img->name, 8 / scale, mode, x, y);
+            return 1;
+        }
+        for (size_t r = 0; r < wh; r++) {
+            if (memcmp(&win[r * ww], &full[(y + r) * w + x], ww * 2)) {
+                printf("%s 1/%d%s: window at %zu,%zu differs in row %zu\n", img->name, 8 / scale, mode, x, y, r);
+                return 1;
+            }
+        }
+    }
+    free(full);
+    free(ref);
+    free(win);
+    return 0;
+}
+
+static void bench(jpegd2_ctx_t *ctx, const image_t *img)
+{
+    static const int sizes[] = {60, 120, 240, 480, 960, 1920};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        int w = sizes[i] < img->width ? sizes[i] : img->width;
+        int h = sizes[i] < img->height ? sizes[i] : img->height;
+        size_t x = (img->width - w) / 2, y = (img->height - h) / 2;
+        double start = now_ms();
+        for (int r = 0; r < BENCH_RUNS; r++) {
+            draw_full(img, x, y, w, h);
+        }
+        double full = (now_ms() - start) / BENCH_RUNS;
+        start = now_ms();
+        for (int r = 0; r < BENCH_RUNS; r++) {
+            draw(ctx, img, 8, false, x, y, w, h, discard_cb);
+        }
+        double roi = (now_ms() - start) / BENCH_RUNS;
+        printf("%-26s %5dx%-5d %9.2f %9.2f %7.2fx\n", img->name, w, h, full, roi, full / roi);
+        if (w == img->width && h == img->height) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int check_mode = argc > 1 && !strcmp(argv[1], "--check");
+    int first = check_mode ? 2 : 1;
+    int count = argc - first;
+    image_t *images;
+    if (count > 0) {
+        images = calloc(count, sizeof(image_t));
+        for (int i = 0; i < count; i++) {
+            if (!load(&images[i], argv[first + i])) {
+                return 2;
+            }
+        }
+    } else {
+        count = 6;
+        images = calloc(count, sizeof(image_t));
+        generate(&images[0], 2048, 1536, 2, 2, false, false);
+        generate(&images[1], 2048, 1536, 1, 1, false, false);
+        generate(&images[2], 2048, 1536, 2, 2, true, false);
+        generate(&images[3], 4000, 3000, 2, 2, false, false);
+        generate(&images[4], 1001, 751, 2, 1, false, false);
+        generate(&images[5], 999, 667, 1, 1, false, true);
+    }
+
+    jpegd2_ctx_t *ctx = jpegd2_ctx_create();
+    int failed = 0;
+    if (!check_mode) {
+        printf("%-26s %11s %9s %9s %8s\n", "image", "window", "full ms", "roi ms", "speedup");
+    }
+    for (int i = 0; i < count; i++) {
+        if (check_mode) {
+            for (int dither = 0; dither < 2; dither++) {
+                failed |= check(ctx, &images[i], 8, dither);
+                failed |= check(ctx, &images[i], 2, dither);
+            }
+        } else {
+            bench(ctx, &images[i]);
+        }
+        free(images[i].data);
+    }
+    jpegd2_ctx_delete(ctx);
+    free(images);
+    if (check_mode) {
+        printf("%s\n", failed ? "FAILED" : "OK");
+    }
+    return failed;
+}
@@ -0,0 +1,347 @@
+/* Simulated RGB565 screen for the host build, see lcd_sim.h */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "lcd_sim.h"
+
+static const char *TAG = "lcd sim";
+
+#define LCD_SIM_CHECK(a, str, ret)  if(!(a)) {                                   \
+        ESP_LOGE(TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str);   \
+        return (ret);                                                           \
+    }
+
+/* scr_utility_fill_color sends the color from a buffer of this many pixels */
+#define LCD_SIM_FILL_BUF_PIXELS 512
+
+typedef struct {
+    lcd_sim_config_t conf;
+    uint16_t *fb;
+    scr_dir_t dir;
+    /* window of the last set_window and the next pixel written into it */
+    uint16_t x0, y0, x1, y1;
+    uint16_t cx, cy;
+    /* scroll area, screen row scroll_y + i shows memory row scroll_y + (i + scroll_start) % scroll_h */
+    uint16_t scroll_y, scroll_h, scroll_start;
+    /* buffer of the transfer started by an _async function */
+    const uint16_t *async_data;
+    size_t async_pixels;
+    uint32_t async_hash;
+    lcd_sim_stats_t stats;
+} lcd_sim_t;
+
+static lcd_sim_t s_sim;
+
+static uint32_t lcd_sim_fnv1a(const uint16_t *data, size_t pixels)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < pixels * 2; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+/**
+ * Account transactions carrying bytes in total. Every command, every parameter
+ * byte and every pixel write is one transaction in the ST7789 driver.
+ */
+static void lcd_sim_bus(uint32_t transactions, uint64_t bytes)
+{
+    double clocks;
+    switch (s_sim.conf.bus) {
+    case LCD_SIM_BUS_I8080_8:
+        clocks = bytes;
+        break;
+    case LCD_SIM_BUS_I8080_16:
+        clocks = (bytes + 1) / 2;
+        break;
+    default:
+        clocks = bytes * 8;
+        break;
+    }
+    s_sim.stats.transactions += transactions;
+    s_sim.stats.bytes += bytes;
+    s_sim.stats.bus_us += clocks * 1e6 / s_sim.conf.clock_hz + transactions * s_sim.conf.txn_us;
+}
+
+/* Like the interface, the pending transfer finishes before anything else is sent */
+static esp_err_t lcd_sim_draw_wait(void)
+{
+    if (s_sim.async_data) {
+        if (lcd_sim_fnv1a(s_sim.async_data, s_sim.async_pixels) != s_sim.async_hash) {
+            s_sim.stats.async_modified++;
+            ESP_LOGE(TAG, "buffer %p changed during the transfer", s_sim.async_data);
+        }
+        s_sim.async_data = NULL;
+    }
+    return ESP_OK;
+}
+
+static void lcd_sim_put(uint16_t color)
+{
+    s_sim.fb[s_sim.cy * s_sim.conf.width + s_sim.cx] = color;
+    s_sim.stats.pixels++;
+    /* the controller wraps around inside the window */
+    if (++s_sim.cx > s_sim.x1) {
+        s_sim.cx = s_sim.x0;
+        if (++s_sim.cy > s_sim.y1) {
+            s_sim.cy = s_sim.y0;
+        }
+    }
+}
+
+static esp_err_t lcd_sim_init(const scr_controller_config_t *lcd_conf)
+{
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_deinit(void)
+{
+    return lcd_sim_draw_wait();
+}
+
+static esp_err_t lcd_sim_set_direction(scr_dir_t dir)
+{
+    lcd_sim_draw_wait();
+    LCD_SIM_CHECK(SCR_DIR_LRTB == dir, "Only SCR_DIR_LRTB is simulated", ESP_ERR_NOT_SUPPORTED);
+    s_sim.dir = dir;
+    /* MADCTL and its parameter */
+    lcd_sim_bus(2, 2);
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    LCD_SIM_CHECK((x1 < s_sim.conf.width) && (y1 < s_sim.conf.height), "The set coordinates exceed the screen size", ESP_ERR_INVALID_ARG);
+    LCD_SIM_CHECK((x0 <= x1) && (y0 <= y1), "Window coordinates invalid", ESP_ERR_INVALID_ARG);
+    lcd_sim_draw_wait();
+    s_sim.x0 = s_sim.cx = x0;
+    s_sim.y0 = s_sim.cy = y0;
+    s_sim.x1 = x1;
+    s_sim.y1 = y1;
+    s_sim.stats.window_sets++;
+    /* CASET + 4, RASET + 4, RAMWR, one byte each */
+    lcd_sim_bus(11, 11);
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_write_ram_data(uint16_t color)
+{
+    lcd_sim_draw_wait();
+    lcd_sim_put(color);
+    lcd_sim_bus(1, 2);
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_draw_pixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    esp_err_t ret = lcd_sim_set_window(x, y, x, y);
+    if (ESP_OK != ret) {
+        return ESP_FAIL;
+    }
+    return lcd_sim_write_ram_data(color);
+}
+
+/* wire: the pixels are in bus order, high byte first if swap_data is set */
+static esp_err_t lcd_sim_write_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap,
+                                      bool wire, bool async)
+{
+    LCD_SIM_CHECK(NULL != bitmap, "bitmap pointer invalid", ESP_ERR_INVALID_ARG);
+    esp_err_t ret = lcd_sim_set_window(x, y, x + w - 1, y + h - 1);
+    if (ESP_OK != ret) {
+        return ESP_FAIL;
+    }
+    size_t len = (size_t)w * h;
+    bool swap = wire && s_sim.conf.swap_data;
+    for (size_t i = 0; i < len; i++) {
+        lcd_sim_put(swap ? (uint16_t)(bitmap[i] >> 8 | bitmap[i] << 8) : bitmap[i]);
+    }
+    lcd_sim_bus(1, 2 * len);
+    if (async) {
+        s_sim.async_data = bitmap;
+        s_sim.async_pixels = len;
+        s_sim.async_hash = lcd_sim_fnv1a(bitmap, len);
+        s_sim.stats.async_transfers++;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_draw_bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_sim_write_bitmap(x, y, w, h, bitmap, false, false);
+}
+
+static esp_err_t lcd_sim_draw_bitmap_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_sim_write_bitmap(x, y, w, h, bitmap, false, true);
+}
+
+static esp_err_t lcd_sim_draw_bitmap_wire(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_sim_write_bitmap(x, y, w, h, bitmap, true, false);
+}
+
+static esp_err_t lcd_sim_draw_bitmap_wire_async(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *bitmap)
+{
+    return lcd_sim_write_bitmap(x, y, w, h, bitmap, true, true);
+}
+
+static esp_err_t lcd_sim_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    LCD_SIM_CHECK(0 != w && 0 != h, "rectangle is empty", ESP_ERR_INVALID_ARG);
+    esp_err_t ret = lcd_sim_set_window(x, y, x + w - 1, y + h - 1);
+    if (ESP_OK != ret) {
+        return ESP_FAIL;
+    }
+    uint32_t len = (uint32_t)w * h;
+    for (uint32_t i = 0; i < len; i++) {
+        lcd_sim_put(color);
+    }
+    lcd_sim_bus((len + LCD_SIM_FILL_BUF_PIXELS - 1) / LCD_SIM_FILL_BUF_PIXELS, 2 * (uint64_t)len);
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_set_scroll_start(uint16_t start)
+{
+    LCD_SIM_CHECK(0 != s_sim.scroll_h, "no scroll area", ESP_ERR_INVALID_STATE);
+    LCD_SIM_CHECK(start < s_sim.scroll_h, "scroll start outside of the area", ESP_ERR_INVALID_ARG);
+    lcd_sim_draw_wait();
+    s_sim.scroll_start = start;
+    /* VSCRSADD + 2 */
+    lcd_sim_bus(3, 3);
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_set_scroll_area(uint16_t y, uint16_t h)
+{
+    LCD_SIM_CHECK(0 != h && y + h <= s_sim.conf.height, "scroll area outside of the screen", ESP_ERR_INVALID_ARG);
+    lcd_sim_draw_wait();
+    s_sim.scroll_y = y;
+    s_sim.scroll_h = h;
+    /* VSCRDEF + 6 */
+    lcd_sim_bus(7, 7);
+    return lcd_sim_set_scroll_start(0);
+}
+
+/* Memory row shown at screen row y */
+static const uint16_t *lcd_sim_shown_row(uint16_t y)
+{
+    if (y >= s_sim.scroll_y && y < s_sim.scroll_y + s_sim.scroll_h) {
+        y = s_sim.scroll_y + (y - s_sim.scroll_y + s_sim.scroll_start) % s_sim.scroll_h;
+    }
+    return &s_sim.fb[(size_t)y * s_sim.conf.width];
+}
+
+static esp_err_t lcd_sim_get_wire_swap(bool *swap)
+{
+    LCD_SIM_CHECK(NULL != swap, "swap pointer invalid", ESP_ERR_INVALID_ARG);
+    *swap = s_sim.conf.swap_data;
+    return ESP_OK;
+}
+
+static esp_err_t lcd_sim_get_info(scr_info_t *info)
+{
+    LCD_SIM_CHECK(NULL != info, "info pointer invalid", ESP_ERR_INVALID_ARG);
+    info->width = s_sim.conf.width;
+    info->height = s_sim.conf.height;
+    info->dir = s_sim.dir;
+    info->name = "Simulator";
+    info->color_type = SCR_COLOR_TYPE_RGB565;
+    info->bpp = 16;
+    return ESP_OK;
+}
+
+static const scr_driver_t s_lcd_sim_driver = {
+    .init = lcd_sim_init,
+    .deinit = lcd_sim_deinit,
+    .set_direction = lcd_sim_set_direction,
+    .set_window = lcd_sim_set_window,
+    .write_ram_data = lcd_sim_write_ram_data,
+    .draw_pixel = lcd_sim_draw_pixel,
+    .draw_bitmap = lcd_sim_draw_bitmap,
+    .fill_rect = lcd_sim_fill_rect,
+    .draw_bitmap_async = lcd_sim_draw_bitmap_async,
+    .draw_wait = lcd_sim_draw_wait,
+    .draw_bitmap_wire = lcd_sim_draw_bitmap_wire,
+    .draw_bitmap_wire_async = lcd_sim_draw_bitmap_wire_async,
+    .get_wire_swap = lcd_sim_get_wire_swap,
+    .set_scroll_area = lcd_sim_set_scroll_area,
+    .set_scroll_start = lcd_sim_set_scroll_start,
+    .get_info = lcd_sim_get_info,
+};
+
+esp_err_t lcd_sim_create(const lcd_sim_config_t *config, scr_driver_t *out_driver)
+{
+    LCD_SIM_CHECK(NULL != config && NULL != out_driver, "Pointer invalid", ESP_ERR_INVALID_ARG);
+    LCD_SIM_CHECK(config->width && config->height && config->clock_hz, "Invalid configuration", ESP_ERR_INVALID_ARG);
+    lcd_sim_delete();
+    s_sim.fb = calloc((size_t)config->width * config->height, sizeof(uint16_t));
+    LCD_SIM_CHECK(NULL != s_sim.fb, "No memory for the framebuffer", ESP_ERR_NO_MEM);
+    s_sim.conf = *config;
+    s_sim.dir = SCR_DIR_LRTB;
+    *out_driver = s_lcd_sim_driver;
+    if (!config->scroll) {
+        out_driver->set_scroll_area = NULL;
+        out_driver->set_scroll_start = NULL;
+    }
+    return ESP_OK;
+}
+
+void lcd_sim_delete(void)
+{
+    free(s_sim.fb);
+    memset(&s_sim, 0, sizeof(s_sim));
+}
+
+const uint16_t *lcd_sim_get_framebuffer(void)
+{
+    return s_sim.fb;
+}
+
+void lcd_sim_get_stats(lcd_sim_stats_t *stats)
+{
+    *stats = s_sim.stats;
+}
+
+void lcd_sim_reset_stats(void)
+{
+    memset(&s_sim.stats, 0, sizeof(s_sim.stats));
+}
+
+uint32_t lcd_sim_hash(void)
+{
+    /* FNV-1a over the rows in screen order */
+    uint32_t h = 2166136261u;
+    for (uint16_t y = 0; y < s_sim.conf.height; y++) {
+        const uint8_t *p = (const uint8_t *)lcd_sim_shown_row(y);
+        for (size_t i = 0; i < s_sim.conf.width * 2u; i++) {
+            h = (h ^ p[i]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+esp_err_t lcd_sim_dump_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    LCD_SIM_CHECK(NULL != f, "Failed to open the file", ESP_FAIL);
+    fprintf(f, "P6\n%u %u\n255\n", s_sim.conf.width, s_sim.conf.height);
+    size_t pixels = (size_t)s_sim.conf.width * s_sim.conf.height;
+    for (size_t i = 0; i < pixels; i++) {
+        uint16_t c = lcd_sim_shown_row(i / s_sim.conf.width)[i % s_sim.conf.width];
+        /* replicate the top bits into the low ones, 0x1F becomes 0xFF */
+        uint8_t rgb[3] = {
+            (c >> 8 & 0xF8) | (c >> 13),
+            (c >> 3 & 0xFC) | (c >> 9 & 0x03),
+            (c << 3 & 0xF8) | (c >> 2 & 0x07),
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    esp_err_t ret = ferror(f) ? ESP_FAIL : ESP_OK;
+    fclose(f);
+    LCD_SIM_CHECK(ESP_OK == ret, "Failed to write the file", ESP_FAIL);
+    return ESP_OK;
+}
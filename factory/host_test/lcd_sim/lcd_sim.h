@@ -0,0 +1,101 @@
+/* Simulated RGB565 screen for the host build
+
+   Implements every scr_driver_t function on a framebuffer in RAM, so the
+   painter, display_printf, the QR code page and the JPEG decoder run
+   unchanged on Linux. Each call is also counted as the bus transactions
+   the ST7789 driver would issue, which gives an estimate of the transfer
+   time on the board.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "screen_driver.h"
+
+typedef enum {
+    LCD_SIM_BUS_SPI,        /*!< 1 bit per clock, like the board */
+    LCD_SIM_BUS_I8080_8,    /*!< 8 bit parallel (I2S) */
+    LCD_SIM_BUS_I8080_16,   /*!< 16 bit parallel (I2S) */
+} lcd_sim_bus_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    lcd_sim_bus_t bus;
+    uint32_t clock_hz;      /*!< bus clock */
+    float txn_us;           /*!< fixed cost of one transaction: driver, mutex, DC line, DMA setup */
+    bool swap_data;         /*!< the interface swaps the bytes of every pixel, see get_wire_swap */
+    bool scroll;            /*!< vertical scrolling, set_scroll_area and set_scroll_start */
+} lcd_sim_config_t;
+
+/* The board: ST7789 240x240 on SPI2 at 40 MHz with swap_data */
+#define LCD_SIM_CONFIG_DEFAULT() { \
+        .width = 240, \
+        .height = 240, \
+        .bus = LCD_SIM_BUS_SPI, \
+        .clock_hz = 40000000, \
+        .txn_us = 5.0f, \
+        .swap_data = true, \
+        .scroll = true, \
+    }
+
+typedef struct {
+    uint32_t window_sets;       /*!< CASET/RASET/RAMWR sequences */
+    uint32_t transactions;      /*!< bus transactions, commands and data */
+    uint64_t bytes;             /*!< bytes on the bus, commands included */
+    uint64_t pixels;            /*!< pixels written to the screen */
+    uint32_t async_transfers;   /*!< transfers started by the _async functions */
+    uint32_t async_modified;    /*!< buffers changed before draw_wait, always a bug */
+    double bus_us;              /*!< estimated time on the bus */
+} lcd_sim_stats_t;
+
+/**
+ * @brief Create the simulated screen and get its driver
+ *
+ * Only one screen exists, creating it again replaces the previous one.
+ * The screen starts black, the driver's init function does nothing.
+ *
+ * @param config screen and bus model
+ * @param out_driver driver to pass to painter_init()
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG invalid configuration
+ *      - ESP_ERR_NO_MEM no memory for the framebuffer
+ */
+esp_err_t lcd_sim_create(const lcd_sim_config_t *config, scr_driver_t *out_driver);
+
+/**
+ * @brief Free the framebuffer
+ */
+void lcd_sim_delete(void);
+
+/**
+ * @brief Pixels in the controller memory, RGB565 row by row
+ *
+ * The rows of a scrolled area are shown in a different order, lcd_sim_hash()
+ * and lcd_sim_dump_ppm() use the screen order.
+ */
+const uint16_t *lcd_sim_get_framebuffer(void);
+
+/**
+ * @brief Counters since the last lcd_sim_reset_stats()
+ */
+void lcd_sim_get_stats(lcd_sim_stats_t *stats);
+
+void lcd_sim_reset_stats(void);
+
+/**
+ * @brief FNV-1a hash of the screen, compared by the regression test
+ */
+uint32_t lcd_sim_hash(void);
+
+/**
+ * @brief Write the screen as binary PPM (P6)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL the file can not be written
+ */
+esp_err_t lcd_sim_dump_ppm(const char *path);
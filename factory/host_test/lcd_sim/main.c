@@ -0,0 +1,678 @@
+/* Display scenes on the simulated screen
+
+   lcd_sim [options] [scene...]
+
+   -d DIR       write every scene as DIR/<scene>.ppm
+   -c FILE      compare the screen hashes with FILE, exit status 1 on a mismatch
+   -w FILE      write the screen hashes to FILE
+   -k HZ        bus clock, 40000000 by default
+   -t US        fixed cost of a bus transaction in us
+   -n           no byte swap on the bus
+   -s           no hardware scrolling
+
+   Each scene draws with the firmware's painter, display_printf, QR code page
+   or JPEG decoder and reports the bus traffic it caused. Without scene names
+   all scenes run. The framebuffer variant of the painter is built as
+   lcd_sim_fb, both must produce the same screens.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_timer.h"
+#include "lcd_sim.h"
+#include "display_painter.h"
+#include "display_printf.h"
+#include "display_widget.h"
+#include "jpegd2.h"
+#include "jpeglib.h"
+#include "icon_atlas_rle.h"
+#include "info_type.h"
+
+#define SCENE_JPEG_QUALITY 80
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+} scene_t;
+
+static const char *TAG = "lcd_sim";
+static scr_driver_t s_lcd;
+static bool s_scene_failed;     ///< Set by scenes that check more than the screen
+
+static void scene_shapes(void)
+{
+    painter_clear(COLOR_BLACK);
+    painter_draw_filled_rectangle(10, 10, 229, 59, COLOR_NAVY);
+    painter_draw_rectangle(10, 10, 229, 59, COLOR_WHITE);
+    for (int i = 0; i < 240; i += 16) {
+        painter_draw_line(0, 70, i, 169, COLOR_GREEN);
+        painter_draw_line(239, 70, 239 - i, 169, COLOR_ORANGE);
+    }
+    painter_draw_horizontal_line(0, 175, 240, COLOR_GRAY);
+    painter_draw_vertical_line(120, 60, 120, COLOR_GRAY);
+    painter_draw_filled_circle(60, 205, 30, COLOR_RED);
+    painter_draw_circle(180, 205, 30, COLOR_CYAN);
+    painter_draw_circle(180, 205, 20, COLOR_YELLOW);
+    painter_flush();
+}
+
+static void scene_text(void)
+{
+    const font_t *fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+    painter_clear(COLOR_BLACK);
+    int y = 0;
+    for (int i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        painter_draw_string(0, y, "Smart SD stick", fonts[i], COLOR_WHITE);
+        y += fonts[i]->Height;
+    }
+    painter_draw_num(0, y, 1234567, 7, &Font24, COLOR_GREEN);
+    y += Font24.Height;
+    painter_set_back_color(COLOR_NAVY);
+    painter_draw_string(0, y, "The quick brown fox jumps over the lazy dog", &Font16, COLOR_YELLOW);
+    painter_set_back_color(COLOR_BLACK);
+    painter_flush();
+}
+
+/* Proportional fonts, German text in UTF-8 and Latin-1, lines underlined with the measured width */
+static void scene_utf8(void)
+{
+    const font_t *fonts[] = {&Font8P, &Font12P, &Font16P, &Font20P, &Font24P};
+    painter_clear(COLOR_BLACK);
+    int y = 0;
+    for (int i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        const char *text = "Grüße, AVATAR Öl";
+        painter_draw_string(0, y, text, fonts[i], COLOR_WHITE);
+        painter_draw_horizontal_line(0, y + fonts[i]->Height - 1, painter_get_text_width(text, fonts[i]), COLOR_RED);
+        y += fonts[i]->Height;
+    }
+    painter_draw_string(0, y, "\xC4" "rger \xFC" "ber \xD6" "l", &Font16, COLOR_CYAN);
+    y += Font16.Height;
+    painter_draw_string(0, y, "The quick brown fox jumps over the lazy dog\nNächste Zeile: €", &Font16P, COLOR_YELLOW);
+    painter_flush();
+}
+
+static void scene_printf(void)
+{
+    display_printf_set_font(Font16);
+    display_printf_clear();
+    /* more lines than fit, the screen scrolls */
+    for (int i = 0; i < 16; i++) {
+        DISPLAY_PRINTFI(TAG, "line %d, %d%%", i, i * 100 / 15);
+    }
+    DISPLAY_PRINTFE(TAG, "error");
+    DISPLAY_PRINTFW(TAG, "warning");
+    /* crosses the row where the scrolled screen wraps around in memory */
+    painter_draw_rectangle(0, 0, 239, 239, COLOR_BLUE);
+    painter_flush();
+}
+
+static int s_widget_tick;
+
+static void scene_widget_value(char *buf, size_t len, void *arg)
+{
+    snprintf(buf, len, "%s %d", (const char *)arg, s_widget_tick * s_widget_tick % 1000);
+}
+
+static int scene_widget_level(void *arg)
+{
+    return s_widget_tick * 37 % DISPLAY_WIDGET_LEVEL_MAX;
+}
+
+static const uint16_t *scene_widget_image(void *arg)
+{
+    static uint16_t images[2][16 * 16];
+    for (int i = 0; i < 16 * 16; i++) {
+        images[0][i] = (i / 16 + i % 16) & 2 ? COLOR_RED : COLOR_WHITE;
+        images[1][i] = COLOR_GREEN;
+    }
+    return images[s_widget_tick / 4 & 1];
+}
+
+/* A telemetry page polled like the firmware does, only the updates are counted */
+static void scene_widgets(void)
+{
+    display_widget_t page[] = {
+        DISPLAY_WIDGET_LABEL_INIT(0, 0, &Font16P, COLOR_GREEN, "Telemetry"),
+        DISPLAY_WIDGET_VALUE_INIT(0, 20, 240, &Font16, COLOR_WHITE, scene_widget_value, "rate"),
+        DISPLAY_WIDGET_VALUE_INIT(0, 40, 240, &Font16P, COLOR_YELLOW, scene_widget_value, "free"),
+        DISPLAY_WIDGET_BAR_INIT(10, 64, 220, 12, COLOR_CYAN, scene_widget_level, NULL),
+        {
+            .type = DISPLAY_WIDGET_ICON, .x = 220, .y = 0, .width = 16, .height = 16,
+            .image_gen = scene_widget_image,
+        },
+        DISPLAY_WIDGET_LABEL_INIT(0, 220, &Font16, COLOR_BLUE, "Press OK"),
+    };
+    const size_t num = sizeof(page) / sizeof(page[0]);
+    page[2].align = DISPLAY_WIDGET_ALIGN_RIGHT;
+
+    s_widget_tick = 0;
+    display_widget_show(page, num, COLOR_BLACK);
+    lcd_sim_reset_stats();
+    int drawn = 0;
+    for (s_widget_tick = 1; s_widget_tick <= 10; s_widget_tick++) {
+        drawn += display_widget_refresh(page, num);
+        if (display_widget_refresh(page, num) != 0) {
+            printf("widgets: unchanged values drawn again\n");
+            s_scene_failed = true;
+        }
+    }
+    if (drawn != 10 * 3 + 2) {
+        printf("widgets: %d widgets drawn in 10 updates\n", drawn);
+        s_scene_failed = true;
+    }
+}
+
+/* The Wi-Fi page shown, left and shown again: the second time comes from the cache */
+static void scene_qr(void)
+{
+    const char *wifi = "WIFI:S:ESP-USB-DISK;T:WPA;P:12345678;H:false;";
+    painter_draw_qr_code(wifi);
+    painter_draw_qr_code("http://qr10.cn/Er5Bxj");
+    painter_draw_qr_code(wifi);
+    if (esp_qrcode_host_generated != 2) {
+        printf("qr: %d codes encoded for 2 texts\n", esp_qrcode_host_generated);
+        s_scene_failed = true;
+    }
+}
+
+/* Size of the APP1 block of the test image, like EXIF data it is skipped by the decoder */
+#define SCENE_JPEG_APP1_SIZE 12000
+
+/* A gradient with some edges, compressed with the IJG encoder, the pattern scales with the size */
+static uint8_t *scene_jpeg_encode(int w, int h, unsigned long *size)
+{
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    uint8_t *jpeg = NULL;
+    uint8_t *row = malloc(w * 3);
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &jpeg, size);
+    cinfo.image_width = w;
+    cinfo.image_height = h;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, SCENE_JPEG_QUALITY, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    uint8_t *app1 = calloc(1, SCENE_JPEG_APP1_SIZE);
+    jpeg_write_marker(&cinfo, JPEG_APP0 + 1, app1, SCENE_JPEG_APP1_SIZE);
+    free(app1);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        /* in a 240x240 square */
+        int y = cinfo.next_scanline * 240 / h;
+        for (int i = 0; i < w; i++) {
+            int x = i * 240 / w;
+            int dx = x - 120, dy = y - 120;
+            bool disc = dx * dx + dy * dy < 60 * 60;
+            row[3 * i] = disc ? 255 - x : x;
+            row[3 * i + 1] = y;
+            row[3 * i + 2] = ((x / 30 + y / 30) & 1) ? 200 : 40;
+        }
+        JSAMPROW p = row;
+        jpeg_write_scanlines(&cinfo, &p, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    free(row);
+    return jpeg;
+}
+
+/* top of the area scene_jpeg_draw() draws in */
+static int s_scene_jpeg_y;
+
+static bool scene_jpeg_draw(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data)
+{
+    return ESP_OK == s_lcd.draw_bitmap_wire_async(x, s_scene_jpeg_y + y, w, h, data);
+}
+
+static bool scene_jpeg_wait(void)
+{
+    return ESP_OK == s_lcd.draw_wait();
+}
+
+/* Stream source over the test image, short reads like a socket */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    size_t skipped;
+} scene_jpeg_stream_t;
+
+static int scene_jpeg_read(void *arg, uint8_t *buf, size_t len)
+{
+    scene_jpeg_stream_t *stream = arg;
+    size_t n = MIN(MIN(len, stream->size - stream->pos), 1000);
+    memcpy(buf, stream->data + stream->pos, n);
+    stream->pos += n;
+    return n;
+}
+
+static int scene_jpeg_skip(void *arg, size_t len)
+{
+    scene_jpeg_stream_t *stream = arg;
+    len = MIN(len, stream->size - stream->pos);
+    stream->pos += len;
+    stream->skipped += len;
+    return 0;
+}
+
+static void scene_jpeg(void)
+{
+    static uint8_t *jpeg;
+    static unsigned long size;
+    if (!jpeg) {
+        jpeg = scene_jpeg_encode(240, 240, &size);
+    }
+    uint8_t *buf = malloc(CONFIG_LCD_BUF_WIDTH * CONFIG_LCD_BUF_HIGHT * 2);
+    bool swap = false;
+    s_lcd.get_wire_swap(&swap);
+    const jpegd2_output_t out = {
+        .outbuffer = buf,
+        .outbuffer_width = CONFIG_LCD_BUF_WIDTH,
+        .outbuffer_height = CONFIG_LCD_BUF_HIGHT,
+        .lcd_cb = scene_jpeg_draw,
+        .wait_cb = scene_jpeg_wait,
+        .swap_output = swap,
+        .lcd_width = 240,
+        .lcd_height = 240,
+    };
+    /* a broken image must leave the context ready for the next one */
+    jpegd2_ctx_t *ctx = jpegd2_ctx_create();
+    jpegd2_set_source_mem(ctx, jpeg + 2, size - 2);
+    if (ESP_FAIL != jpegd2_draw(ctx, &out)) {
+        printf("jpeg: image without SOI marker decoded\n");
+        s_scene_failed = true;
+    }
+    /* the stream sources must decode the same pixels, the APP1 block is seeked over */
+    scene_jpeg_stream_t stream = {.data = jpeg, .size = size};
+    jpegd2_set_source_cb(ctx, scene_jpeg_read, scene_jpeg_skip, &stream);
+    if (ESP_OK != jpegd2_draw(ctx, &out) || stream.skipped < SCENE_JPEG_APP1_SIZE - 1000) {
+        printf("jpeg: callback source failed, %zu bytes skipped\n", stream.skipped);
+        s_scene_failed = true;
+    }
+    /* not seekable, the decoder reads and drops the block */
+    stream = (scene_jpeg_stream_t) {.data = jpeg, .size = size};
+    jpegd2_set_source_cb(ctx, scene_jpeg_read, NULL, &stream);
+    if (ESP_OK != jpegd2_draw(ctx, &out)) {
+        printf("jpeg: callback source without skip failed\n");
+        s_scene_failed = true;
+    }
+    FILE *file = tmpfile();
+    fwrite(jpeg, 1, size, file);
+    rewind(file);
+    jpegd2_set_source_file(ctx, file);
+    if (ESP_OK != jpegd2_draw(ctx, &out)) {
+        printf("jpeg: file source failed\n");
+        s_scene_failed = true;
+    }
+    fclose(file);
+    jpegd2_set_source_mem(ctx, jpeg, size);
+    if (ESP_OK != jpegd2_draw(ctx, &out)) {
+        printf("jpeg: decode failed\n");
+        s_scene_failed = true;
+    }
+    jpegd2_ctx_delete(ctx);
+    free(buf);
+}
+
+/* Photos larger than the screen, fitted: a landscape one whole in the top half, a portrait one filling the bottom half */
+static void scene_fit(void)
+{
+    static uint8_t *landscape, *portrait;
+    static unsigned long landscape_size, portrait_size;
+    if (!landscape) {
+        landscape = scene_jpeg_encode(1600, 1000, &landscape_size);
+        portrait = scene_jpeg_encode(600, 1600, &portrait_size);
+    }
+    uint8_t *buf = malloc(CONFIG_LCD_BUF_WIDTH * CONFIG_LCD_BUF_HIGHT * 2);
+    bool swap = false;
+    s_lcd.get_wire_swap(&swap);
+    jpegd2_output_t out = {
+        .outbuffer = buf,
+        .outbuffer_width = CONFIG_LCD_BUF_WIDTH,
+        .outbuffer_height = CONFIG_LCD_BUF_HIGHT,
+        .lcd_cb = scene_jpeg_draw,
+        .wait_cb = scene_jpeg_wait,
+        .swap_output = swap,
+        .lcd_width = 240,
+        .lcd_height = 120,
+        .fit = JPEGD2_FIT_CONTAIN,
+        .resample = JPEGD2_RESAMPLE_BILINEAR,
+    };
+    painter_clear(COLOR_BLACK);
+    painter_flush();
+    jpegd2_ctx_t *ctx = jpegd2_ctx_create();
+    jpegd2_set_source_mem(ctx, landscape, landscape_size);
+    if (ESP_OK != jpegd2_draw(ctx, &out)) {
+        printf("fit: contain failed\n");
+        s_scene_failed = true;
+    }
+    out.fit = JPEGD2_FIT_COVER;
+    out.resample = JPEGD2_RESAMPLE_NEAREST;
+    s_scene_jpeg_y = 120;
+    jpegd2_set_source_mem(ctx, portrait, portrait_size);
+    if (ESP_OK != jpegd2_draw(ctx, &out)) {
+        printf("fit: cover failed\n");
+        s_scene_failed = true;
+    }
+    s_scene_jpeg_y = 0;
+    jpegd2_ctx_delete(ctx);
+    free(buf);
+}
+
+/* An icon of the atlas: flat background, a disc and a gradient, drawn from its run-length encoding */
+static void scene_icon(void)
+{
+    enum { W = 120, H = 120 };
+    static uint16_t pixels[W * H];
+    static uint16_t rle[ICON_ATLAS_RLE_MAX_WORDS(W * H)];
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            int dx = x - W / 2, dy = y - H / 2;
+            uint16_t c = COLOR_NAVY;
+            if (dx * dx + dy * dy < 40 * 40) {
+                c = dy < 0 ? COLOR_ORANGE : (uint16_t)((x >> 2) << 11 | (y >> 1) << 5 | 0x1F);
+            }
+            pixels[y * W + x] = c;
+        }
+    }
+    size_t words = icon_atlas_rle_encode(pixels, W * H, rle);
+
+    painter_clear(COLOR_BLACK);
+    painter_draw_image(60, 60, W, H, pixels);
+    painter_flush();
+    uint32_t raw = lcd_sim_hash();
+
+    painter_clear(COLOR_BLACK);
+    painter_flush();
+    lcd_sim_reset_stats();
+    painter_draw_image_rle(60, 60, W, H, rle);
+    painter_flush();
+    if (lcd_sim_hash() != raw) {
+        printf("icon: run-length image differs from the raw one, %zu words\n", words);
+        s_scene_failed = true;
+    }
+}
+
+/* Kerning pairs that loosen or overlap more than a glyph, and right aligned proportional digits */
+static void scene_kern(void)
+{
+    static painter_font_data_t data;
+    static painter_font_kern_t kern[2];
+    data = *Font16P.data;
+    const painter_font_range_t *ascii = &data.ranges[0];
+    uint8_t a = ascii->glyph + 'A' - ascii->first;
+    uint8_t v = ascii->glyph + 'V' - ascii->first;
+    int a_w = data.advance[a];
+    int v_w = data.advance[v];
+    /* A V moves apart by 3, V A asks for more overlap than the glyphs have */
+    painter_font_kern_t loose = { a, v, 3 };
+    painter_font_kern_t tight = { v, a, -100 };
+    kern[0] = a < v ? loose : tight;
+    kern[1] = a < v ? tight : loose;
+    data.kerning = kern;
+    data.kerning_num = 2;
+    font_t font = Font16P;
+    font.data = &data;
+    int va_w = v_w + a_w - MIN(a_w, v_w);
+
+    painter_clear(COLOR_BLACK);
+    int width = painter_get_text_width("AVAVA", &font);
+    if (width != a_w + 2 * (3 + va_w)) {
+        printf("kern: AVAVA measured %d pixels, expected %d\n", width, a_w + 2 * (3 + va_w));
+        s_scene_failed = true;
+    }
+    painter_set_back_color(COLOR_NAVY);
+    painter_draw_string(0, 0, "AVAVA", &font, COLOR_WHITE);
+    painter_draw_num(0, 40, 1234567, 7, &Font16P, COLOR_GREEN);
+    painter_set_back_color(COLOR_BLACK);
+    painter_flush();
+    uint32_t drawn = lcd_sim_hash();
+
+    /* the same as A, VA, VA with navy gaps, and the digits as a string */
+    painter_clear(COLOR_BLACK);
+    painter_draw_filled_rectangle(0, 0, width - 1, Font16P.Height - 1, COLOR_NAVY);
+    painter_set_back_color(COLOR_NAVY);
+    painter_draw_string(0, 0, "A", &font, COLOR_WHITE);
+    painter_draw_string(a_w + 3, 0, "VA", &font, COLOR_WHITE);
+    painter_draw_string(a_w + 3 + va_w + 3, 0, "VA", &font, COLOR_WHITE);
+    /* painter_draw_num writes the first digit rightmost */
+    painter_draw_string(0, 40, "7654321", &Font16P, COLOR_GREEN);
+    painter_set_back_color(COLOR_BLACK);
+    painter_flush();
+    if (lcd_sim_hash() != drawn) {
+        printf("kern: kerned or numeric text differs from the pieces drawn apart\n");
+        s_scene_failed = true;
+    }
+}
+
+static const char *s_info_gen_text;
+
+static void scene_info_gen(char *buf, size_t len)
+{
+    snprintf(buf, len, "%s", s_info_gen_text);
+}
+
+/* Draw the expected lines of an info page one by one, y advances like the renderer */
+static uint32_t scene_info_expected(const char *const lines[][2], int num, int padding)
+{
+    painter_clear(COLOR_BLACK);
+    int y = 10;
+    for (int i = 0; i < num; i++) {
+        /* second column: x offset, "c" centers the line in the 100 pixel column */
+        int x = 10;
+        if (lines[i][1][0] == 'c') {
+            x += (100 - painter_get_text_width(lines[i][0], &Font16)) / 2;
+        }
+        painter_draw_string(x, y, lines[i][0], &Font16, COLOR_WHITE);
+        y += Font16.Height + padding;
+    }
+    painter_flush();
+    return lcd_sim_hash();
+}
+
+/* An info page, wrapped, truncated, split and UTF-8 text, and a generated
+ * paragraph whose new text must not reuse the cached line breaks */
+static void scene_info(void)
+{
+    static const info_paragraph_t paragraphs[] = {
+        { .text = "one two three four five", .wrap = true, .align = INFO_ALIGN_CENTER },
+        { .text = "truncated line here" },
+        { .text = "abcdefghijklmnopqrstuvwxyz", .wrap = true },
+        { .text = "Gr\xC3\xBC\xC3\x9F" "e \xC3\x96l \xC3\xBC" "ber", .wrap = true },
+        { .gen = scene_info_gen, .wrap = true },
+    };
+    const info_page_config_t page = {
+        .default_x = 10,
+        .default_y = 10,
+        .line_padding = 2,
+        .default_font = &Font16,
+        .default_color = COLOR_WHITE,
+        .max_width = 100,
+        .paragraphs = paragraphs,
+        .paragraphs_count = sizeof(paragraphs) / sizeof(paragraphs[0]),
+    };
+    /* Font16 is 11 pixels wide, 9 characters fit */
+    const char *const first[][2] = {
+        {"one two", "c"}, {"three", "c"}, {"four five", "c"},
+        {"truncated", ""},
+        {"abcdefghi", ""}, {"jklmnopqr", ""}, {"stuvwxyz", ""},
+        {"Gr\xC3\xBC\xC3\x9F" "e \xC3\x96l", ""}, {"\xC3\xBC" "ber", ""},
+        {"gen one", ""},
+    };
+    const char *const second[][2] = {
+        {"one two", "c"}, {"three", "c"}, {"four five", "c"},
+        {"truncated", ""},
+        {"abcdefghi", ""}, {"jklmnopqr", ""}, {"stuvwxyz", ""},
+        {"Gr\xC3\xBC\xC3\x9F" "e \xC3\x96l", ""}, {"\xC3\xBC" "ber", ""},
+        {"generated", ""}, {"again", ""}, {"text", ""},
+    };
+    int first_num = sizeof(first) / sizeof(first[0]);
+    int second_num = sizeof(second) / sizeof(second[0]);
+    uint32_t expected[2] = {
+        scene_info_expected(first, first_num, page.line_padding),
+        scene_info_expected(second, second_num, page.line_padding),
+    };
+    const char *gen_text[2] = {"gen one", "generated again text"};
+
+    /* a full buffer of short lines, 64 of them, each advancing y by one pixel */
+    static char many_text[INFO_MAX_LINE_BUF];
+    static const info_paragraph_t many = { .text = many_text };
+    for (int i = 0; i < INFO_MAX_LINE_BUF - 1; i++) {
+        many_text[i] = i % 2 ? '\n' : 'a';
+    }
+    info_page_config_t dense = page;
+    dense.line_padding = 1 - Font16.Height;
+    int16_t end = render_paragraph(10, 10, &dense, &many);
+    if (end != 10 + INFO_MAX_LINE_BUF / 2) {
+        printf("info: %d of %d short lines drawn\n", end - 10, INFO_MAX_LINE_BUF / 2);
+        s_scene_failed = true;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        s_info_gen_text = gen_text[i];
+        painter_clear(COLOR_BLACK);
+        lcd_sim_reset_stats();
+        render_info_page(&page);
+        painter_flush();
+        if (lcd_sim_hash() != expected[i]) {
+            printf("info: page %d differs from its lines drawn one by one\n", i + 1);
+            s_scene_failed = true;
+        }
+    }
+}
+
+static const scene_t s_scenes[] = {
+    {"shapes", scene_shapes},
+    {"text", scene_text},
+    {"utf8", scene_utf8},
+    {"printf", scene_printf},
+    {"widgets", scene_widgets},
+    {"qr", scene_qr},
+    {"jpeg", scene_jpeg},
+    {"fit", scene_fit},
+    {"icon", scene_icon},
+    {"kern", scene_kern},
+    {"info", scene_info},
+};
+
+/* Hash of the scene in FILE, 0 if it is not listed */
+static uint32_t expected_hash(FILE *f, const char *scene)
+{
+    char name[32];
+    unsigned hash;
+    rewind(f);
+    while (fscanf(f, "%31s %x", name, &hash) == 2) {
+        if (!strcmp(name, scene)) {
+            return hash;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    lcd_sim_config_t conf = LCD_SIM_CONFIG_DEFAULT();
+    const char *dump_dir = NULL;
+    FILE *check = NULL, *record = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "d:c:w:k:t:ns")) != -1) {
+        switch (opt) {
+        case 'd':
+            dump_dir = optarg;
+            break;
+        case 'c':
+            check = fopen(optarg, "r");
+            if (!check) {
+                perror(optarg);
+                return 2;
+            }
+            break;
+        case 'w':
+            record = fopen(optarg, "w");
+            if (!record) {
+                perror(optarg);
+                return 2;
+            }
+            break;
+        case 'k':
+            conf.clock_hz = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            conf.txn_us = strtof(optarg, NULL);
+            break;
+        case 'n':
+            conf.swap_data = false;
+            break;
+        case 's':
+            conf.scroll = false;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-d dir] [-c file] [-w file] [-k hz] [-t us] [-n] [-s] [scene...]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (ESP_OK != lcd_sim_create(&conf, &s_lcd) || ESP_OK != painter_init(&s_lcd)) {
+        return 2;
+    }
+
+    int failed = 0;
+    printf("%-7s %8s %8s %9s %9s %10s %8s\n", "scene", "windows", "txns", "bytes", "bus ms", "host ms", "hash");
+    for (int i = 0; i < sizeof(s_scenes) / sizeof(s_scenes[0]); i++) {
+        const scene_t *scene = &s_scenes[i];
+        bool selected = optind == argc;
+        for (int a = optind; a < argc; a++) {
+            selected |= !strcmp(argv[a], scene->name);
+        }
+        if (!selected) {
+            continue;
+        }
+
+        lcd_sim_reset_stats();
+        int64_t start = esp_timer_get_time();
+        scene->draw();
+        int64_t host_us = esp_timer_get_time() - start;
+        lcd_sim_stats_t st;
+        lcd_sim_get_stats(&st);
+        uint32_t hash = lcd_sim_hash();
+        printf("%-7s %8u %8u %9llu %9.2f %10.2f %08x\n", scene->name, st.window_sets, st.transactions,
+               (unsigned long long)st.bytes, st.bus_us / 1000, host_us / 1000.0, hash);
+
+        if (s_scene_failed) {
+            s_scene_failed = false;
+            failed = 1;
+        }
+        if (st.async_modified) {
+            printf("%s: %u buffers changed during their transfer\n", scene->name, st.async_modified);
+            failed = 1;
+        }
+        if (check && expected_hash(check, scene->name) != hash) {
+            printf("%s: expected %08x\n", scene->name, expected_hash(check, scene->name));
+            failed = 1;
+        }
+        if (record) {
+            fprintf(record, "%s %08x\n", scene->name, hash);
+        }
+        if (dump_dir) {
+            char path[256];
+            snprintf(path, sizeof(path), "%s/%s.ppm", dump_dir, scene->name);
+            lcd_sim_dump_ppm(path);
+        }
+    }
+
+    if (check) {
+        fclose(check);
+    }
+    if (record) {
+        fclose(record);
+    }
+    lcd_sim_delete();
+    return failed;
+}
@@ -0,0 +1,63 @@
+/* esp_qrcode accessors for the host build
+
+   The QR code component is not built on the host. A handle points to the
+   module count followed by one byte per module, row by row, which is all
+   painter_draw_qr_code_v10 reads.
+
+   esp_qrcode_generate() does not encode the text. Every text gives the same
+   version 3 sized field with finder patterns and random modules, enough to
+   time drawing and to count how often the painter asks for a code.
+*/
+
+#include <stdint.h>
+#include "qrcode.h"
+
+int esp_qrcode_host_generated;
+
+esp_err_t esp_qrcode_generate(esp_qrcode_config_t *cfg, const char *text)
+{
+    enum { SIZE = 29 };
+    uint8_t qr[1 + SIZE * SIZE] = { SIZE };
+    uint32_t seed = 1;
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            seed = seed * 1103515245 + 12345;
+            qr[1 + y * SIZE + x] = seed >> 30 & 1;
+        }
+    }
+    const int corners[3][2] = {{0, 0}, {SIZE - 7, 0}, {0, SIZE - 7}};
+    for (int i = 0; i < 3; i++) {
+        for (int y = -1; y < 8; y++) {
+            for (int x = -1; x < 8; x++) {
+                int mx = corners[i][0] + x, my = corners[i][1] + y;
+                if (mx < 0 || my < 0 || mx >= SIZE || my >= SIZE) {
+                    continue;
+                }
+                int ring = x < 0 || y < 0 || x > 6 || y > 6 ? 0 : (x == 0 || y == 0 || x == 6 || y == 6) ? 1 :
+                           (x == 1 || y == 1 || x == 5 || y == 5) ? 0 : 1;
+                qr[1 + my * SIZE + mx] = ring;
+            }
+        }
+    }
+    esp_qrcode_host_generated++;
+    cfg->display_func(qr);
+    return ESP_OK;
+}
+
+void esp_qrcode_print_console(esp_qrcode_handle_t qrcode)
+{
+}
+
+int esp_qrcode_get_size(esp_qrcode_handle_t qrcode)
+{
+    return qrcode[0];
+}
+
+bool esp_qrcode_get_module(esp_qrcode_handle_t qrcode, int x, int y)
+{
+    int size = qrcode[0];
+    if (x < 0 || y < 0 || x >= size || y >= size) {
+        return false;
+    }
+    return qrcode[1 + y * size + x];
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA          (1 << 3)
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+#define MALLOC_CAP_DEFAULT      (1 << 12)
+
+/* Like the board, no PSRAM: SPIRAM requests fail and callers fall back */
+static inline void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : malloc(size);
+}
+
+static inline void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : calloc(n, size);
+}
+
+static inline void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+/* No capability heaps on the host, /metrics skips heaps with zero size */
+static inline size_t heap_caps_get_total_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_free_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_minimum_free_size(uint32_t caps) { return 0; }
+static inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 0; }
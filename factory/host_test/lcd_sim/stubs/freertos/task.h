@@ -0,0 +1,30 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+/* There are no tasks, the display server draws in the calling thread */
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                                 uint32_t prio, TaskHandle_t *task, BaseType_t core)
+{
+    return pdFAIL;
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return pdPASS;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    return 0;
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+}
@@ -0,0 +1,26 @@
+/* Subset of the esp_qrcode API the painter uses, see qrcode_host.c */
+#pragma once
+
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef const uint8_t *esp_qrcode_handle_t;
+
+enum {
+    ESP_QRCODE_ECC_LOW,
+};
+
+typedef struct {
+    void (*display_func)(esp_qrcode_handle_t qrcode);
+    int max_qrcode_version;
+    int qrcode_ecc_level;
+} esp_qrcode_config_t;
+
+/* Texts encoded by esp_qrcode_generate() so far */
+extern int esp_qrcode_host_generated;
+
+esp_err_t esp_qrcode_generate(esp_qrcode_config_t *cfg, const char *text);
+
+void esp_qrcode_print_console(esp_qrcode_handle_t qrcode);
+int esp_qrcode_get_size(esp_qrcode_handle_t qrcode);
+bool esp_qrcode_get_module(esp_qrcode_handle_t qrcode, int x, int y);
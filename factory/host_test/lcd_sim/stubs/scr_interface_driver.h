@@ -0,0 +1,9 @@
+/* The simulator replaces the controller and its interface, screen_driver.h
+ * only needs the type */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef struct scr_interface_driver_t scr_interface_driver_t;
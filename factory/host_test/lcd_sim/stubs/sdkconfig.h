@@ -0,0 +1,16 @@
+/* Configuration of the host build, mirrors the defaults of the firmware */
+#pragma once
+
+#define CONFIG_PAINTER_GLYPH_CACHE_ENTRIES 32
+#define CONFIG_COLOR_SPACE_RGB_565 1
+#define CONFIG_JPEGD2_INPUT_BUFFER_SIZE 4096
+#define CONFIG_LCD_BUF_WIDTH 240
+#define CONFIG_LCD_BUF_HIGHT 48
+
+/* set by CMakeLists.txt for the framebuffer variant */
+#ifdef LCD_SIM_FRAMEBUFFER
+#define CONFIG_PAINTER_FRAMEBUFFER_ENABLE 1
+#define CONFIG_PAINTER_FRAMEBUFFER_PREFER_PSRAM 1
+#define CONFIG_PAINTER_FRAMEBUFFER_DIRTY_RECTS 8
+#define CONFIG_PAINTER_FRAMEBUFFER_FLUSH_BUF_SIZE 16384
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdbool.h>
+
+/* heap_caps_malloc never returns PSRAM on the host */
+static inline bool esp_ptr_dma_capable(const void *p)
+{
+    return true;
+}
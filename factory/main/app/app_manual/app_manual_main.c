@@ -38,18 +38,27 @@ static EventGroupHandle_t s_event_group_hdl = NULL;
 static char *contact_us = "http://qr10.cn/Er5Bxj";
 static char *user_guide = "http://qr10.cn/FuIsa1";
 
-static void display_info(int page_index)
+/* Drawn by the display task, the QR code and the caption in one command */
+static void _draw_page(void *arg)
 {
-    esp_qrcode_config_t qr_cfg = PAINTER_QRCODE_CONFIG_DEFAULT();
-    DISPLAY_PRINTF_CLEAR();
+    int page_index = *(int *)arg;
+    font_t font = display_printf_get_font();
+    display_printf_draw_clear();
     if (page_index == 0) { //main infomation
-        esp_qrcode_generate(&qr_cfg, contact_us);
-        DISPLAY_PRINTF_LINE("SD", 14, COLOR_RED, "      Contact US");
+        painter_draw_qr_code(contact_us);
+        display_printf_draw_line(&font, 14, COLOR_RED, "      Contact US");
     } else if (page_index == 1) {
-        esp_qrcode_generate(&qr_cfg, user_guide);
-        DISPLAY_PRINTF_LINE("SD", 14, COLOR_RED, "      User Guide");
-    } else {
-        DISPLAY_PRINTF_CLEAR();
+        painter_draw_qr_code(user_guide);
+        display_printf_draw_line(&font, 14, COLOR_RED, "      User Guide");
+    }
+    painter_flush();
+}
+
+static void display_info(int page_index)
+{
+    /* a page still queued is replaced when the buttons are pressed quickly */
+    if (display_server_call(1, _draw_page, &page_index, sizeof(page_index)) != ESP_OK) {
+        ESP_LOGW(TAG, "display queue full, page %d not shown", page_index);
     }
 }
 
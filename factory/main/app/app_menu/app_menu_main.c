@@ -26,6 +26,8 @@
 #include "hal/usb_hal.h"
 
 #include "jpegd2.h"
+#include "display_server.h"
+#include "icon_atlas.h"
 #include "app.h"
 #include "bsp_esp32_s3_usb_otg_ev.h"
 
@@ -34,7 +36,6 @@ static char *TAG = "app_menu";
 #define CONFIG_LCD_BUF_HIGHT 48
 
 #define DEMO_SPI_MAX_TRANFER_SIZE (CONFIG_LCD_BUF_WIDTH * CONFIG_LCD_BUF_HIGHT * 2 + 64)
-#define PIC_JPEG_MAX_SIZE (45 * 1024)
 
 #define EVENT_TASK_KILL_BIT_0	( 1 << 0 )
 #define EVENT_TASK_KILLED_BIT_1	( 1 << 1 )
@@ -44,6 +45,48 @@ QueueHandle_t g_app_menu_queue_hdl = NULL;
 static TaskHandle_t s_task_hdl = NULL;
 static EventGroupHandle_t s_event_group_hdl = NULL;
 
+/* Icons are drawn from the atlas partition, the JPEG in SPIFFS is only decoded when the atlas was not flashed */
+static void _show_icon(const char *icon_name)
+{
+    esp_err_t ret = icon_atlas_draw(icon_name, 0, 0);
+    if (ret != ESP_ERR_NOT_FOUND) {
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "icon %s not drawn: %s", icon_name, esp_err_to_name(ret));
+        }
+        return;
+    }
+
+    char file_name[64] = {0};
+    snprintf(file_name, sizeof(file_name), "/spiffs/icon/%s", icon_name);
+    FILE *fd = fopen(file_name, "r");
+    if (fd == NULL) {
+        ESP_LOGE(TAG, "open %s filed ", file_name);
+        return;
+    }
+    /* malloc a buffer for RGB565 data, as 320*240*2 = 153600B,
+    here malloc a smaller buffer refresh lcd with steps */
+    uint8_t *lcd_buffer = (uint8_t *)heap_caps_malloc(DEMO_SPI_MAX_TRANFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    /* the file is streamed into the decoder, it is never read whole */
+    jpegd2_ctx_t *jpeg = jpegd2_ctx_create();
+    if (lcd_buffer != NULL && jpeg != NULL && jpegd2_set_source_file(jpeg, fd) == ESP_OK) {
+        const jpegd2_output_t out = {
+            .outbuffer = lcd_buffer,
+            .outbuffer_width = CONFIG_LCD_BUF_WIDTH,
+            .outbuffer_height = CONFIG_LCD_BUF_HIGHT,
+            .lcd_cb = display_server_strip_cb,
+            .wait_cb = display_server_wait_cb,
+            .swap_output = display_server_wire_swap(),
+            .lcd_width = 240,
+            .lcd_height = 240,
+        };
+        esp_err_t ret = jpegd2_draw(jpeg, &out);
+        ESP_LOGI(TAG, "file_name: %s, %s, free_heap: %d", file_name, esp_err_to_name(ret), esp_get_free_heap_size());
+    }
+    jpegd2_ctx_delete(jpeg);
+    fclose(fd);
+    free(lcd_buffer);
+}
+
 void app_menu_task( void *pvParameters )
 {
     iot_board_usb_set_mode(USB_DEVICE_MODE);
@@ -65,26 +108,11 @@ void app_menu_task( void *pvParameters )
 
     ESP_ERROR_CHECK(esp_vfs_spiffs_register(&spiffs_config));
 
-    /* malloc a buffer for RGB565 data, as 320*240*2 = 153600B,
-    here malloc a smaller buffer refresh lcd with steps */
-    uint8_t *lcd_buffer = (uint8_t *)heap_caps_malloc(DEMO_SPI_MAX_TRANFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    assert(lcd_buffer != NULL);
-
-    uint8_t *jpeg_buf = malloc(PIC_JPEG_MAX_SIZE);
-    assert(jpeg_buf != NULL);
-    char file_name[64] = {0};
-
     g_app_menu_queue_hdl = xQueueCreate( 5, sizeof(hmi_event_t));
     assert(g_app_menu_queue_hdl != NULL);
 
     if (s_driver_index >= 0 && s_driver_index < _app_driver_count) {
-        sprintf(file_name, "/spiffs/icon/%s", _app_driver[s_driver_index].icon_name);
-        FILE *fd = fopen(file_name, "r");
-        if (fd != NULL) {
-            int read_bytes = fread(jpeg_buf, 1, PIC_JPEG_MAX_SIZE, fd);
-            fclose(fd);
-            mjpegdraw(jpeg_buf, read_bytes, lcd_buffer, CONFIG_LCD_BUF_WIDTH, CONFIG_LCD_BUF_HIGHT, board_lcd_draw_image, 240, 240);
-        }
+        _show_icon(_app_driver[s_driver_index].icon_name);
         display_current = s_driver_index;
     }
 
@@ -103,25 +131,13 @@ void app_menu_task( void *pvParameters )
                 break;
         }
         if(display_current == s_driver_index) continue;
-        sprintf(file_name, "/spiffs/icon/%s", _app_driver[s_driver_index].icon_name);
-
-        FILE *fd = fopen(file_name, "r");
-        if (fd == NULL) {
-            ESP_LOGE(TAG, "open %s filed ", file_name);
-            continue;
-        }
-        int read_bytes = fread(jpeg_buf, 1, PIC_JPEG_MAX_SIZE, fd);
-        fclose(fd);
-        mjpegdraw(jpeg_buf, read_bytes, lcd_buffer, CONFIG_LCD_BUF_WIDTH, CONFIG_LCD_BUF_HIGHT, board_lcd_draw_image, 240, 240);
+        _show_icon(_app_driver[s_driver_index].icon_name);
         display_current = s_driver_index;
-        ESP_LOGI(TAG, "file_name: %s, fd: %p, read_bytes: %d, free_heap: %d", file_name, fd, read_bytes, esp_get_free_heap_size());
     }
 
     QueueHandle_t queue_hdl = g_app_menu_queue_hdl;
     g_app_menu_queue_hdl = NULL;
     vQueueDelete(queue_hdl);
-    free(lcd_buffer);
-    free(jpeg_buf);
     esp_vfs_spiffs_unregister(NULL);
     xEventGroupSetBits(event_group_hdl, EVENT_TASK_KILLED_BIT_1);
     xEventGroupClearBits(event_group_hdl, EVENT_TASK_KILL_BIT_0);
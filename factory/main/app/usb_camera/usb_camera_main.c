@@ -70,7 +70,6 @@ then hardcode the related MACROS below
 #endif
 
 #ifdef CONFIG_BOOT_ANIMATION
-#define BOOT_ANIMATION_MAX_SIZE (45 * 1024)
 #endif
 
 #define DEMO_SPI_MAX_TRANFER_SIZE (CONFIG_LCD_BUF_WIDTH * CONFIG_LCD_BUF_HIGHT * 2 + 64)
@@ -102,16 +101,23 @@ static void *_malloc(size_t size)
  * This callback function runs once per frame. Use it to perform any
  * quick processing you need, or have it put the frame into your application's
  * input queue. If this function takes too long, you'll start losing frames. */
+/* One decoder for the whole stream, set up once instead of for every frame */
+typedef struct {
+    jpegd2_ctx_t *jpeg;
+    jpegd2_output_t out;
+} camera_decode_t;
+
 static void frame_cb(uvc_frame_t *frame, void *ptr)
 {
     assert(ptr);
-    uint8_t *lcd_buffer = (uint8_t *)(ptr);
+    camera_decode_t *decode = (camera_decode_t *)(ptr);
     ESP_LOGV(TAG, "callback! frame_format = %d, seq = %u, width = %d, height = %d, length = %u, ptr = %d",
              frame->frame_format, frame->sequence, frame->width, frame->height, frame->data_bytes, (int) ptr);
 
     switch (frame->frame_format) {
     case UVC_FRAME_FORMAT_MJPEG:
-        mjpegdraw(frame->data, frame->data_bytes, lcd_buffer, CONFIG_LCD_BUF_WIDTH, CONFIG_LCD_BUF_HIGHT, board_lcd_draw_image, 240, 240);
+        jpegd2_set_source_mem(decode->jpeg, frame->data, frame->data_bytes);
+        jpegd2_draw(decode->jpeg, &decode->out);
         // vTaskDelay(10 / portTICK_PERIOD_MS); /* add delay to free cpu to other tasks */
         break;
     default:
@@ -163,18 +169,32 @@ void usb_camera_task(void *pvParameters)
 
     ESP_ERROR_CHECK(esp_vfs_spiffs_register(&spiffs_config));
 
-    uint8_t *jpeg_buf = malloc(BOOT_ANIMATION_MAX_SIZE);
-    assert(jpeg_buf != NULL);
+    /* the frames are streamed from the files, one decoder for all of them */
+    jpegd2_ctx_t *boot_jpeg = jpegd2_ctx_create();
+    assert(boot_jpeg != NULL);
+    const jpegd2_output_t boot_out = {
+        .outbuffer = lcd_buffer,
+        .outbuffer_width = CONFIG_LCD_BUF_WIDTH,
+        .outbuffer_height = CONFIG_LCD_BUF_HIGHT,
+        .lcd_cb = lcd_write_bitmap,
+        .lcd_width = 240,
+        .lcd_height = 240,
+    };
     for (size_t i = 10; i <= 80; i += 2) {
         char file_name[64] = {0};
         sprintf(file_name, "/spiffs/video/r%03d.jpg", i);
         FILE *fd = fopen(file_name, "r");
-        int read_bytes = fread(jpeg_buf, 1, BOOT_ANIMATION_MAX_SIZE, fd);
+        if (fd == NULL) {
+            continue;
+        }
+        esp_err_t ret = jpegd2_set_source_file(boot_jpeg, fd);
+        if (ret == ESP_OK) {
+            ret = jpegd2_draw(boot_jpeg, &boot_out);
+        }
         fclose(fd);
-        mjpegdraw(jpeg_buf, read_bytes, lcd_buffer, CONFIG_LCD_BUF_WIDTH, CONFIG_LCD_BUF_HIGHT, lcd_write_bitmap, 240, 240);
-        ESP_LOGD(TAG, "file_name: %s, fd: %p, read_bytes: %d, free_heap: %d", file_name, fd, read_bytes, esp_get_free_heap_size());
+        ESP_LOGD(TAG, "file_name: %s, %s, free_heap: %d", file_name, esp_err_to_name(ret), esp_get_free_heap_size());
     }
-    free(jpeg_buf);
+    jpegd2_ctx_delete(boot_jpeg);
 #endif
 
     /* malloc double buffer for usb payload, xfer_buffer_size >= frame_buffer_size*/
@@ -187,6 +207,21 @@ void usb_camera_task(void *pvParameters)
     uint8_t *frame_buffer = (uint8_t *)_malloc(DEMO_XFER_BUFFER_SIZE);
     assert(frame_buffer != NULL);
 
+    camera_decode_t decode = {
+        .jpeg = jpegd2_ctx_create(),
+        .out = {
+            .outbuffer = lcd_buffer,
+            .outbuffer_width = CONFIG_LCD_BUF_WIDTH,
+            .outbuffer_height = CONFIG_LCD_BUF_HIGHT,
+            .lcd_cb = display_server_strip_cb,
+            .wait_cb = display_server_wait_cb,
+            .swap_output = display_server_wire_swap(),
+            .lcd_width = 240,
+            .lcd_height = 240,
+        },
+    };
+    assert(decode.jpeg != NULL);
+
     /* the quick demo skip the standred get descriptors process,
     users need to get params from camera descriptors from PC side,
     eg. run `lsusb -v` in linux, then modify related MACROS */
@@ -200,7 +235,7 @@ void usb_camera_task(void *pvParameters)
         .frame_buffer_size = DEMO_XFER_BUFFER_SIZE,
         .frame_buffer = frame_buffer,
         .frame_cb = frame_cb,
-        .frame_cb_arg = (void *)(lcd_buffer),
+        .frame_cb_arg = (void *)(&decode),
     };
 
     /* pre-config UVC driver with params from known USB Camera Descriptors*/
@@ -236,6 +271,7 @@ void usb_camera_task(void *pvParameters)
     g_usb_camera_queue_hdl = NULL;
     vQueueDelete(queue_hdl);
     usb_streaming_stop();
+    jpegd2_ctx_delete(decode.jpeg);
     free(lcd_buffer);
     free(xfer_buffer_a);
     free(xfer_buffer_b);
@@ -0,0 +1,262 @@
+/* Throughput benchmark endpoints of the HTTP file server
+
+   POST /bench/sink                         discard the request body
+   GET  /bench/source?bytes=N               stream N bytes from a RAM pattern
+   GET  /bench/source                       timings of the last source run
+   GET  /bench/sd?op=read|write&size=&bs=   storage only, no network, the file is removed after each run
+
+   All runs go through the same httpd task as the file handlers, so comparing
+   sink/source with sd tells whether a slow transfer is limited by the
+   network stack or by the card. Results are reported as JSON.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/param.h>
+#include <sys/unistd.h>
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_vfs.h"
+#include "esp_http_server.h"
+#include "bench_server.h"
+
+#if CONFIG_HTTP_BENCH_ENABLE
+
+#define BENCH_NET_BUFSIZE 8192
+#define BENCH_FILE_NAME "/.bench.bin"
+
+typedef struct {
+    const char *test;
+    uint32_t bytes;
+    uint32_t block;
+    int64_t total_us;   /* whole run, as seen by the handler */
+    int64_t io_us;      /* spent inside recv/send or fread/fwrite */
+} bench_result_t;
+
+static const char *TAG = "bench";
+static char s_bench_path[ESP_VFS_PATH_MAX + sizeof(BENCH_FILE_NAME)];
+static bench_result_t s_last_source;
+
+static esp_err_t bench_resp_json(httpd_req_t *req, const bench_result_t *r)
+{
+    char json[200];
+    uint32_t kib_per_s = r->total_us ? (uint32_t)((uint64_t)r->bytes * 1000000 / 1024 / r->total_us) : 0;
+    snprintf(json, sizeof(json), "{\"test\":\"%s\",\"bytes\":%u,\"block\":%u,\"us\":%lld,\"io_us\":%lld,\"kib_per_s\":%u}",
+             r->test, r->bytes, r->block, (long long)r->total_us, (long long)r->io_us, kib_per_s);
+    ESP_LOGI(TAG, "%s", json);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_sendstr(req, json);
+}
+
+/* Unsigned query parameter, def if absent */
+static uint32_t bench_query_u32(const char *query, const char *key, uint32_t def)
+{
+    char value[16];
+    if (!query || httpd_query_key_value(query, key, value, sizeof(value)) != ESP_OK) {
+        return def;
+    }
+    return strtoul(value, NULL, 0);
+}
+
+static esp_err_t bench_sink_handler(httpd_req_t *req)
+{
+    if (req->content_len > CONFIG_HTTP_BENCH_MAX_BYTES) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Body too large");
+        return ESP_FAIL;
+    }
+    char *buf = malloc(BENCH_NET_BUFSIZE);
+    if (!buf) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "No memory");
+        return ESP_FAIL;
+    }
+
+    bench_result_t r = { .test = "sink", .bytes = req->content_len, .block = BENCH_NET_BUFSIZE };
+    size_t remaining = req->content_len;
+    int64_t start = esp_timer_get_time();
+    while (remaining > 0) {
+        int64_t t = esp_timer_get_time();
+        int received = httpd_req_recv(req, buf, MIN(remaining, BENCH_NET_BUFSIZE));
+        r.io_us += esp_timer_get_time() - t;
+        if (received == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (received <= 0) {
+            free(buf);
+            ESP_LOGE(TAG, "sink aborted, %u bytes left", (unsigned)remaining);
+            return ESP_FAIL;
+        }
+        remaining -= received;
+    }
+    r.total_us = esp_timer_get_time() - start;
+    free(buf);
+    return bench_resp_json(req, &r);
+}
+
+static esp_err_t bench_source_handler(httpd_req_t *req)
+{
+    char query[64];
+    bool has_query = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK;
+    uint32_t bytes = bench_query_u32(has_query ? query : NULL, "bytes", 0);
+    if (bytes == 0) {
+        /* the streamed body carries no timings, they are fetched afterwards */
+        if (!s_last_source.test) {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No source run yet, use ?bytes=N");
+            return ESP_FAIL;
+        }
+        return bench_resp_json(req, &s_last_source);
+    }
+    if (bytes > CONFIG_HTTP_BENCH_MAX_BYTES) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "bytes too large");
+        return ESP_FAIL;
+    }
+
+    char *buf = malloc(BENCH_NET_BUFSIZE);
+    if (!buf) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "No memory");
+        return ESP_FAIL;
+    }
+    for (int i = 0; i < BENCH_NET_BUFSIZE; i++) {
+        buf[i] = 'A' + i % 26;
+    }
+
+    bench_result_t r = { .test = "source", .bytes = bytes, .block = BENCH_NET_BUFSIZE };
+    httpd_resp_set_type(req, "application/octet-stream");
+    int64_t start = esp_timer_get_time();
+    uint32_t remaining = bytes;
+    while (remaining > 0) {
+        size_t len = MIN(remaining, BENCH_NET_BUFSIZE);
+        int64_t t = esp_timer_get_time();
+        esp_err_t ret = httpd_resp_send_chunk(req, buf, len);
+        r.io_us += esp_timer_get_time() - t;
+        if (ret != ESP_OK) {
+            free(buf);
+            ESP_LOGE(TAG, "source aborted, %u bytes left", remaining);
+            return ESP_FAIL;
+        }
+        remaining -= len;
+    }
+    httpd_resp_send_chunk(req, NULL, 0);
+    r.total_us = esp_timer_get_time() - start;
+    free(buf);
+    s_last_source = r;
+    ESP_LOGI(TAG, "source %u bytes in %lld us", bytes, (long long)r.total_us);
+    return ESP_OK;
+}
+
+/* One timed pass over the bench file, NULL on success or what failed */
+static const char *bench_sd_pass(bool write, char *buf, uint32_t size, uint32_t bs, bench_result_t *r)
+{
+    int64_t start = esp_timer_get_time();
+    FILE *fd = fopen(s_bench_path, write ? "wb" : "rb");
+    if (!fd) {
+        return "Failed to open bench file";
+    }
+    /* the test picks the block size, not stdio */
+    setvbuf(fd, NULL, _IONBF, 0);
+
+    uint32_t remaining = size;
+    while (remaining > 0) {
+        size_t len = MIN(remaining, bs);
+        int64_t t = esp_timer_get_time();
+        size_t done = write ? fwrite(buf, 1, len, fd) : fread(buf, 1, len, fd);
+        r->io_us += esp_timer_get_time() - t;
+        if (done != len) {
+            fclose(fd);
+            return "Storage I/O failed";
+        }
+        remaining -= len;
+    }
+    /* closing flushes the FAT and directory entry, part of the write cost */
+    fclose(fd);
+    r->total_us = esp_timer_get_time() - start;
+    return NULL;
+}
+
+/* Runs in the httpd task and blocks it for the duration of the test,
+ * which is the point: nothing else competes for the card meanwhile.
+ * Every run starts and ends without the bench file, a read writes it
+ * first (untimed), so nothing is left on the user's card. */
+static esp_err_t bench_sd_handler(httpd_req_t *req)
+{
+    char query[64];
+    char op[8] = "";
+    bool has_query = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK;
+    if (has_query) {
+        httpd_query_key_value(query, "op", op, sizeof(op));
+    }
+    uint32_t size = bench_query_u32(has_query ? query : NULL, "size", 1024 * 1024);
+    uint32_t bs = bench_query_u32(has_query ? query : NULL, "bs", 4096);
+    bool write = !strcmp(op, "write");
+    if (!write && strcmp(op, "read")) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "op must be read or write");
+        return ESP_FAIL;
+    }
+    if (size == 0 || size > CONFIG_HTTP_BENCH_MAX_BYTES || bs == 0 || bs > CONFIG_HTTP_BENCH_MAX_BLOCK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "size or bs out of range");
+        return ESP_FAIL;
+    }
+
+    char *buf = malloc(bs);
+    if (!buf) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "No memory");
+        return ESP_FAIL;
+    }
+    memset(buf, 0x5A, bs);
+
+    bench_result_t r = { .test = write ? "sd_write" : "sd_read", .bytes = size, .block = bs };
+    const char *err = NULL;
+    if (!write) {
+        bench_result_t fill = { 0 };
+        err = bench_sd_pass(true, buf, size, bs, &fill);
+    }
+    if (!err) {
+        err = bench_sd_pass(write, buf, size, bs, &r);
+    }
+    unlink(s_bench_path);
+    free(buf);
+    if (err) {
+        ESP_LOGE(TAG, "%s: %s", r.test, err);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, err);
+        return ESP_FAIL;
+    }
+    return bench_resp_json(req, &r);
+}
+
+esp_err_t bench_server_register(httpd_handle_t server, const char *base_path)
+{
+    snprintf(s_bench_path, sizeof(s_bench_path), "%s" BENCH_FILE_NAME, base_path);
+
+    httpd_uri_t bench_sink = {
+        .uri       = "/bench/sink",
+        .method    = HTTP_POST,
+        .handler   = bench_sink_handler,
+        .user_ctx  = NULL
+    };
+    httpd_uri_t bench_source = {
+        .uri       = "/bench/source",
+        .method    = HTTP_GET,
+        .handler   = bench_source_handler,
+        .user_ctx  = NULL
+    };
+    httpd_uri_t bench_sd = {
+        .uri       = "/bench/sd",
+        .method    = HTTP_GET,
+        .handler   = bench_sd_handler,
+        .user_ctx  = NULL
+    };
+    esp_err_t ret = httpd_register_uri_handler(server, &bench_sink);
+    if (ret == ESP_OK) {
+        ret = httpd_register_uri_handler(server, &bench_source);
+    }
+    if (ret == ESP_OK) {
+        ret = httpd_register_uri_handler(server, &bench_sd);
+    }
+    return ret;
+}
+
+#endif /* CONFIG_HTTP_BENCH_ENABLE */
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/* Register the /bench/ handlers, /bench/sd works on a file under base_path.
+ * Only built with CONFIG_HTTP_BENCH_ENABLE */
+esp_err_t bench_server_register(httpd_handle_t server, const char *base_path);
@@ -0,0 +1,224 @@
+/* Server-Sent Events channel of the HTTP file server
+
+   GET /events keeps the connection open and streams file created/deleted
+   events and transfer progress as text/event-stream, so the web UI can
+   patch its listing instead of re-fetching whole directories.
+
+   All subscriber sockets are only touched from the httpd task: handlers
+   running there send directly, other tasks hand the message over with
+   httpd_queue_work(). Sends never wait, a subscriber whose socket buffer
+   is full is dropped so one stalled browser cannot hold up the server.
+
+   A stream never carries another request, so httpd would count it as idle
+   and purge it first when its sessions run out. Every event sent marks the
+   session as used, and a comment line every SSE_KEEPALIVE_US keeps quiet
+   subscribers recent too.
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_http_server.h"
+
+#include "file_events.h"
+
+#define SSE_MSG_MAX 320
+#define SSE_KEEPALIVE_US (15 * 1000 * 1000)
+
+static const char *TAG = "file_events";
+static httpd_handle_t s_server = NULL;
+static TaskHandle_t s_httpd_task = NULL;
+static int s_clients[FILE_EVENTS_MAX_SUBSCRIBERS] = { [0 ... FILE_EVENTS_MAX_SUBSCRIBERS - 1] = -1 };
+
+static const char *s_event_names[] = {
+    [FILE_EVENT_CREATED] = "created",
+    [FILE_EVENT_DELETED] = "deleted",
+    [FILE_EVENT_PROGRESS] = "progress",
+};
+
+/* Runs in the httpd task only */
+static void sse_broadcast(const char *msg, size_t len)
+{
+    for (int i = 0; i < FILE_EVENTS_MAX_SUBSCRIBERS; i++) {
+        int fd = s_clients[i];
+        if (fd < 0) {
+            continue;
+        }
+        /* a short write would leave half an event in the stream, drop it too */
+        if (httpd_socket_send(s_server, fd, msg, len, MSG_DONTWAIT) != (int)len) {
+            ESP_LOGW(TAG, "subscriber %d gone or stalled", fd);
+            s_clients[i] = -1;
+            httpd_sess_trigger_close(s_server, fd);
+        } else {
+            httpd_sess_update_lru_counter(s_server, fd);
+        }
+    }
+}
+
+static void sse_broadcast_work(void *arg)
+{
+    char *msg = (char *)arg;
+    sse_broadcast(msg, strlen(msg));
+    free(msg);
+}
+
+static void sse_keepalive_work(void *arg)
+{
+    static const char comment[] = ": keepalive\n\n";
+    sse_broadcast(comment, sizeof(comment) - 1);
+}
+
+/* Runs in the esp_timer task */
+static void sse_keepalive_timer(void *arg)
+{
+    if (s_server && file_events_has_subscribers()) {
+        httpd_queue_work(s_server, sse_keepalive_work, NULL);
+    }
+}
+
+/* Called by httpd when a subscriber session is closed */
+static void sse_sess_free(void *ctx)
+{
+    int fd = (int)(intptr_t)ctx;
+    for (int i = 0; i < FILE_EVENTS_MAX_SUBSCRIBERS; i++) {
+        if (s_clients[i] == fd) {
+            s_clients[i] = -1;
+        }
+    }
+    ESP_LOGI(TAG, "subscriber %d closed", fd);
+}
+
+static esp_err_t events_get_handler(httpd_req_t *req)
+{
+    s_httpd_task = xTaskGetCurrentTaskHandle();
+    int fd = httpd_req_to_sockfd(req);
+    int slot = -1;
+    for (int i = 0; i < FILE_EVENTS_MAX_SUBSCRIBERS; i++) {
+        if (s_clients[i] == fd || (s_clients[i] < 0 && slot < 0)) {
+            slot = i;
+        }
+    }
+    if (slot < 0) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "5");
+        httpd_resp_sendstr(req, "Too many subscribers");
+        return ESP_OK;
+    }
+
+    /* The response is never finished, so write the header directly and keep
+     * the socket; the stream is delimited by connection close */
+    static const char header[] = "HTTP/1.1 200 OK\r\n"
+                                 "Content-Type: text/event-stream\r\n"
+                                 "Cache-Control: no-cache\r\n"
+                                 "Connection: keep-alive\r\n"
+                                 "\r\n"
+                                 "retry: 2000\n\n";
+    if (httpd_socket_send(req->handle, fd, header, sizeof(header) - 1, 0) < 0) {
+        return ESP_FAIL;
+    }
+    s_clients[slot] = fd;
+    req->sess_ctx = (void *)(intptr_t)fd;
+    req->free_ctx = sse_sess_free;
+    ESP_LOGI(TAG, "subscriber %d connected", fd);
+    return ESP_OK;
+}
+
+esp_err_t file_events_register(httpd_handle_t server)
+{
+    static esp_timer_handle_t keepalive = NULL;
+    s_server = server;
+    if (!keepalive) {
+        const esp_timer_create_args_t args = {
+            .callback = sse_keepalive_timer,
+            .name = "sse_keepalive",
+        };
+        if (esp_timer_create(&args, &keepalive) != ESP_OK ||
+                esp_timer_start_periodic(keepalive, SSE_KEEPALIVE_US) != ESP_OK) {
+            ESP_LOGW(TAG, "no keepalive, idle subscribers may be purged");
+        }
+    }
+    httpd_uri_t events = {
+        .uri       = "/events",
+        .method    = HTTP_GET,
+        .handler   = events_get_handler,
+        .user_ctx  = NULL
+    };
+    return httpd_register_uri_handler(server, &events);
+}
+
+bool file_events_has_subscribers(void)
+{
+    for (int i = 0; i < FILE_EVENTS_MAX_SUBSCRIBERS; i++) {
+        if (s_clients[i] >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void sse_publish(file_event_t type, const char *fmt, ...)
+{
+    if (!s_server || !file_events_has_subscribers()) {
+        return;
+    }
+    char *msg = malloc(SSE_MSG_MAX);
+    if (!msg) {
+        return;
+    }
+    int len = snprintf(msg, SSE_MSG_MAX, "event: %s\ndata: ", s_event_names[type]);
+    va_list args;
+    va_start(args, fmt);
+    len += vsnprintf(msg + len, SSE_MSG_MAX - len, fmt, args);
+    va_end(args);
+    if (len > SSE_MSG_MAX - 3) {
+        /* never emit a truncated JSON payload */
+        free(msg);
+        return;
+    }
+    strcpy(msg + len, "\n\n");
+    len += 2;
+
+    if (xTaskGetCurrentTaskHandle() == s_httpd_task) {
+        sse_broadcast(msg, len);
+        free(msg);
+    } else if (httpd_queue_work(s_server, sse_broadcast_work, msg) != ESP_OK) {
+        free(msg);
+    }
+}
+
+/* Escape a path for use inside a JSON string */
+static const char *json_path(const char *path, char *buf, size_t len)
+{
+    size_t o = 0;
+    for (; *path && o + 2 < len; path++) {
+        if (*path == '"' || *path == '\\') {
+            buf[o++] = '\\';
+        } else if ((unsigned char)*path < 0x20) {
+            continue;
+        }
+        buf[o++] = *path;
+    }
+    buf[o] = '\0';
+    return buf;
+}
+
+void file_events_notify(file_event_t type, const char *path, long size)
+{
+    char esc[200];
+    sse_publish(type, "{\"path\":\"%s\",\"size\":%ld}", json_path(path, esc, sizeof(esc)), size);
+}
+
+void file_events_progress(const char *path, bool upload, size_t done, size_t total)
+{
+    char esc[200];
+    sse_publish(FILE_EVENT_PROGRESS, "{\"path\":\"%s\",\"dir\":\"%s\",\"done\":%u,\"total\":%u}",
+                json_path(path, esc, sizeof(esc)), upload ? "up" : "down", (unsigned)done, (unsigned)total);
+}
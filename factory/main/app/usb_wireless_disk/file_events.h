@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/* Each subscriber holds one httpd session for as long as it is connected,
+ * the server reserves this many sessions on top of its usual ones */
+#define FILE_EVENTS_MAX_SUBSCRIBERS 4
+
+typedef enum {
+    FILE_EVENT_CREATED = 0,
+    FILE_EVENT_DELETED,
+    FILE_EVENT_PROGRESS,
+} file_event_t;
+
+/* Register GET /events, must be called before any wildcard GET handler */
+esp_err_t file_events_register(httpd_handle_t server);
+
+bool file_events_has_subscribers(void);
+
+/* Publish a file event, path is relative to the server base path.
+ * Safe to call from any task */
+void file_events_notify(file_event_t type, const char *path, long size);
+
+void file_events_progress(const char *path, bool upload, size_t done, size_t total);
@@ -8,19 +8,28 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/param.h>
 #include <sys/unistd.h>
 #include <sys/stat.h>
 #include <dirent.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "esp_vfs.h"
 #include "esp_spiffs.h"
 #include "esp_http_server.h"
 
+#include "file_events.h"
+#include "thumb_cache.h"
+#include "bench_server.h"
+#include "metrics.h"
+
 /* Max length a file path can have on storage */
 #define FILE_PATH_MAX (ESP_VFS_PATH_MAX + CONFIG_SPIFFS_OBJ_NAME_LEN)
 
@@ -32,6 +41,9 @@
 /* Scratch buffer size */
 #define SCRATCH_BUFSIZE  8192
 
+/* Minimum interval between two progress events of one transfer */
+#define PROGRESS_EVENT_MS 500
+
 struct file_server_data {
     /* Base path of file storage */
     char base_path[ESP_VFS_PATH_MAX + 1];
@@ -42,6 +54,13 @@ struct file_server_data {
 
 static const char *TAG = "file_server";
 
+METRICS_COUNTER_DEFINE(s_http_tx_bytes, "http_bytes_total", "File bytes transferred over HTTP", "dir=\"tx\"");
+METRICS_COUNTER_DEFINE(s_http_rx_bytes, "http_bytes_total", NULL, "dir=\"rx\"");
+METRICS_HISTOGRAM_DEFINE(s_sd_read_time, "sd_io_duration_seconds", "Storage access latency",
+                         "op=\"read\",source=\"http\"", METRICS_LATENCY_BOUNDS_US);
+METRICS_HISTOGRAM_DEFINE(s_sd_write_time, "sd_io_duration_seconds", NULL,
+                         "op=\"write\",source=\"http\"", METRICS_LATENCY_BOUNDS_US);
+
 /* Handler to redirect incoming GET request for /index.html to /
  * This can be overridden by uploading file with same name */
 static esp_err_t index_html_get_handler(httpd_req_t *req)
@@ -65,6 +84,11 @@ static esp_err_t favicon_get_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+/* Names shorter than the extension, like directory entries "a", never match */
+#define IS_FILE_EXT(filename, ext) \
+    (strlen(filename) >= sizeof(ext) - 1 && \
+     strcasecmp(&filename[strlen(filename) - sizeof(ext) + 1], ext) == 0)
+
 /* Send HTTP response with a run-time generated html consisting of
  * a list of all files and folders under the requested path.
  * In case of SPIFFS this returns empty list when path is any
@@ -107,10 +131,14 @@ static esp_err_t http_resp_dir_html(httpd_req_t *req, const char *dirpath)
         "<table class=\"fixed\" border=\"1\">"
         "<col width=\"800px\" /><col width=\"300px\" /><col width=\"300px\" /><col width=\"100px\" />"
         "<thead><tr><th>Name</th><th>Type</th><th>Size (Bytes)</th><th>Delete</th></tr></thead>"
-        "<tbody>");
+        "<tbody id=\"filelist\">");
 
     /* Iterate over all files / folders and fetch their names and sizes */
     while ((entry = readdir(dir)) != NULL) {
+        /* Hide the thumbnail cache and other dot entries */
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
         entrytype = (entry->d_type == DT_DIR ? "directory" : "file");
 
         strlcpy(entrypath + dirpath_len, entry->d_name, sizeof(entrypath) - dirpath_len);
@@ -122,13 +150,23 @@ static esp_err_t http_resp_dir_html(httpd_req_t *req, const char *dirpath)
         ESP_LOGI(TAG, "Found %s : %s (%s bytes)", entrytype, entry->d_name, entrysize);
 
         /* Send chunk of HTML file containing table entries with file name and size */
-        httpd_resp_sendstr_chunk(req, "<tr><td><a href=\"");
+        httpd_resp_sendstr_chunk(req, "<tr data-path=\"");
+        httpd_resp_sendstr_chunk(req, req->uri);
+        httpd_resp_sendstr_chunk(req, entry->d_name);
+        httpd_resp_sendstr_chunk(req, "\"><td><a href=\"");
         httpd_resp_sendstr_chunk(req, req->uri);
         httpd_resp_sendstr_chunk(req, entry->d_name);
         if (entry->d_type == DT_DIR) {
             httpd_resp_sendstr_chunk(req, "/");
         }
         httpd_resp_sendstr_chunk(req, "\">");
+        if (entry->d_type != DT_DIR && (IS_FILE_EXT(entry->d_name, ".jpg") || IS_FILE_EXT(entry->d_name, ".jpeg"))) {
+            /* Preview is fetched from the thumbnail service, retried while it is generated */
+            httpd_resp_sendstr_chunk(req, "<img class=\"thumb\" loading=\"lazy\" onerror=\"thumbRetry(this)\" src=\"/thumb");
+            httpd_resp_sendstr_chunk(req, req->uri);
+            httpd_resp_sendstr_chunk(req, entry->d_name);
+            httpd_resp_sendstr_chunk(req, "?w=64\"> ");
+        }
         httpd_resp_sendstr_chunk(req, entry->d_name);
         httpd_resp_sendstr_chunk(req, "</a></td><td>");
         httpd_resp_sendstr_chunk(req, entrytype);
@@ -154,9 +192,6 @@ static esp_err_t http_resp_dir_html(httpd_req_t *req, const char *dirpath)
     return ESP_OK;
 }
 
-#define IS_FILE_EXT(filename, ext) \
-    (strcasecmp(&filename[strlen(filename) - sizeof(ext) + 1], ext) == 0)
-
 /* Set HTTP response content type according to file extension */
 static esp_err_t set_content_type_from_file(httpd_req_t *req, const char *filename)
 {
@@ -203,6 +238,52 @@ static const char* get_path_from_uri(char *dest, const char *base_path, const ch
     return dest + base_pathlen;
 }
 
+/* Send an opened file as chunked HTTP response and close it.
+ * If name is set, progress of the transfer is published on /events */
+static esp_err_t http_resp_send_file(httpd_req_t *req, FILE *fd, const char *name, size_t total)
+{
+    /* Retrieve the pointer to scratch buffer for temporary storage */
+    char *chunk = ((struct file_server_data *)req->user_ctx)->scratch;
+    size_t chunksize;
+    size_t sent = 0;
+    TickType_t last_progress = xTaskGetTickCount();
+    do {
+        /* Read file in chunks into the scratch buffer */
+        int64_t start = esp_timer_get_time();
+        chunksize = fread(chunk, 1, SCRATCH_BUFSIZE, fd);
+        metrics_histogram_observe_since(&s_sd_read_time, start);
+
+        if (chunksize > 0) {
+            /* Send the buffer contents as HTTP response chunk */
+            if (httpd_resp_send_chunk(req, chunk, chunksize) != ESP_OK) {
+                fclose(fd);
+                ESP_LOGE(TAG, "File sending failed!");
+                /* Abort sending file */
+                httpd_resp_sendstr_chunk(req, NULL);
+                /* Respond with 500 Internal Server Error */
+                httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to send file");
+               return ESP_FAIL;
+           }
+            sent += chunksize;
+            metrics_counter_add(&s_http_tx_bytes, chunksize);
+            if (name && xTaskGetTickCount() - last_progress >= pdMS_TO_TICKS(PROGRESS_EVENT_MS)) {
+                last_progress = xTaskGetTickCount();
+                file_events_progress(name, false, sent, total);
+            }
+        }
+
+        /* Keep looping till the whole file is sent */
+    } while (chunksize != 0);
+
+    /* Close file after sending complete */
+    fclose(fd);
+    ESP_LOGI(TAG, "File sending complete");
+
+    /* Respond with an empty chunk to signal HTTP response completion */
+    httpd_resp_send_chunk(req, NULL, 0);
+    return ESP_OK;
+}
+
 /* Handler to download a file kept on the server */
 static esp_err_t download_get_handler(httpd_req_t *req)
 {
@@ -248,37 +329,65 @@ static esp_err_t download_get_handler(httpd_req_t *req)
 
     ESP_LOGI(TAG, "Sending file : %s (%ld bytes)...", filename, file_stat.st_size);
     set_content_type_from_file(req, filename);
+    return http_resp_send_file(req, fd, filename, file_stat.st_size);
+}
 
-    /* Retrieve the pointer to scratch buffer for temporary storage */
-    char *chunk = ((struct file_server_data *)req->user_ctx)->scratch;
-    size_t chunksize;
-    do {
-        /* Read file in chunks into the scratch buffer */
-        chunksize = fread(chunk, 1, SCRATCH_BUFSIZE, fd);
+/* Handler to send a JPEG preview of a file, GET /thumb/path/to/file.jpg?w=160
+ * Previews are generated in the background, until one is ready the client
+ * gets 503 with Retry-After instead of blocking the server task. Files the
+ * decoder rejected once get 415 until they change */
+static esp_err_t thumb_get_handler(httpd_req_t *req)
+{
+    char filepath[FILE_PATH_MAX];
+    char thumbpath[FILE_PATH_MAX];
 
-        if (chunksize > 0) {
-            /* Send the buffer contents as HTTP response chunk */
-            if (httpd_resp_send_chunk(req, chunk, chunksize) != ESP_OK) {
-                fclose(fd);
-                ESP_LOGE(TAG, "File sending failed!");
-                /* Abort sending file */
-                httpd_resp_sendstr_chunk(req, NULL);
-                /* Respond with 500 Internal Server Error */
-                httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to send file");
-               return ESP_FAIL;
-           }
-        }
+    const char *filename = get_path_from_uri(filepath, ((struct file_server_data *)req->user_ctx)->base_path,
+                                             req->uri + sizeof("/thumb") - 1, sizeof(filepath));
+    if (!filename) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Filename too long");
+        return ESP_FAIL;
+    }
+    if (!IS_FILE_EXT(filename, ".jpg") && !IS_FILE_EXT(filename, ".jpeg")) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Only JPEG files have previews");
+        return ESP_FAIL;
+    }
 
-        /* Keep looping till the whole file is sent */
-    } while (chunksize != 0);
+    int width = CONFIG_THUMB_DEFAULT_WIDTH;
+    char query[32];
+    char value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+            httpd_query_key_value(query, "w", value, sizeof(value)) == ESP_OK) {
+        width = atoi(value);
+    }
+    width = MAX(16, MIN(width, CONFIG_THUMB_MAX_WIDTH));
 
-    /* Close file after sending complete */
-    fclose(fd);
-    ESP_LOGI(TAG, "File sending complete");
+    esp_err_t ret = thumb_cache_get(filepath, width, thumbpath, sizeof(thumbpath));
+    if (ret == ESP_ERR_NOT_FOUND) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "File does not exist");
+        return ESP_FAIL;
+    } else if (ret == ESP_ERR_NOT_FINISHED || ret == ESP_ERR_NO_MEM) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        httpd_resp_sendstr(req, ret == ESP_ERR_NO_MEM ? "Thumbnail queue full" : "Thumbnail in progress");
+        return ESP_OK;
+    } else if (ret == ESP_ERR_NOT_SUPPORTED) {
+        httpd_resp_set_status(req, "415 Unsupported Media Type");
+        httpd_resp_sendstr(req, "File cannot be decoded");
+        return ESP_OK;
+    } else if (ret != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Thumbnail failed");
+        return ESP_FAIL;
+    }
 
-    /* Respond with an empty chunk to signal HTTP response completion */
-    httpd_resp_send_chunk(req, NULL, 0);
-    return ESP_OK;
+    FILE *fd = fopen(thumbpath, "r");
+    if (!fd) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to read thumbnail");
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "image/jpeg");
+    /* the cache key contains the mtime, so a URL stays valid until the file changes */
+    httpd_resp_set_hdr(req, "Cache-Control", "max-age=3600");
+    return http_resp_send_file(req, fd, NULL, 0);
 }
 
 /* Handler to upload a file onto the server */
@@ -314,7 +423,7 @@ static esp_err_t upload_post_handler(httpd_req_t *req)
 
     /* File cannot be larger than a limit */
     if (req->content_len > MAX_FILE_SIZE) {
-        ESP_LOGE(TAG, "File too large : %d bytes", req->content_len);
+        ESP_LOGE(TAG, "File too large : %u bytes", (unsigned)req->content_len);
         /* Respond with 400 Bad Request */
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
                             "File size must be less than "
@@ -341,6 +450,7 @@ static esp_err_t upload_post_handler(httpd_req_t *req)
     /* Content length of the request gives
      * the size of the file being uploaded */
     int remaining = req->content_len;
+    TickType_t last_progress = xTaskGetTickCount();
 
     while (remaining > 0) {
 
@@ -363,8 +473,13 @@ static esp_err_t upload_post_handler(httpd_req_t *req)
             return ESP_FAIL;
         }
 
+        metrics_counter_add(&s_http_rx_bytes, received);
+
         /* Write buffer content to file on storage */
-        if (received && (received != fwrite(buf, 1, received, fd))) {
+        int64_t start = esp_timer_get_time();
+        size_t written = fwrite(buf, 1, received, fd);
+        metrics_histogram_observe_since(&s_sd_write_time, start);
+        if (received && (received != written)) {
             /* Couldn't write everything to file!
              * Storage may be full? */
             fclose(fd);
@@ -379,11 +494,23 @@ static esp_err_t upload_post_handler(httpd_req_t *req)
         /* Keep track of remaining size of
          * the file left to be uploaded */
         remaining -= received;
+
+        if (xTaskGetTickCount() - last_progress >= pdMS_TO_TICKS(PROGRESS_EVENT_MS)) {
+            last_progress = xTaskGetTickCount();
+            file_events_progress(filename, true, req->content_len - remaining, req->content_len);
+        }
     }
 
     /* Close file upon upload completion */
     fclose(fd);
     ESP_LOGI(TAG, "File reception complete");
+    file_events_notify(FILE_EVENT_CREATED, filename, req->content_len);
+
+    /* Clients following /events patch their view themselves */
+    if (httpd_req_get_hdr_value_len(req, "X-No-Redirect") > 0) {
+        httpd_resp_sendstr(req, "File uploaded successfully");
+        return ESP_OK;
+    }
 
     /* Redirect onto root to see the updated file list */
     httpd_resp_set_status(req, "303 See Other");
@@ -425,6 +552,10 @@ static esp_err_t delete_post_handler(httpd_req_t *req)
     ESP_LOGI(TAG, "Deleting file : %s", filename);
     /* Delete file */
     unlink(filepath);
+    if (thumb_cache_remove(filepath) == ESP_ERR_NO_MEM) {
+        ESP_LOGW(TAG, "Thumbnails of %s are swept at the next start", filename);
+    }
+    file_events_notify(FILE_EVENT_DELETED, filename, file_stat.st_size);
 
     /* Redirect onto root to see the updated file list */
     httpd_resp_set_status(req, "303 See Other");
@@ -444,6 +575,68 @@ esp_err_t http_404_error_handler(httpd_req_t *req, httpd_err_code_t err)
     return ESP_OK;
 }
 
+/* Output of metrics_render, collected in the scratch buffer and sent in large chunks */
+struct metrics_resp {
+    httpd_req_t *req;
+    char *buf;
+    size_t len;
+};
+
+static esp_err_t metrics_resp_write(void *ctx, const char *data, size_t len)
+{
+    struct metrics_resp *resp = (struct metrics_resp *)ctx;
+    if (resp->len + len > SCRATCH_BUFSIZE) {
+        esp_err_t ret = httpd_resp_send_chunk(resp->req, resp->buf, resp->len);
+        resp->len = 0;
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    memcpy(resp->buf + resp->len, data, len);
+    resp->len += len;
+    return ESP_OK;
+}
+
+/* Handler to export counters and runtime statistics in Prometheus text format */
+static esp_err_t metrics_get_handler(httpd_req_t *req)
+{
+    struct metrics_resp resp = {
+        .req = req,
+        .buf = ((struct file_server_data *)req->user_ctx)->scratch,
+        .len = 0,
+    };
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    if (metrics_render(metrics_resp_write, &resp) != ESP_OK ||
+            httpd_resp_send_chunk(req, resp.buf, resp.len) != ESP_OK) {
+        httpd_resp_sendstr_chunk(req, NULL);
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+/* Wrap a URI handler to record its latency and failures */
+#define HTTP_HANDLER_METRICS(handler, label) \
+    METRICS_HISTOGRAM_DEFINE(handler##_time, "http_request_duration_seconds", "HTTP request latency per handler", \
+                             "handler=\"" label "\"", METRICS_LATENCY_BOUNDS_US); \
+    METRICS_COUNTER_DEFINE(handler##_errors, "http_request_errors_total", "Failed HTTP requests per handler", \
+                           "handler=\"" label "\""); \
+    static esp_err_t handler##_timed(httpd_req_t *req) \
+    { \
+        int64_t start = esp_timer_get_time(); \
+        esp_err_t ret = handler(req); \
+        metrics_histogram_observe_since(&handler##_time, start); \
+        if (ret != ESP_OK) { \
+            metrics_counter_inc(&handler##_errors); \
+        } \
+        return ret; \
+    }
+
+HTTP_HANDLER_METRICS(download_get_handler, "download")
+HTTP_HANDLER_METRICS(thumb_get_handler, "thumb")
+HTTP_HANDLER_METRICS(upload_post_handler, "upload")
+HTTP_HANDLER_METRICS(delete_post_handler, "delete")
+HTTP_HANDLER_METRICS(metrics_get_handler, "metrics")
+
 /* Function to start the file server */
 esp_err_t start_file_server(const char *base_path)
 {
@@ -477,6 +670,12 @@ esp_err_t start_file_server(const char *base_path)
      * target URIs which match the wildcard scheme */
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.lru_purge_enable = true;
+    /* room for the event subscribers on top of the default 7 sessions. The
+     * pool is shared: subscribers stay recent by sending, but a burst of new
+     * connections can still purge one, the browser then reconnects.
+     * httpd needs 3 more sockets, CONFIG_LWIP_MAX_SOCKETS must cover the sum */
+    config.max_open_sockets += FILE_EVENTS_MAX_SUBSCRIBERS;
+    config.max_uri_handlers = 12;
 
     ESP_LOGI(TAG, "Starting HTTP Server");
     if (httpd_start(&server, &config) != ESP_OK) {
@@ -484,11 +683,44 @@ esp_err_t start_file_server(const char *base_path)
         return ESP_FAIL;
     }
 
+    if (thumb_cache_init(base_path) != ESP_OK) {
+        ESP_LOGW(TAG, "Thumbnail service not available");
+    }
+
+    /* URI handler for JPEG previews, must be registered before the
+     * catch-all download handler */
+    httpd_uri_t file_thumb = {
+        .uri       = "/thumb/*",    // Match all URIs of type /thumb/path/to/file
+        .method    = HTTP_GET,
+        .handler   = thumb_get_handler_timed,
+        .user_ctx  = server_data    // Pass server data as context
+    };
+    httpd_register_uri_handler(server, &file_thumb);
+
+    /* URI handler for Prometheus scrapes */
+    httpd_uri_t file_metrics = {
+        .uri       = "/metrics",
+        .method    = HTTP_GET,
+        .handler   = metrics_get_handler_timed,
+        .user_ctx  = server_data    // Pass server data as context
+    };
+    httpd_register_uri_handler(server, &file_metrics);
+
+#if CONFIG_HTTP_BENCH_ENABLE
+    /* Throughput tests, /bench/source and /bench/sd are GET handlers too */
+    if (bench_server_register(server, base_path) != ESP_OK) {
+        ESP_LOGW(TAG, "Benchmark endpoints not available");
+    }
+#endif
+
+    /* Server-Sent Events for file changes and transfer progress */
+    file_events_register(server);
+
     /* URI handler for getting uploaded files */
     httpd_uri_t file_download = {
         .uri       = "/*",  // Match all URIs of type /path/to/file
         .method    = HTTP_GET,
-        .handler   = download_get_handler,
+        .handler   = download_get_handler_timed,
         .user_ctx  = server_data    // Pass server data as context
     };
     httpd_register_uri_handler(server, &file_download);
@@ -497,7 +729,7 @@ esp_err_t start_file_server(const char *base_path)
     httpd_uri_t file_upload = {
         .uri       = "/upload/*",   // Match all URIs of type /upload/path/to/file
         .method    = HTTP_POST,
-        .handler   = upload_post_handler,
+        .handler   = upload_post_handler_timed,
         .user_ctx  = server_data    // Pass server data as context
     };
     httpd_register_uri_handler(server, &file_upload);
@@ -506,7 +738,7 @@ esp_err_t start_file_server(const char *base_path)
     httpd_uri_t file_delete = {
         .uri       = "/delete/*",   // Match all URIs of type /delete/path/to/file
         .method    = HTTP_POST,
-        .handler   = delete_post_handler,
+        .handler   = delete_post_handler_timed,
         .user_ctx  = server_data    // Pass server data as context
     };
     httpd_register_uri_handler(server, &file_delete);
@@ -0,0 +1,408 @@
+/* Thumbnail cache for the HTTP file server
+
+   Thumbnails are generated by a low priority worker task from a bounded
+   queue, so a gallery page full of previews cannot starve normal
+   downloads served by the httpd task. Results are kept in a hidden folder
+   on the card, keyed by source path, size and modification time. Sources
+   the decoder rejects leave an empty "<thumbnail>.err" marker instead, so
+   they are not decoded again until the file changes. A new result replaces
+   those of older versions of the same file and size, and deleting a file
+   drops all of its thumbnails.
+
+   Entries are named after a slot, the hash of the source path. The file
+   "<slot>.src" holds the path that owns the slot, so a path whose hash
+   collides takes one of the next slots, and nothing is deleted for the
+   wrong file. At start the worker sweeps entries whose source is gone,
+   for deletes that found the queue full or happened over USB.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_vfs.h"
+
+#include "jpeg_thumb.h"
+#include "thumb_cache.h"
+#include "app.h"
+
+#define THUMB_DIR_NAME ".thumbs"
+#define THUMB_PATH_MAX (ESP_VFS_PATH_MAX + 64)
+#define THUMB_SRC_PATH_MAX 264
+#define THUMB_SLOT_PROBES 4     /* slots tried after the hash of a path */
+
+typedef struct {
+    uint32_t key;
+    uint32_t slot;
+    uint16_t width;         /* 0 removes every thumbnail of src_path */
+    char src_path[THUMB_SRC_PATH_MAX];
+    char dst_path[THUMB_PATH_MAX];
+} thumb_job_t;
+
+static const char *TAG = "thumb_cache";
+static char s_thumb_dir[THUMB_PATH_MAX];
+static QueueHandle_t s_job_queue = NULL;
+static SemaphoreHandle_t s_pending_mutex = NULL;
+/* keys queued or in progress, one slot more than the queue for the running job */
+static uint32_t s_pending[CONFIG_THUMB_QUEUE_LEN + 1];
+
+static uint32_t thumb_hash(const char *s)
+{
+    uint32_t h = 2166136261u; /* FNV-1a */
+    while (*s) {
+        h ^= (uint8_t) * s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static bool thumb_pending_mark(uint32_t key)
+{
+    bool added = false;
+    xSemaphoreTake(s_pending_mutex, portMAX_DELAY);
+    int free_slot = -1;
+    for (int i = 0; i < sizeof(s_pending) / sizeof(s_pending[0]); i++) {
+        if (s_pending[i] == key) {
+            free_slot = -1;
+            break;
+        }
+        if (s_pending[i] == 0 && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+    if (free_slot >= 0) {
+        s_pending[free_slot] = key;
+        added = true;
+    }
+    xSemaphoreGive(s_pending_mutex);
+    return added;
+}
+
+static bool thumb_pending_has(uint32_t key)
+{
+    bool found = false;
+    xSemaphoreTake(s_pending_mutex, portMAX_DELAY);
+    for (int i = 0; i < sizeof(s_pending) / sizeof(s_pending[0]); i++) {
+        if (s_pending[i] == key) {
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(s_pending_mutex);
+    return found;
+}
+
+static void thumb_pending_clear(uint32_t key)
+{
+    xSemaphoreTake(s_pending_mutex, portMAX_DELAY);
+    for (int i = 0; i < sizeof(s_pending) / sizeof(s_pending[0]); i++) {
+        if (s_pending[i] == key) {
+            s_pending[i] = 0;
+        }
+    }
+    xSemaphoreGive(s_pending_mutex);
+}
+
+/* Read the owner of slot into path, false if the slot is free */
+static bool thumb_slot_owner(uint32_t slot, char *path, size_t len)
+{
+    char src_name[THUMB_PATH_MAX];
+    snprintf(src_name, sizeof(src_name), "%s/%08x.src", s_thumb_dir, (unsigned) slot);
+    FILE *fd = fopen(src_name, "r");
+    if (!fd) {
+        return false;
+    }
+    size_t n = fread(path, 1, len - 1, fd);
+    path[n] = '\0';
+    fclose(fd);
+    return true;
+}
+
+/* Write the owner of slot, through a rename so a reader never sees half a path */
+static esp_err_t thumb_slot_claim(uint32_t slot, const char *path)
+{
+    char src_name[THUMB_PATH_MAX];
+    char tmp_name[THUMB_PATH_MAX];
+    snprintf(src_name, sizeof(src_name), "%s/%08x.src", s_thumb_dir, (unsigned) slot);
+    snprintf(tmp_name, sizeof(tmp_name), "%s/%08x.sr~", s_thumb_dir, (unsigned) slot);
+    FILE *fd = fopen(tmp_name, "w");
+    if (!fd) {
+        return ESP_FAIL;
+    }
+    bool ok = fputs(path, fd) >= 0;
+    ok = fclose(fd) == 0 && ok;
+    if (!ok || rename(tmp_name, src_name) != 0) {
+        unlink(tmp_name);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/**
+ * Slot of path: the one it owns, else the first free one of its probes.
+ * owned tells which, buf holds THUMB_SRC_PATH_MAX bytes for reading owners.
+ */
+static bool thumb_slot_find(const char *path, char *buf, uint32_t *slot, bool *owned)
+{
+    uint32_t hash = thumb_hash(path);
+    bool found_free = false;
+    for (uint32_t i = 0; i < THUMB_SLOT_PROBES; i++) {
+        if (!thumb_slot_owner(hash + i, buf, THUMB_SRC_PATH_MAX)) {
+            if (!found_free) {
+                found_free = true;
+                *slot = hash + i;
+            }
+        } else if (strcmp(buf, path) == 0) {
+            *slot = hash + i;
+            *owned = true;
+            return true;
+        }
+    }
+    *owned = false;
+    return found_free;
+}
+
+/* Remove the cache entries starting with prefix, except the one named keep */
+static void thumb_evict(const char *prefix, const char *keep)
+{
+    char path[THUMB_PATH_MAX + 4];
+    size_t prefix_len = strlen(prefix);
+    DIR *dir = opendir(s_thumb_dir);
+    if (!dir) {
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strncmp(entry->d_name, prefix, prefix_len) != 0 ||
+                (keep && strcmp(entry->d_name, keep) == 0)) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", s_thumb_dir, entry->d_name);
+        unlink(path);
+    }
+    closedir(dir);
+}
+
+/* Drop the slot of a removed source, its entries and then its owner file */
+static void thumb_slot_free(uint32_t slot)
+{
+    char name[THUMB_PATH_MAX];
+    snprintf(name, sizeof(name), "%08x_", (unsigned) slot);
+    thumb_evict(name, NULL);
+    snprintf(name, sizeof(name), "%s/%08x.src", s_thumb_dir, (unsigned) slot);
+    unlink(name);
+}
+
+/* Free the slots whose source is gone, then remove entries of slots without owner */
+static void thumb_sweep(char *buf)
+{
+    char path[THUMB_PATH_MAX + 4];
+    struct stat st;
+    int removed = 0;
+    DIR *dir = opendir(s_thumb_dir);
+    if (!dir) {
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        const char *dot = strchr(entry->d_name, '.');
+        if (!dot || strcmp(dot, ".src") != 0) {
+            continue;
+        }
+        uint32_t slot = strtoul(entry->d_name, NULL, 16);
+        if (thumb_slot_owner(slot, buf, THUMB_SRC_PATH_MAX) && stat(buf, &st) != 0) {
+            snprintf(path, sizeof(path), "%s/%s", s_thumb_dir, entry->d_name);
+            unlink(path);
+        }
+    }
+    rewinddir(dir);
+    while ((entry = readdir(dir)) != NULL) {
+        const char *dot = strchr(entry->d_name, '.');
+        if (dot && strcmp(dot, ".src") == 0) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%.8s.src", s_thumb_dir, entry->d_name);
+        if (stat(path, &st) != 0) {
+            snprintf(path, sizeof(path), "%s/%s", s_thumb_dir, entry->d_name);
+            removed += unlink(path) == 0;
+        }
+    }
+    closedir(dir);
+    if (removed) {
+        ESP_LOGI(TAG, "%d entries of removed files swept", removed);
+    }
+}
+
+static void thumb_worker_task(void *pvParameters)
+{
+    static thumb_job_t job;
+    static char owner[THUMB_SRC_PATH_MAX];
+    char tmp_path[THUMB_PATH_MAX + 4];
+    char prefix[24];
+
+    thumb_sweep(owner);
+    while (1) {
+        if (xQueueReceive(s_job_queue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (job.width == 0) {
+            /* all probes, two requests racing for free slots may both have claimed one */
+            uint32_t hash = thumb_hash(job.src_path);
+            for (uint32_t i = 0; i < THUMB_SLOT_PROBES; i++) {
+                if (thumb_slot_owner(hash + i, owner, sizeof(owner)) && strcmp(owner, job.src_path) == 0) {
+                    thumb_slot_free(hash + i);
+                }
+            }
+            continue;
+        }
+        /* only this task claims slots; a colliding path may have taken it since
+         * the request, then the next request probes again */
+        if (!thumb_slot_owner(job.slot, owner, sizeof(owner))) {
+            thumb_slot_claim(job.slot, job.src_path);
+        }
+        if (!thumb_slot_owner(job.slot, owner, sizeof(owner)) || strcmp(owner, job.src_path) != 0) {
+            ESP_LOGW(TAG, "%s: slot %08x not available", job.src_path, (unsigned) job.slot);
+            thumb_pending_clear(job.key);
+            continue;
+        }
+        /* write to a temporary name first so a partial file is never served */
+        snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", job.dst_path);
+        TickType_t start = xTaskGetTickCount();
+        esp_err_t ret = jpeg_thumb_create(job.src_path, tmp_path, job.width, CONFIG_THUMB_JPEG_QUALITY);
+        if (ret == ESP_OK && rename(tmp_path, job.dst_path) != 0) {
+            unlink(tmp_path);
+            ret = ESP_FAIL;
+        }
+        if (ret == ESP_OK) {
+            ESP_LOGI(TAG, "%s (%u px) ready in %u ms", job.src_path, job.width,
+                     (unsigned)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS));
+        } else {
+            ESP_LOGW(TAG, "%s: %s", job.src_path, esp_err_to_name(ret));
+        }
+        if (ret == ESP_ERR_NOT_SUPPORTED) {
+            /* out of memory or a full card may pass, a corrupt file will not */
+            snprintf(tmp_path, sizeof(tmp_path), "%s.err", job.dst_path);
+            FILE *fd = fopen(tmp_path, "w");
+            if (fd) {
+                fclose(fd);
+            }
+        }
+        if (ret == ESP_OK || ret == ESP_ERR_NOT_SUPPORTED) {
+            /* results for older versions of the file are never asked for again */
+            const char *name = strrchr(ret == ESP_OK ? job.dst_path : tmp_path, '/') + 1;
+            snprintf(prefix, sizeof(prefix), "%08x_%u_", (unsigned) job.slot, job.width);
+            thumb_evict(prefix, name);
+        }
+        thumb_pending_clear(job.key);
+    }
+}
+
+esp_err_t thumb_cache_init(const char *base_path)
+{
+    if (s_job_queue) {
+        return ESP_OK;
+    }
+    snprintf(s_thumb_dir, sizeof(s_thumb_dir), "%s/" THUMB_DIR_NAME, base_path);
+    struct stat st;
+    if (stat(s_thumb_dir, &st) != 0 && mkdir(s_thumb_dir, 0775) != 0) {
+        ESP_LOGE(TAG, "Failed to create %s", s_thumb_dir);
+        return ESP_FAIL;
+    }
+
+    s_pending_mutex = xSemaphoreCreateMutex();
+    s_job_queue = xQueueCreate(CONFIG_THUMB_QUEUE_LEN, sizeof(thumb_job_t));
+    if (!s_pending_mutex || !s_job_queue) {
+        ESP_LOGE(TAG, "Failed to allocate thumbnail queue");
+        return ESP_ERR_NO_MEM;
+    }
+    /* below the httpd task, previews only use otherwise idle time */
+    if (xTaskCreate(thumb_worker_task, "thumb", 6144, NULL, TASK_APP_PRIO_MIN, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start thumbnail worker");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t thumb_cache_get(const char *src_path, uint16_t width, char *out_path, size_t out_len)
+{
+    struct stat st;
+    if (!s_job_queue || !src_path || !out_path) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (stat(src_path, &st) != 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (strlen(src_path) >= THUMB_SRC_PATH_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    /* only called from the httpd task */
+    static char owner[THUMB_SRC_PATH_MAX];
+    uint32_t slot;
+    bool owned;
+    if (!thumb_slot_find(src_path, owner, &slot, &owned)) {
+        ESP_LOGW(TAG, "%s: all %d slots of its hash are taken", src_path, THUMB_SLOT_PROBES);
+        return ESP_FAIL;
+    }
+    snprintf(out_path, out_len, "%s/%08x_%u_%08lx.jpg", s_thumb_dir, (unsigned) slot, width, (unsigned long) st.st_mtime);
+    if (owned && stat(out_path, &st) == 0) {
+        return ESP_OK;
+    }
+    static char err_path[THUMB_PATH_MAX + 4];
+    snprintf(err_path, sizeof(err_path), "%s.err", out_path);
+    if (owned && stat(err_path, &st) == 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    uint32_t key = thumb_hash(out_path);
+    key = key ? key : 1;
+    if (thumb_pending_has(key)) {
+        return ESP_ERR_NOT_FINISHED;
+    }
+    if (!thumb_pending_mark(key)) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    /* only called from the httpd task, keep the large job off its stack */
+    static thumb_job_t job;
+    job.key = key;
+    job.slot = slot;
+    job.width = width;
+    strlcpy(job.src_path, src_path, sizeof(job.src_path));
+    strlcpy(job.dst_path, out_path, sizeof(job.dst_path));
+    if (xQueueSend(s_job_queue, &job, 0) != pdTRUE) {
+        thumb_pending_clear(key);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_ERR_NOT_FINISHED;
+}
+
+esp_err_t thumb_cache_remove(const char *src_path)
+{
+    if (!s_job_queue || !src_path) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (strlen(src_path) >= THUMB_SRC_PATH_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    /* the directory scan runs on the worker, not on the httpd task */
+    static thumb_job_t job;
+    job.key = 0;
+    job.slot = 0;
+    job.width = 0;
+    strlcpy(job.src_path, src_path, sizeof(job.src_path));
+    job.dst_path[0] = '\0';
+    if (xQueueSend(s_job_queue, &job, 0) != pdTRUE) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* Create the cache folder under base_path and start the worker task */
+esp_err_t thumb_cache_init(const char *base_path);
+
+/* Path of the thumbnail of src_path, width pixels wide, in out_path.
+ * ESP_OK when it is ready, ESP_ERR_NOT_FINISHED while it is generated,
+ * ESP_ERR_NO_MEM when the queue is full, ESP_ERR_NOT_FOUND without a source,
+ * ESP_ERR_NOT_SUPPORTED when an earlier attempt found the source undecodable */
+esp_err_t thumb_cache_get(const char *src_path, uint16_t width, char *out_path, size_t out_len);
+
+/* Queue removal of every cached thumbnail of src_path, after it was deleted.
+ * ESP_ERR_NO_MEM when the queue is full, the worker sweeps them at its next start */
+esp_err_t thumb_cache_remove(const char *src_path);
@@ -13,12 +13,16 @@
 #include "esp_vfs.h"
 #include "esp_vfs_fat.h"
 #include "esp_wifi.h"
+#include "esp_netif.h"
+#include "esp_timer.h"
+#include <sys/statvfs.h>
 #include "driver/sdmmc_defs.h"
 #include "driver/sdmmc_types.h"
 #include "sdmmc_cmd.h"
 #include "assert.h"
 #include "bsp_esp32_s3_usb_otg_ev.h"
 #include "display_printf.h"
+#include "display_widget.h"
 #include "tusb_msc.h"
 #include "qrcode.h"
 #include "app.h"
@@ -27,6 +31,8 @@
 static const char *TAG = "usb_msc_demo";
 #define EVENT_TASK_KILL_BIT_0	( 1 << 0 )
 #define EVENT_TASK_KILLED_BIT_1	( 1 << 1 )
+#define DISK_INFO_REFRESH_MS 250
+#define DISK_THROUGHPUT_PERIOD_MS 1000
 
 QueueHandle_t g_disk_queue_hdl = NULL;
 static TaskHandle_t s_task_hdl = NULL;
@@ -34,80 +40,176 @@ static EventGroupHandle_t s_event_group_hdl = NULL;
 
 extern esp_err_t start_file_server(const char *base_path);
 
-static void _display_card_info(const sdmmc_card_t* card)
+/* Rows 2 to 5 of the main page, the card or the fallback to the internal flash */
+static void _card_info_gen(char *buf, size_t len, void *arg)
 {
-    bool print_scr = false;
-    bool print_csd = false;
-    const char* type;
-    char msg[64] = "";
-    sprintf(msg, "SDCart Name: %s", card->cid.name);
-    DISPLAY_PRINTF_LINE("SD", 2, COLOR_RED, msg);
-    if (card->is_sdio) {
-        type = "SDIO";
-        print_scr = true;
-        print_csd = true;
-    } else if (card->is_mmc) {
-        type = "MMC";
-        print_csd = true;
-    } else {
-        type = (card->ocr & SD_OCR_SDHC_CAP) ? "SDHC/SDXC" : "SDSC";
+    int row = (int)(intptr_t)arg;
+    const sdmmc_card_t *card = (const sdmmc_card_t *)iot_board_get_handle(BOARD_SDCARD_ID);
+    if (card == NULL) {
+        const char *rows[] = {"SDCard Not Found", "Or Not Supported!", "", "Using internal Flash"};
+        snprintf(buf, len, "%s", rows[row]);
+        return;
     }
-    sprintf(msg, "Type: %s", type);
-    DISPLAY_PRINTF_LINE("SD", 3, COLOR_RED, msg);
-    if (card->max_freq_khz < 1000) {
-        sprintf(msg, "Speed: %d kHz", card->max_freq_khz);
-    } else {
-        sprintf(msg, "Speed: %d MHz%s", card->max_freq_khz / 1000,
-                card->is_ddr ? ", DDR" : "");
+    switch (row) {
+    case 0:
+        snprintf(buf, len, "SDCart Name: %s", card->cid.name);
+        break;
+    case 1:
+        snprintf(buf, len, "Type: %s", card->is_sdio ? "SDIO" : card->is_mmc ? "MMC" :
+                 (card->ocr & SD_OCR_SDHC_CAP) ? "SDHC/SDXC" : "SDSC");
+        break;
+    case 2:
+        if (card->max_freq_khz < 1000) {
+            snprintf(buf, len, "Speed: %d kHz", card->max_freq_khz);
+        } else {
+            snprintf(buf, len, "Speed: %d MHz%s", card->max_freq_khz / 1000, card->is_ddr ? ", DDR" : "");
+        }
+        break;
+    default:
+        snprintf(buf, len, "Size: %lluMB", ((uint64_t) card->csd.capacity) * card->csd.sector_size / (1024 * 1024));
+        break;
+    }
+}
+
+static bool _disk_space(uint64_t *total, uint64_t *free)
+{
+    struct statvfs st;
+    if (statvfs(BOARD_SDCARD_BASE_PATH, &st) != 0) {
+        return false;
+    }
+    *total = (uint64_t)st.f_blocks * st.f_frsize;
+    *free = (uint64_t)st.f_bfree * st.f_frsize;
+    return true;
+}
+
+static void _free_space_gen(char *buf, size_t len, void *arg)
+{
+    uint64_t total, free;
+    if (!_disk_space(&total, &free)) {
+        snprintf(buf, len, "Free: -");
+        return;
     }
-    DISPLAY_PRINTF_LINE("SD", 4, COLOR_RED, msg);
-    sprintf(msg, "Size: %lluMB", ((uint64_t) card->csd.capacity) * card->csd.sector_size / (1024 * 1024));
-    DISPLAY_PRINTF_LINE("SD", 5, COLOR_RED, msg);
-
-    if (print_csd) {
-        sprintf(msg, "CSD: ver=%d, sector_size=%d, capacity=%d read_bl_len=%d",
-                card->csd.csd_ver,
-                card->csd.sector_size, card->csd.capacity, card->csd.read_block_len);
+    snprintf(buf, len, "Free: %llu/%llu MB", free / (1024 * 1024), total / (1024 * 1024));
+}
+
+static int _used_space_level(void *arg)
+{
+    uint64_t total, free;
+    if (!_disk_space(&total, &free) || total == 0) {
+        return 0;
     }
-    if (print_scr) {
-        sprintf(msg, "SCR: sd_spec=%d, bus_width=%d", card->scr.sd_spec, card->scr.bus_width);
+    return (int)((total - free) * DISPLAY_WIDGET_LEVEL_MAX / total);
+}
+
+/* USB throughput, averaged over DISK_THROUGHPUT_PERIOD_MS so the digits stay readable */
+static void _throughput_gen(char *buf, size_t len, void *arg)
+{
+    static int64_t s_last_us;
+    static uint64_t s_last_read, s_last_write;
+    static uint32_t s_read_kbps, s_write_kbps;
+    int64_t now = esp_timer_get_time();
+    if (now - s_last_us >= DISK_THROUGHPUT_PERIOD_MS * 1000) {
+        uint64_t read, write;
+        tusb_msc_get_transferred(&read, &write);
+        if (s_last_us) {
+            uint32_t ms = (now - s_last_us) / 1000;
+            s_read_kbps = (read - s_last_read) / ms;
+            s_write_kbps = (write - s_last_write) / ms;
+        }
+        s_last_us = now;
+        s_last_read = read;
+        s_last_write = write;
     }
+    snprintf(buf, len, "USB R%u.%u W%u.%u MB/s", s_read_kbps / 1000, s_read_kbps % 1000 / 100,
+             s_write_kbps / 1000, s_write_kbps % 1000 / 100);
 }
 
+/* The station address once connected, the access point otherwise */
+static void _server_gen(char *buf, size_t len, void *arg)
+{
+    esp_netif_ip_info_t info;
+    esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    if (!netif || esp_netif_get_ip_info(netif, &info) != ESP_OK || info.ip.addr == 0) {
+        netif = esp_netif_get_handle_from_ifkey("WIFI_AP_DEF");
+        if (!netif || esp_netif_get_ip_info(netif, &info) != ESP_OK) {
+            snprintf(buf, len, "Server: -");
+            return;
+        }
+    }
+    snprintf(buf, len, "Server: " IPSTR, IP2STR(&info.ip));
+}
+
+#define DISK_ROW(row) ((row) * 16)
+
+/* Main page, Font16 rows like the DISPLAY_PRINTF_LINE screens */
+static display_widget_t s_main_page[] = {
+    DISPLAY_WIDGET_LABEL_INIT(0, DISK_ROW(1), &Font16, COLOR_GREEN, "USB Wireless Disk"),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(2), 240, &Font16, COLOR_RED, _card_info_gen, (void *)0),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(3), 240, &Font16, COLOR_RED, _card_info_gen, (void *)1),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(4), 240, &Font16, COLOR_RED, _card_info_gen, (void *)2),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(5), 240, &Font16, COLOR_YELLOW, _card_info_gen, (void *)3),
+    DISPLAY_WIDGET_LABEL_INIT(0, DISK_ROW(6), &Font16, COLOR_BLUE, "Access files from"),
+    DISPLAY_WIDGET_LABEL_INIT(0, DISK_ROW(7), &Font16, COLOR_BLUE, "USB or Wi-Fi AP"),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(8), 240, &Font16, COLOR_YELLOW, _free_space_gen, NULL),
+    DISPLAY_WIDGET_BAR_INIT(2, DISK_ROW(9) + 3, 236, 10, COLOR_YELLOW, _used_space_level, NULL),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(10), 240, &Font16, COLOR_GREEN, _throughput_gen, NULL),
+    DISPLAY_WIDGET_LABEL_INIT(0, DISK_ROW(12), &Font16, COLOR_RED, "Press OK: QRCode"),
+    DISPLAY_WIDGET_LABEL_INIT(0, DISK_ROW(13), &Font16, COLOR_BLUE, "to Connect Wi-Fi"),
+    DISPLAY_WIDGET_VALUE_INIT(0, DISK_ROW(14), 240, &Font16, COLOR_RED, _server_gen, NULL),
+};
+
 #define QR_BUF_LEN_MAX ((((10) * 4 + 17) * ((10) * 4 + 17) + 7) / 8 + 1) // Calculates the number of bytes needed to store any Version 10 QR Code
 static char s_wifi_qr_buffer[QR_BUF_LEN_MAX] = {0};
 
+/* Keys of the display commands, a queued page or refresh is replaced by a newer one */
+#define DISK_DISPLAY_KEY_PAGE 1
+#define DISK_DISPLAY_KEY_REFRESH 2
+
+/* The pages are drawn by the display task */
+static void _show_main_page(void *arg)
+{
+    display_widget_show(s_main_page, sizeof(s_main_page) / sizeof(s_main_page[0]), COLOR_BLACK);
+}
+
+static void _refresh_main_page(void *arg)
+{
+    /* only the values that changed are drawn */
+    display_widget_refresh(s_main_page, sizeof(s_main_page) / sizeof(s_main_page[0]));
+}
+
+static void _show_qrcode_page(void *arg)
+{
+    wifi_config_t wifi_cfg;
+    esp_wifi_get_config(WIFI_IF_AP, &wifi_cfg);
+    snprintf(s_wifi_qr_buffer, sizeof(s_wifi_qr_buffer), "WIFI:S:%s;T:%s;P:%s;H:%s;", wifi_cfg.ap.ssid, wifi_cfg.ap.password[0]?"WPA":"", wifi_cfg.ap.password, wifi_cfg.ap.ssid_hidden?"true":"false");
+    ESP_LOGI(TAG, "Scan below QR Code to Connect Wi-Fi\n");
+    font_t font = display_printf_get_font();
+    display_printf_draw_clear();
+    /* encoded only when the Wi-Fi config changed since the page was last shown */
+    painter_draw_qr_code(s_wifi_qr_buffer);
+    display_printf_draw_line(&font, 13, COLOR_BLUE, "Scan Wi-Fi QRCode");
+    display_printf_draw_line(&font, 14, COLOR_RED, "Server: 192.168.4.1");
+    painter_flush();
+}
+
+static void _clear_page(void *arg)
+{
+    display_printf_draw_clear();
+    painter_flush();
+}
+
 static void display_info(int page_index)
 {
-    if (page_index == 0) { //main infomation
-        DISPLAY_PRINTF_CLEAR();
-        sdmmc_card_t *card_hdl = (sdmmc_card_t *)iot_board_get_handle(BOARD_SDCARD_ID);
-        if(card_hdl == NULL) {
-            DISPLAY_PRINTF_LINE("SD", 1, COLOR_GREEN, "USB Wireless Disk");
-            DISPLAY_PRINTF_LINE("SD", 2, COLOR_RED, "SDCard Not Found");
-            DISPLAY_PRINTF_LINE("SD", 3, COLOR_RED, "Or Not Supported!");
-            DISPLAY_PRINTF_LINE("SD", 5, COLOR_YELLOW, "Using internal Flash");}
-        else {
-            _display_card_info(card_hdl);
-        }
-        DISPLAY_PRINTF_LINE("SD", 6, COLOR_BLUE, "Access files from");
-        DISPLAY_PRINTF_LINE("SD", 7, COLOR_BLUE, "USB or Wi-Fi AP");
-        DISPLAY_PRINTF_LINE("SD", 9, COLOR_RED, "Press OK:");
-        DISPLAY_PRINTF_LINE("SD", 10, COLOR_BLUE, "Scan QRCode");
-        DISPLAY_PRINTF_LINE("SD", 11, COLOR_BLUE, "to Connect Wi-Fi");
-        DISPLAY_PRINTF_LINE("SD", 13, COLOR_RED, "Server: 192.168.4.1"); 
+    display_server_fn_t page_fn;
+    if (page_index == 0) { //main infomation, the live values are refreshed by the task loop
+        page_fn = _show_main_page;
     } else if (page_index == 1) { //qrcode picture
-        wifi_config_t wifi_cfg;
-        esp_wifi_get_config(WIFI_IF_AP, &wifi_cfg);
-        snprintf(s_wifi_qr_buffer, sizeof(s_wifi_qr_buffer), "WIFI:S:%s;T:%s;P:%s;H:%s;", wifi_cfg.ap.ssid, wifi_cfg.ap.password[0]?"WPA":"", wifi_cfg.ap.password, wifi_cfg.ap.ssid_hidden?"true":"false");
-        esp_qrcode_config_t qr_cfg = PAINTER_QRCODE_CONFIG_DEFAULT();
-        ESP_LOGI(TAG, "Scan below QR Code to Connect Wi-Fi\n");
-        DISPLAY_PRINTF_CLEAR();
-        esp_qrcode_generate(&qr_cfg, s_wifi_qr_buffer);
-        DISPLAY_PRINTF_LINE("SD", 13, COLOR_BLUE, "Scan Wi-Fi QRCode");
-        DISPLAY_PRINTF_LINE("SD", 14, COLOR_RED, "Server: 192.168.4.1");
+        page_fn = _show_qrcode_page;
     } else {
-        DISPLAY_PRINTF_CLEAR();
+        page_fn = _clear_page;
+    }
+    if (display_server_call(DISK_DISPLAY_KEY_PAGE, page_fn, NULL, 0) != ESP_OK) {
+        ESP_LOGW(TAG, "display queue full, page %d not shown", page_index);
     }
 }
 
@@ -174,7 +276,12 @@ void usb_wireless_disk_task(void *pvParameters)
     int max_info_page = 1;
     display_info(current_info_page);
     while (!(xEventGroupGetBits(s_event_group_hdl) & EVENT_TASK_KILL_BIT_0)) {
-        if(xQueueReceive(g_disk_queue_hdl, &current_event, portMAX_DELAY) != pdTRUE) continue;
+        if(xQueueReceive(g_disk_queue_hdl, &current_event, pdMS_TO_TICKS(DISK_INFO_REFRESH_MS)) != pdTRUE) {
+            if (current_info_page == 0) {
+                display_server_call(DISK_DISPLAY_KEY_REFRESH, _refresh_main_page, NULL, 0);
+            }
+            continue;
+        }
         switch (current_event.id) {
             case BTN_CLICK_MENU:
                 break;
@@ -25,6 +25,7 @@
 
 #include "esp_system.h"
 #include "esp_spi_flash.h"
+#include "esp_heap_caps.h"
 #include "bsp_esp32_s3_usb_otg_ev.h"
 #include "spi_bus.h"
 #include "app.h"
@@ -34,14 +35,16 @@
 #include "display_printf.h"
 #include "display_painter.h"
 #include "jpegd2.h"
+#include "icon_atlas.h"
 #include "bsp_esp32_s3_usb_otg_ev.h"
 #include "esp_netif.h"
 #include <sys/statvfs.h>
 
-#define START_ICON_PATH "/spiffs/icon/esp_logo_small.jpg"
-#define ICON_BUF_SIZE (45 * 1024) // wie im Projekt
+#define START_ICON_NAME "esp_logo_small.jpg"
+#define START_ICON_PATH "/spiffs/icon/" START_ICON_NAME
 #define ICON_W 64
 #define ICON_H 64
+#define ICON_STRIP_H 16
 
 static const char *TAG = "app_main";
 QueueHandle_t s_default_queue_hdl = NULL;
@@ -264,13 +267,20 @@ static void _print_info()
     printf("\n");
 }
 
-static void show_start_quadrants_info(void)
+/* Icons go through the display task, the decoder reuses its strip buffer so every strip is waited for */
+static bool painter_draw_icon(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *data)
 {
-    // init display helper (LCD handle ist erst nach iot_board_init() gültig!)
-    DISPLAY_PRINTF_INIT((scr_driver_t *)iot_board_get_handle(BOARD_LCD_ID));
-    DISPLAY_PRINTF_SET_FONT(Font16);
-    DISPLAY_PRINTF_CLEAR();
+    esp_err_t ret;
+    while ((ret = display_server_draw_strip(x, y, w, h, data, false, NULL, NULL)) == ESP_ERR_NO_MEM) {
+        vTaskDelay(1);
+    }
+    display_server_wait_strips();
+    return ESP_OK == ret;
+}
 
+/* Runs in the display task, drawing code of show_start_quadrants_info() */
+static void _draw_start_quadrants_info(void *arg)
+{
     // Screen geometry (BOARD macros aus bsp header)
     const int screen_w = BOARD_LCD_WIDTH;
     const int screen_h = BOARD_LCD_HEIGHT;
@@ -281,21 +291,6 @@ static void show_start_quadrants_info(void)
     painter_draw_vertical_line(mid_x, 0, screen_h, COLOR_WHITE);
     painter_draw_horizontal_line(0, mid_y, screen_w, COLOR_WHITE);
 
-    // 2) draw small logo top-left (0,0)
-    uint8_t *jpeg_buf = malloc(ICON_BUF_SIZE);
-    if (jpeg_buf) {
-        FILE *fd = fopen(START_ICON_PATH, "r");
-        if (fd) {
-            int read_bytes = fread(jpeg_buf, 1, ICON_BUF_SIZE, fd);
-            fclose(fd);
-            if (read_bytes > 0) {
-                // mjpegdraw(..., lcd_width, lcd_height) - use ICON_W/ICON_H as target
-                mjpegdraw(jpeg_buf, read_bytes, NULL, 0, 0, board_lcd_draw_image, ICON_W, ICON_H);
-            }
-        }
-        free(jpeg_buf);
-    }
-
     // 3) prepare font metrics for absolute positioning
     font_t font = display_printf_get_font();
     int line_h = font.Height;
@@ -355,6 +350,41 @@ static void show_start_quadrants_info(void)
     } else {
         painter_draw_string(nx, ny, "STA IP: -", &font, COLOR_CYAN); ny += line_h;
     }
+}
+
+static void show_start_quadrants_info(void)
+{
+    // init display helper (LCD handle ist erst nach iot_board_init() gültig!)
+    DISPLAY_PRINTF_INIT((scr_driver_t *)iot_board_get_handle(BOARD_LCD_ID));
+    DISPLAY_PRINTF_SET_FONT(Font16);
+    DISPLAY_PRINTF_CLEAR();
+    display_server_call(0, _draw_start_quadrants_info, NULL, 0);
+
+    // 2) draw small logo top-left (0,0), it fills the quadrant; decoded from SPIFFS only without the atlas
+    if (icon_atlas_draw(START_ICON_NAME, 0, 0) != ESP_ERR_NOT_FOUND) {
+        return;
+    }
+    // the file is streamed into the decoder, only a strip of ICON_STRIP_H rows is buffered
+    FILE *fd = fopen(START_ICON_PATH, "r");
+    if (fd) {
+        uint8_t *strip = heap_caps_malloc(ICON_W * ICON_STRIP_H * 2, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        jpegd2_ctx_t *jpeg = jpegd2_ctx_create();
+        if (strip && jpeg && jpegd2_set_source_file(jpeg, fd) == ESP_OK) {
+            // lcd_width/lcd_height - use ICON_W/ICON_H as target
+            const jpegd2_output_t out = {
+                .outbuffer = strip,
+                .outbuffer_width = ICON_W,
+                .outbuffer_height = ICON_STRIP_H,
+                .lcd_cb = painter_draw_icon,
+                .lcd_width = ICON_W,
+                .lcd_height = ICON_H,
+            };
+            jpegd2_draw(jpeg, &out);
+        }
+        jpegd2_ctx_delete(jpeg);
+        free(strip);
+        fclose(fd);
+    }
 
     // fertig: kein return value, Display bleibt so stehen; app_manager_task kann später die Anzeige übernehmen
 }
@@ -378,6 +408,8 @@ void app_main(void)
         .format_if_mount_failed = false
     };
     ESP_ERROR_CHECK(esp_vfs_spiffs_register(&spiffs_config));
+    /* without the partition the icons are decoded from SPIFFS as before */
+    icon_atlas_init("icons");
     show_start_quadrants_info();
 
     // Jetzt können alle anderen Module sicher auf SPIFFS zugreifen!
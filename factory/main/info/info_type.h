@@ -14,6 +14,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+#include "screen_driver.h"    /* scr_driver_t, used by display_painter.h */
 #include "display_printf.h"   /* Font type and DISPLAY_PRINTF_SET_FONT */
 #include "display_painter.h"  /* painter_draw_string / painter_get_text_width (if available) */
 
@@ -2,34 +2,200 @@
 // Created by susanne on 27.11.25.
 //
 
-#include "info_types.h"
+#include "info_type.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "esp_log.h"
+
+static const char *TAG = "info";
 
 #ifndef INFO_DEFAULT_MAX_WIDTH
 #define INFO_DEFAULT_MAX_WIDTH 220
 #endif
 
+#ifndef INFO_LAYOUT_CACHE_ENTRIES
+#define INFO_LAYOUT_CACHE_ENTRIES 8     /* paragraphs whose line breaks are kept */
+#endif
+
+/* One line of a laid out paragraph, a part of the paragraph text */
+typedef struct {
+    uint16_t start;
+    uint8_t len;
+    int16_t width;
+} info_line_t;
+
+/* Line breaks of a paragraph, valid while text, font and width stay the same */
+typedef struct {
+    const info_paragraph_t *para;
+    const font_t *font;
+    int16_t max_w;
+    bool wrap;
+    uint32_t hash;                  /* FNV-1a of the text, gen paragraphs change it */
+    uint16_t text_len;
+    uint16_t line_num;
+    uint16_t capacity;              /* lines allocated, kept when the entry is reused */
+    info_line_t *lines;
+} info_layout_t;
+
+/* Pages are drawn by one task, the cache has no lock */
+static info_layout_t s_layouts[INFO_LAYOUT_CACHE_ENTRIES];
+static uint8_t s_layout_next;
+
 /* If your painter provides a width function, define HAVE_PAINTER_GET_TEXT_WIDTH in the project.
-   Otherwise the fallback approximates width by font->Width or 8px per char. */
-static int measure_text_width(const char *s, const font_t *font)
+   Otherwise the fallback approximates width by font->Width or 8px per char.
+   ends[i] is the width of the line up to and including byte i, returns the bytes measured. */
+static size_t measure_text_advances(const char *s, size_t len, const font_t *font, int16_t *ends)
 {
     if (!s) return 0;
 #if defined(HAVE_PAINTER_GET_TEXT_WIDTH)
-    return painter_get_text_width(s, font);
+    return painter_get_text_advances(s, len, font, ends);
 #else
-    if (font && font->Width > 0) return (int)strlen(s) * font->Width;
-    return (int)strlen(s) * 8;
+    int w = (font && font->Width > 0) ? font->Width : 8;
+    size_t i = 0;
+    for (; i < len && s[i] && s[i] != '\n'; ++i) ends[i] = (int16_t)((i + 1) * w);
+    return i;
 #endif
 }
 
-static void draw_line_with_align(const char *line, const font_t *font, uint16_t color,
+static uint32_t text_hash(const char *s, uint16_t *len)
+{
+    uint32_t h = 2166136261u;
+    const char *p = s;
+    for (; *p; ++p) h = (h ^ (uint8_t)*p) * 16777619u;
+    *len = (uint16_t)(p - s);
+    return h;
+}
+
+/* A line may end before byte i unless i continues a UTF-8 character */
+static inline bool is_char_start(const char *s, size_t i)
+{
+    return ((uint8_t)s[i] & 0xC0) != 0x80;
+}
+
+static void layout_add(info_layout_t *l, size_t start, size_t len, int width)
+{
+    if (l->line_num == l->capacity) {
+        /* every line takes at least one byte, a generated paragraph has up to INFO_MAX_LINE_BUF */
+        uint16_t capacity = l->capacity ? l->capacity * 2 : 8;
+        info_line_t *lines = realloc(l->lines, capacity * sizeof(info_line_t));
+        if (!lines) {
+            ESP_LOGW(TAG, "no memory for line %u of a paragraph, it is not drawn", l->line_num + 1);
+            return;
+        }
+        l->lines = lines;
+        l->capacity = capacity;
+    }
+    info_line_t *line = &l->lines[l->line_num++];
+    line->start = (uint16_t)start;
+    line->len = (uint8_t)len;
+    line->width = (int16_t)width;
+}
+
+/* Break one source line (no '\n') into screen lines, one pass over its advances */
+static void layout_line(info_layout_t *l, const char *src, size_t start, size_t len, const font_t *font)
+{
+    int16_t ends[INFO_MAX_LINE_BUF];
+    const char *s = src + start;
+    len = measure_text_advances(s, len, font, ends);
+
+    if (len == 0) {
+        /* empty lines of wrapped paragraphs take no space */
+        if (!l->wrap || l->max_w <= 0) layout_add(l, start, 0, 0);
+        return;
+    }
+    if (!l->wrap || l->max_w <= 0) {
+        /* truncate: the longest prefix that fits */
+        size_t n = len;
+        if (l->max_w > 0) {
+            while (n > 0 && (ends[n - 1] > l->max_w || !is_char_start(s, n))) n--;
+        }
+        layout_add(l, start, n, n ? ends[n - 1] : 0);
+        return;
+    }
+
+    size_t a = 0;
+    while (a < len) {
+        int base = a ? ends[a - 1] : 0;
+        if (a > 0 && s[a - 1] != ' ') {
+            /* the rest of a split word is measured again, without the kerning across the split */
+            measure_text_advances(s + a, len - a, font, ends + a);
+            base = 0;
+        }
+        size_t fit = a;             /* end of the longest part that fits */
+        size_t ink = a;             /* end of its last character that is not a space */
+        size_t word_end = a;        /* end of the text before the last fitting space */
+        for (size_t i = a; i < len && ends[i] - base <= l->max_w; ++i) {
+            if (i + 1 == len || is_char_start(s, i + 1)) {
+                fit = i + 1;
+                if (s[i] != ' ') ink = fit;
+            }
+            if (s[i] == ' ' && ink > a) word_end = ink;
+        }
+        if (fit < len && s[fit] == ' ' && ink == fit) word_end = fit;   /* only the space does not fit */
+
+        size_t end;
+        if (fit == len) {
+            end = ink;
+        } else if (word_end > a) {
+            end = word_end;
+        } else {
+            /* a word wider than the line is split, at least one character per line */
+            end = fit > a ? fit : a + 1;
+            while (end < len && !is_char_start(s, end)) end++;
+        }
+        int width = end > a ? ends[end - 1] - base : 0;
+        layout_add(l, start + a, end - a, width);
+        a = end;
+        while (a < len && s[a] == ' ') a++;
+    }
+}
+
+/* Cached line breaks of a paragraph, laid out again when its text, font or width changed */
+static const info_layout_t *layout_get(const info_paragraph_t *p, const char *src, const font_t *font, int16_t max_w)
+{
+    uint16_t text_len;
+    uint32_t hash = text_hash(src, &text_len);
+    info_layout_t *l = NULL;
+    for (int i = 0; i < INFO_LAYOUT_CACHE_ENTRIES; ++i) {
+        if (s_layouts[i].para == p) {
+            l = &s_layouts[i];
+            break;
+        }
+    }
+    if (l && l->font == font && l->max_w == max_w && l->wrap == p->wrap &&
+            l->hash == hash && l->text_len == text_len) {
+        return l;
+    }
+    if (!l) {
+        l = &s_layouts[s_layout_next];
+        s_layout_next = (s_layout_next + 1) % INFO_LAYOUT_CACHE_ENTRIES;
+    }
+
+    l->para = p;
+    l->font = font;
+    l->max_w = max_w;
+    l->wrap = p->wrap;
+    l->hash = hash;
+    l->text_len = text_len;
+    l->line_num = 0;
+    const char *line_start = src;
+    while (*line_start) {
+        const char *nl = strchr(line_start, '\n');
+        size_t len = nl ? (size_t)(nl - line_start) : strlen(line_start);
+        if (len >= INFO_MAX_LINE_BUF) len = INFO_MAX_LINE_BUF - 1;
+        layout_line(l, src, line_start - src, len, font);
+        if (!nl) break;
+        line_start = nl + 1;
+    }
+    return l;
+}
+
+static void draw_line_with_align(const char *line, int tw, const font_t *font, uint16_t color,
                                  int16_t base_x, int16_t effective_max_w, info_text_align_t align, int16_t y)
 {
     int16_t x = base_x;
     if (align != INFO_ALIGN_LEFT && effective_max_w > 0) {
-        int tw = measure_text_width(line, font);
         if (align == INFO_ALIGN_CENTER) {
             x = base_x + (effective_max_w - tw) / 2;
         } else if (align == INFO_ALIGN_RIGHT) {
@@ -64,90 +230,14 @@ int16_t render_paragraph(int16_t cur_x, int16_t cur_y, const info_page_config_t
         return cur_y;
     }
 
-    const char *line_start = src;
-    while (line_start && *line_start) {
-        const char *nl = strchr(line_start, '\n');
-        size_t len = nl ? (size_t)(nl - line_start) : strlen(line_start);
+    const info_layout_t *layout = layout_get(p, src, font, max_w);
+    for (int i = 0; i < layout->line_num; ++i) {
+        const info_line_t *line = &layout->lines[i];
         char linebuf[INFO_MAX_LINE_BUF];
-        if (len >= sizeof(linebuf)) len = sizeof(linebuf) - 1;
-        memcpy(linebuf, line_start, len);
-        linebuf[len] = '\0';
-
-        if (p->wrap && max_w > 0) {
-            /* naive word-wrap */
-            char *token = linebuf;
-            while (*token) {
-                /* find largest chunk that fits */
-                int last_fit = 0;
-                int last_space = -1;
-                for (int i = 1; token[i-1] != '\0' && i < (int)sizeof(linebuf); ++i) {
-                    char tmp[INFO_MAX_LINE_BUF];
-                    int tocopy = (i < (int)sizeof(tmp)) ? i : (int)sizeof(tmp)-1;
-                    memcpy(tmp, token, tocopy);
-                    tmp[tocopy] = '\0';
-                    int w = measure_text_width(tmp, font);
-                    if (w <= max_w) {
-                        last_fit = i;
-                        char *sp = strrchr(tmp, ' ');
-                        if (sp) last_space = (int)(sp - tmp);
-                    } else {
-                        break;
-                    }
-                }
-                if (last_fit == 0) {
-                    /* nothing fits -> truncate and draw */
-                    char tmp[INFO_MAX_LINE_BUF];
-                    int take = (int)sizeof(tmp) - 1;
-                    memcpy(tmp, token, take);
-                    tmp[take] = '\0';
-                    draw_line_with_align(tmp, font, color, base_x, max_w, align, cur_y);
-                    cur_y += font->Height + page->line_padding;
-                    break;
-                } else {
-                    int take = last_fit;
-                    if (last_space >= 0 && last_space + 1 < take) take = last_space + 1;
-                    char tmp[INFO_MAX_LINE_BUF];
-                    int tocopy = (take < (int)sizeof(tmp)) ? take : (int)sizeof(tmp)-1;
-                    memcpy(tmp, token, tocopy);
-                    tmp[tocopy] = '\0';
-                    /* trim trailing spaces */
-                    while (tocopy > 0 && tmp[tocopy-1] == ' ') tmp[--tocopy] = '\0';
-                    draw_line_with_align(tmp, font, color, base_x, max_w, align, cur_y);
-                    cur_y += font->Height + page->line_padding;
-                    token += take;
-                    while (*token == ' ') token++;
-                }
-            }
-        } else {
-            /* no wrap: draw truncated if needs */
-            if (max_w > 0) {
-                int tw = measure_text_width(linebuf, font);
-                if (tw > max_w) {
-                    /* naive truncation by characters */
-                    int allowed = (int)strlen(linebuf);
-                    while (allowed > 0) {
-                        char tmp[INFO_MAX_LINE_BUF];
-                        int tocopy = (allowed < (int)sizeof(tmp)) ? allowed : (int)sizeof(tmp)-1;
-                        memcpy(tmp, linebuf, tocopy);
-                        tmp[tocopy] = '\0';
-                        if (measure_text_width(tmp, font) <= max_w) break;
-                        allowed--;
-                    }
-                    char tmp[INFO_MAX_LINE_BUF];
-                    memcpy(tmp, linebuf, allowed);
-                    tmp[allowed] = '\0';
-                    draw_line_with_align(tmp, font, color, base_x, max_w, align, cur_y);
-                } else {
-                    draw_line_with_align(linebuf, font, color, base_x, max_w, align, cur_y);
-                }
-            } else {
-                draw_line_with_align(linebuf, font, color, base_x, max_w, align, cur_y);
-            }
-            cur_y += font->Height + page->line_padding;
-        }
-
-        if (!nl) break;
-        line_start = nl + 1;
+        memcpy(linebuf, src + line->start, line->len);
+        linebuf[line->len] = '\0';
+        draw_line_with_align(linebuf, line->width, font, color, base_x, max_w, align, cur_y);
+        cur_y += font->Height + page->line_padding;
     }
 
     return cur_y;
@@ -160,4 +250,4 @@ void render_info_page(const info_page_config_t *page)
     for (size_t i = 0; i < page->paragraphs_count; ++i) {
         y = render_paragraph(page->default_x, y, page, &page->paragraphs[i]);
     }
-}
\ No newline at end of file
+}